@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace endstone::benchmark {
+
+/**
+ * Runs the body of a benchmark and collects what it measured.
+ */
+class State {
+public:
+    /**
+     * Calls func repeatedly until at least MinDuration has elapsed, and records how many items per second were
+     * processed. func processes items_per_call items on each call and returns a value that depends on its work, so the
+     * compiler cannot optimize it away.
+     */
+    template <typename Func>
+    void run(std::uint64_t items_per_call, Func &&func)
+    {
+        using Clock = std::chrono::steady_clock;
+        std::uint64_t calls = 0;
+        const auto start = Clock::now();
+        auto elapsed = Clock::duration::zero();
+        do {
+            sink_ = sink_ + static_cast<std::uint64_t>(func());
+            ++calls;
+            elapsed = Clock::now() - start;
+        } while (elapsed < MinDuration);
+        items_ = calls * items_per_call;
+        seconds_ = std::chrono::duration<double>(elapsed).count();
+    }
+
+    /**
+     * Records an additional value to report, e.g. the memory used per item.
+     */
+    void counter(std::string name, double value)
+    {
+        counters_.emplace_back(std::move(name), value);
+    }
+
+    [[nodiscard]] std::uint64_t getItems() const
+    {
+        return items_;
+    }
+
+    [[nodiscard]] double getSeconds() const
+    {
+        return seconds_;
+    }
+
+    [[nodiscard]] const std::vector<std::pair<std::string, double>> &getCounters() const
+    {
+        return counters_;
+    }
+
+private:
+    static constexpr auto MinDuration = std::chrono::milliseconds(500);
+
+    std::uint64_t items_{0};
+    double seconds_{0};
+    std::vector<std::pair<std::string, double>> counters_;
+    volatile std::uint64_t sink_{0};
+};
+
+using Function = std::function<void(State &)>;
+
+std::vector<std::pair<std::string, Function>> &registry();
+
+struct Registrar {
+    Registrar(std::string name, Function func)
+    {
+        registry().emplace_back(std::move(name), std::move(func));
+    }
+};
+
+}  // namespace endstone::benchmark
+
+#define ENDSTONE_BENCHMARK(suite, name)                                                                        \
+    static void suite##_##name(::endstone::benchmark::State &);                                                \
+    static const ::endstone::benchmark::Registrar suite##_##name##_registrar{#suite "." #name, suite##_##name}; \
+    static void suite##_##name(::endstone::benchmark::State &state)
@@ -0,0 +1,51 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unordered_set>
+#include <vector>
+
+#include "benchmark.h"
+#include "endstone/block/block_ref.h"
+
+namespace endstone {
+
+// flood fill a 64x64x64 cube of air, as done by plugins that detect enclosed areas
+ENDSTONE_BENCHMARK(BlockRef, FloodFill)
+{
+    constexpr int size = 64;
+    const auto inside = [](const BlockRef &block) {
+        return block.getX() >= 0 && block.getX() < size && block.getY() >= 0 && block.getY() < size &&
+               block.getZ() >= 0 && block.getZ() < size;
+    };
+
+    state.run(size * size * size, [&]() {
+        std::unordered_set<BlockRef> visited;
+        visited.reserve(size * size * size);
+        std::vector<BlockRef> queue{BlockRef{}};
+        visited.insert(queue.front());
+
+        while (!queue.empty()) {
+            const auto block = queue.back();
+            queue.pop_back();
+            for (const auto &neighbor : block.getNeighbors()) {
+                if (inside(neighbor) && visited.insert(neighbor).second) {
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+        return visited.size();
+    });
+}
+
+}  // namespace endstone
@@ -0,0 +1,62 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+
+#include "benchmark.h"
+#include "endstone/block/block_volume.h"
+
+namespace endstone {
+
+namespace {
+class TestBlockData : public BlockData {
+public:
+    explicit TestBlockData(std::string type) : type_(std::move(type)) {}
+
+    [[nodiscard]] std::string getType() const override
+    {
+        return type_;
+    }
+
+    [[nodiscard]] BlockStates getBlockStates() const override
+    {
+        return {};
+    }
+
+private:
+    std::string type_;
+};
+}  // namespace
+
+// a 256x256 area of a full overworld column, as read by a world-edit plugin
+ENDSTONE_BENCHMARK(BlockVolume, Fill)
+{
+    BlockVolume volume{0, -64, 0, 256, 384, 256};
+    const auto stone = volume.addToPalette(std::make_shared<TestBlockData>("minecraft:stone"));
+
+    state.run(volume.getIndices().size(), [&]() {
+        for (auto y = volume.getY(); y < volume.getY() + volume.getHeight(); ++y) {
+            for (auto z = volume.getZ(); z < volume.getZ() + volume.getDepth(); ++z) {
+                for (auto x = volume.getX(); x < volume.getX() + volume.getWidth(); ++x) {
+                    volume.getIndices()[volume.offsetOf(x, y, z)] = stone;
+                }
+            }
+        }
+        return volume.getIndices().back();
+    });
+    state.counter("bytes_per_block", sizeof(BlockVolume::Index));
+}
+
+}  // namespace endstone
@@ -0,0 +1,74 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+
+#include "benchmark.h"
+#include "endstone/level/chunk_snapshot.h"
+
+namespace endstone {
+
+namespace {
+class TestBlockData : public BlockData {
+public:
+    explicit TestBlockData(std::string type) : type_(std::move(type)) {}
+
+    [[nodiscard]] std::string getType() const override
+    {
+        return type_;
+    }
+
+    [[nodiscard]] BlockStates getBlockStates() const override
+    {
+        return {};
+    }
+
+private:
+    std::string type_;
+};
+
+// a chunk column of the overworld with the given number of distinct blocks, laid out in horizontal layers
+BlockVolume makeChunk(int x, int z, int num_blocks)
+{
+    BlockVolume volume{x << 4, -64, z << 4, 16, 384, 16};
+    for (int i = 0; i < num_blocks; ++i) {
+        volume.addToPalette(std::make_shared<TestBlockData>("minecraft:block_" + std::to_string(i)));
+    }
+    for (auto y = volume.getY(); y < volume.getY() + volume.getHeight(); ++y) {
+        for (auto bz = volume.getZ(); bz < volume.getZ() + 16; ++bz) {
+            for (auto bx = volume.getX(); bx < volume.getX() + 16; ++bx) {
+                volume.setIndex(bx, y, bz, static_cast<BlockVolume::Index>((y + bx + bz) % num_blocks));
+            }
+        }
+    }
+    return volume;
+}
+}  // namespace
+
+// packs a chunk column with 16 distinct blocks, i.e. 4 bits per block
+ENDSTONE_BENCHMARK(ChunkSnapshot, Create)
+{
+    const auto volume = makeChunk(0, 0, 16);
+    std::size_t memory = 0;
+    state.run(1, [&]() {
+        const ChunkSnapshot snapshot{0, 0, volume};
+        memory = snapshot.getMemoryUsage();
+        return memory;
+    });
+    state.counter("bytes_per_snapshot", static_cast<double>(memory));
+    state.counter("bytes_per_volume", static_cast<double>(volume.getIndices().size() * sizeof(BlockVolume::Index)));
+}
+
+}  // namespace endstone
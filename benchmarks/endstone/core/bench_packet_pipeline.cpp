@@ -0,0 +1,60 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <vector>
+
+#include "benchmark.h"
+#include "endstone/core/logger_factory.h"
+#include "endstone/core/network/packet_pipeline.h"
+
+namespace endstone::core {
+
+namespace {
+constexpr int NumPackets = 1000;
+
+// the work done by the packet sender hook for every packet sent, before and after the engine encodes it
+std::size_t sendPackets(PacketPipeline &pipeline, const std::vector<std::byte> &payload)
+{
+    std::size_t dispatched = 0;
+    for (int i = 0; i < NumPackets; ++i) {
+        const auto id = i % 320;
+        if (pipeline.hasPacketListeners(id)) {
+            pipeline.process(OutboundPacket(id, payload, {}));
+            ++dispatched;
+        }
+    }
+    return dispatched;
+}
+}  // namespace
+
+// send packets while no plugin listens to any of them, the cost paid by every server
+ENDSTONE_BENCHMARK(PacketPipeline, NoListener)
+{
+    PacketPipeline pipeline{LoggerFactory::getLogger("PacketPipelineBenchmark")};
+    const std::vector<std::byte> payload(64);
+    state.run(NumPackets, [&]() { return sendPackets(pipeline, payload); });
+}
+
+// send packets while a plugin listens to one packet type, e.g. the text packets
+ENDSTONE_BENCHMARK(PacketPipeline, OneListener)
+{
+    PacketPipeline pipeline{LoggerFactory::getLogger("PacketPipelineBenchmark")};
+    std::size_t bytes = 0;
+    pipeline.addPacketListener(9, [&](const OutboundPacket &packet) { bytes += packet.getPayload().size(); });
+    const std::vector<std::byte> payload(64);
+    state.run(NumPackets, [&]() { return sendPackets(pipeline, payload); });
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,65 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "endstone/core/player_index.h"
+
+namespace endstone::core {
+
+namespace {
+Player *makePlayer(std::uintptr_t id)
+{
+    // The index never dereferences the pointers it holds, opaque values are good enough here
+    return reinterpret_cast<Player *>(id * alignof(std::max_align_t));
+}
+
+NetworkIdentifier makeNetworkId(std::uint64_t guid)
+{
+    NetworkIdentifier network_id{};
+    network_id.guid = RakNet::RakNetGUID{guid};
+    network_id.type = NetworkIdentifier::Type::RakNet;
+    return network_id;
+}
+}  // namespace
+
+// look up each of 500 online players by network identifier and by name, as done for every packet and command
+ENDSTONE_BENCHMARK(PlayerIndex, Lookup)
+{
+    constexpr int num_players = 500;
+    PlayerIndex index;
+    std::vector<std::string> names;
+    std::vector<NetworkIdentifier> network_ids;
+    for (int i = 0; i < num_players; ++i) {
+        names.push_back("Player" + std::to_string(i));
+        network_ids.push_back(makeNetworkId(i));
+        index.add(makePlayer(i + 1), names.back(), std::to_string(2535400000000000 + i), network_ids.back(),
+                  SubClientId::PrimaryClient);
+    }
+
+    state.run(2 * num_players, [&]() {
+        std::size_t found = 0;
+        for (int i = 0; i < num_players; ++i) {
+            found += index.getByNetworkId(network_ids[i], SubClientId::PrimaryClient) != nullptr;
+            found += index.getByName(names[i]) != nullptr;
+        }
+        return found;
+    });
+}
+
+}  // namespace endstone::core
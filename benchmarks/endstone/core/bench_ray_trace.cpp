@@ -0,0 +1,102 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "endstone/core/level/ray_trace.h"
+
+namespace endstone::core {
+
+namespace {
+// a 128x128x128 area with 1% of solid blocks, traced with random rays of 64 blocks
+constexpr int Size = 128;
+constexpr double Distance = 64;
+constexpr int Rays = 20000;
+
+struct Scene {
+    Scene()
+    {
+        std::mt19937 rng{42};
+        solid.resize(Size * Size * Size);
+        for (auto &block : solid) {
+            block = std::uniform_int_distribution{0, 99}(rng) == 0;
+        }
+        std::normal_distribution<double> normal;
+        for (int i = 0; i < Rays; ++i) {
+            const Vector<double> direction{normal(rng), normal(rng), normal(rng)};
+            directions.push_back(direction / direction.length());
+        }
+    }
+
+    [[nodiscard]] bool isSolid(int x, int y, int z) const
+    {
+        return x >= 0 && x < Size && y >= 0 && y < Size && z >= 0 && z < Size &&
+               solid[(static_cast<std::size_t>(x) * Size + y) * Size + z] != 0;
+    }
+
+    std::vector<std::uint8_t> solid;
+    std::vector<Vector<double>> directions;
+    Vector<double> origin{Size / 2.0, Size / 2.0, Size / 2.0};
+};
+}  // namespace
+
+// native traversal, visiting each crossed block once
+ENDSTONE_BENCHMARK(RayTrace, Traversal)
+{
+    const Scene scene;
+    state.run(Rays, [&]() {
+        int hits = 0;
+        for (const auto &direction : scene.directions) {
+            traverseBlocks(scene.origin, direction, Distance, [&](int x, int y, int z) {
+                if (scene.isSolid(x, y, z)) {
+                    hits++;
+                    return true;
+                }
+                return false;
+            });
+        }
+        return hits;
+    });
+}
+
+// the approach of plugins: small fixed steps along the ray, with a Block object created for every step
+ENDSTONE_BENCHMARK(RayTrace, FixedSteps)
+{
+    const Scene scene;
+    state.run(Rays, [&]() {
+        int hits = 0;
+        for (const auto &direction : scene.directions) {
+            for (double t = 0; t <= Distance; t += 0.1) {
+                const auto position = scene.origin + direction * t;
+                const auto block = std::make_unique<std::string>("minecraft:stone");
+                if (scene.isSolid(static_cast<int>(std::floor(position.getX())),
+                                  static_cast<int>(std::floor(position.getY())),
+                                  static_cast<int>(std::floor(position.getZ()))) &&
+                    !block->empty()) {
+                    hits++;
+                    break;
+                }
+            }
+        }
+        return hits;
+    });
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,58 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include "benchmark.h"
+
+namespace endstone::benchmark {
+
+std::vector<std::pair<std::string, Function>> &registry()
+{
+    static std::vector<std::pair<std::string, Function>> benchmarks;
+    return benchmarks;
+}
+
+}  // namespace endstone::benchmark
+
+/**
+ * Runs the benchmarks whose name contains the first argument, or all of them.
+ */
+int main(int argc, char **argv)
+{
+    using namespace endstone::benchmark;
+
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+    for (const auto &[name, func] : registry()) {
+        if (name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        State state;
+        func(state);
+
+        auto line = fmt::format("{:<48}", name);
+        if (state.getItems() > 0) {
+            const auto per_second = static_cast<double>(state.getItems()) / state.getSeconds();
+            line += fmt::format(" {:>14.0f} items/s {:>12.1f} ns/item", per_second, 1e9 / per_second);
+        }
+        for (const auto &[counter, value] : state.getCounters()) {
+            line += fmt::format("  {}={}", counter, value);
+        }
+        fmt::print("{}\n", line);
+    }
+    return 0;
+}
@@ -4,7 +4,7 @@ import numpy
 import os
 import typing
 import uuid
-__all__ = ['ActionForm', 'Actor', 'ActorDeathEvent', 'ActorEvent', 'ActorKnockbackEvent', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'BanEntry', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockData', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BlockState', 'BossBar', 'BroadcastMessageEvent', 'Cancellable', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'CommandSenderWrapper', 'ConsoleCommandSender', 'Criteria', 'Dimension', 'DisplaySlot', 'Dropdown', 'Event', 'EventPriority', 'GameMode', 'Inventory', 'IpBanEntry', 'IpBanList', 'ItemStack', 'Label', 'Language', 'Level', 'Location', 'Logger', 'MessageForm', 'Mob', 'ModalForm', 'Objective', 'ObjectiveSortOrder', 'Packet', 'PacketType', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'Player', 'PlayerBanEntry', 'PlayerBanList', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerJoinEvent', 'PlayerKickEvent', 'PlayerLoginEvent', 'PlayerQuitEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'ScriptMessageEvent', 'Server', 'ServerCommandEvent', 'ServerEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'Skin', 'Slider', 'SocketAddress', 'SpawnParticleEffectPacket', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'Vector', 'WeatherChangeEvent', 'WeatherEvent']
+__all__ = ['ActionForm', 'Actor', 'ActorDeathEvent', 'ActorEvent', 'ActorKnockbackEvent', 'ActorRayTraceResult', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'BanEntry', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockData', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BlockRayTraceResult', 'BlockRef', 'BlockState', 'BlockTransaction', 'BlockVolume', 'BossBar', 'BroadcastMessageEvent', 'Cancellable', 'ChunkLoadTask', 'ChunkSnapshot', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'CommandSenderWrapper', 'ConsoleCommandSender', 'Criteria', 'Dimension', 'DisplaySlot', 'Dropdown', 'Event', 'EventPriority', 'FluidCollisionMode', 'GameMode', 'Inventory', 'IpBanEntry', 'IpBanList', 'ItemStack', 'Label', 'Language', 'Level', 'Location', 'Logger', 'MessageForm', 'Mob', 'ModalForm', 'NetworkStats', 'Objective', 'ObjectiveSortOrder', 'OutboundPacket', 'Packet', 'PacketRateLimitConfig', 'PacketType', 'PacketTypeStats', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'PlaySoundPacket', 'Player', 'PlayerBanEntry', 'PlayerBanList', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerJoinEvent', 'PlayerKickEvent', 'PlayerLoginEvent', 'PlayerQuitEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'ScriptMessageEvent', 'Server', 'ServerCommandEvent', 'ServerEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'SetTitlePacket', 'Skin', 'Slider', 'SocketAddress', 'SpawnParticleEffectPacket', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'UnconnectedMessage', 'Vector', 'WeatherChangeEvent', 'WeatherEvent']
 class ActionForm:
     """
     Represents a form with buttons that let the player take action.
@@ -251,6 +251,30 @@ class ActorKnockbackEvent(ActorEvent, Cancellable):
         """
         Get the source actor that has caused knockback to the defender, if exists.
         """
+class ActorRayTraceResult:
+    """
+    The actor hit by a ray trace.
+    """
+    @property
+    def actor(self) -> Actor:
+        """
+        The actor hit by the ray.
+        """
+    @property
+    def distance(self) -> float:
+        """
+        The distance from the origin of the ray to the hit position.
+        """
+    @property
+    def face(self) -> BlockFace:
+        """
+        The face of the bounding box hit by the ray.
+        """
+    @property
+    def position(self) -> Vector:
+        """
+        The point where the ray hit the bounding box of the actor.
+        """
 class ActorRemoveEvent(ActorEvent):
     """
     Called when an Actor is removed.
@@ -574,6 +598,109 @@ class BlockPlaceEvent(BlockEvent, Cancellable):
         """
         Gets the player who placed the block involved in this event.
         """
+class BlockRayTraceResult:
+    """
+    The block hit by a ray trace.
+    """
+    @property
+    def distance(self) -> float:
+        """
+        The distance from the origin of the ray to the hit position.
+        """
+    @property
+    def face(self) -> BlockFace:
+        """
+        The face of the block hit by the ray.
+        """
+    @property
+    def position(self) -> Vector:
+        """
+        The point where the ray hit the block.
+        """
+    @property
+    def x(self) -> int:
+        """
+        The X-coordinate of the block.
+        """
+    @property
+    def y(self) -> int:
+        """
+        The Y-coordinate of the block.
+        """
+    @property
+    def z(self) -> int:
+        """
+        The Z-coordinate of the block.
+        """
+class BlockRef:
+    """
+    A lightweight reference to the block at a position in a dimension.
+    """
+    def __eq__(self, arg0: BlockRef) -> bool:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __init__(self, dimension: Dimension, x: int, y: int, z: int) -> None:
+        ...
+    def __repr__(self) -> str:
+        ...
+    @typing.overload
+    def get_relative(self, offset_x: int, offset_y: int, offset_z: int) -> BlockRef:
+        """
+        Gets the block at the given offsets.
+        """
+    @typing.overload
+    def get_relative(self, face: BlockFace, distance: int = 1) -> BlockRef:
+        """
+        Gets the block at the given distance of the given face.
+        """
+    def set_data(self, data: BlockData, apply_physics: bool = True) -> None:
+        """
+        Sets the complete data for this block.
+        """
+    @property
+    def block(self) -> Block:
+        """
+        Gets the Block at the position of this reference.
+        """
+    @property
+    def data(self) -> BlockData:
+        """
+        Gets or sets the complete data for this block.
+        """
+    @data.setter
+    def data(self, arg1: BlockData) -> None:
+        ...
+    @property
+    def dimension(self) -> Dimension:
+        """
+        Gets the dimension which contains this block.
+        """
+    @property
+    def neighbors(self) -> list[BlockRef]:
+        """
+        Gets the six blocks sharing a face with this block, in the order of BlockFace.
+        """
+    @property
+    def type(self) -> str:
+        """
+        Gets the type of this block.
+        """
+    @property
+    def x(self) -> int:
+        """
+        Gets the x-coordinate of this block.
+        """
+    @property
+    def y(self) -> int:
+        """
+        Gets the y-coordinate of this block.
+        """
+    @property
+    def z(self) -> int:
+        """
+        Gets the z-coordinate of this block.
+        """
 class BlockState:
     """
     Represents a captured state of a block, which will not update automatically.
@@ -630,6 +757,86 @@ class BlockState:
         """
         Gets the z-coordinate of this block state.
         """
+class BlockTransaction:
+    """
+    Collects block changes so that they can be applied to a dimension at once.
+    """
+    def __contains__(self, arg0: tuple[int, int, int]) -> bool:
+        ...
+    def __init__(self) -> None:
+        ...
+    def __len__(self) -> int:
+        ...
+    def clear(self) -> None:
+        """
+        Discards all changes.
+        """
+    def get_block_data(self, x: int, y: int, z: int) -> BlockData:
+        """
+        Gets the pending block data at the given coordinates, or None if the block is not changed.
+        """
+    def set_block_data(self, x: int, y: int, z: int, data: BlockData) -> None:
+        """
+        Sets the block data at the given coordinates.
+        """
+class BlockVolume:
+    """
+    Represents a cuboid of blocks, stored as a palette of distinct block data and one palette index per block.
+    """
+    def __init__(self, x: int, y: int, z: int, width: int, height: int, depth: int) -> None:
+        ...
+    def add_to_palette(self, data: BlockData) -> int:
+        """
+        Adds block data to the palette and returns its index.
+        """
+    def get_block_data(self, x: int, y: int, z: int) -> BlockData | None:
+        """
+        Gets the block data at the given world coordinates.
+        """
+    def set_index(self, x: int, y: int, z: int, index: int) -> None:
+        """
+        Sets the palette index of the block at the given world coordinates.
+        """
+    @property
+    def depth(self) -> int:
+        """
+        Gets the size of this volume along the Z axis.
+        """
+    @property
+    def height(self) -> int:
+        """
+        Gets the size of this volume along the Y axis.
+        """
+    @property
+    def indices(self) -> numpy.ndarray[numpy.uint16]:
+        """
+        Gets the palette index of every block as an array of shape (height, depth, width).
+        """
+    @property
+    def palette(self) -> list[BlockData]:
+        """
+        Gets the distinct block data in this volume.
+        """
+    @property
+    def width(self) -> int:
+        """
+        Gets the size of this volume along the X axis.
+        """
+    @property
+    def x(self) -> int:
+        """
+        Gets the x-coordinate of the minimum corner.
+        """
+    @property
+    def y(self) -> int:
+        """
+        Gets the y-coordinate of the minimum corner.
+        """
+    @property
+    def z(self) -> int:
+        """
+        Gets the z-coordinate of the minimum corner.
+        """
 class BossBar:
     """
     Represents a boss bar that is displayed to players.
@@ -744,7 +951,98 @@ class Cancellable:
     @is_cancelled.setter
     def is_cancelled(self, arg1: bool) -> None:
         ...
-class ColorFormat:
+class ChunkLoadTask:
+    """
+    Represents a request to load an area of chunks, started by Dimension.load_chunks_async.
+    """
+    def cancel(self) -> None:
+        """
+        Cancels this task.
+        """
+    def when_complete(self, callback: typing.Callable[[ChunkLoadTask], None]) -> None:
+        """
+        Registers a callback to run on the server thread once this task is done.
+        """
+    @property
+    def chunks_per_second(self) -> float:
+        """
+        Gets the average number of chunks loaded per second since the first batch was started.
+        """
+    @property
+    def is_cancelled(self) -> bool:
+        """
+        Checks if this task has been cancelled.
+        """
+    @property
+    def is_done(self) -> bool:
+        """
+        Checks if this task has finished.
+        """
+    @property
+    def loaded_chunks(self) -> int:
+        """
+        Gets the number of chunks loaded so far.
+        """
+    @property
+    def min_ticks_per_second(self) -> float:
+        """
+        Gets or sets the average ticks per second below which no new batch is started for this task.
+        """
+    @min_ticks_per_second.setter
+    def min_ticks_per_second(self, arg1: float) -> None:
+        ...
+    @property
+    def total_chunks(self) -> int:
+        """
+        Gets the number of chunks requested by this task.
+        """
+class ChunkSnapshot:
+    """
+    Represents an immutable copy of the blocks in a chunk.
+    """
+    def get_block_data(self, x: int, y: int, z: int) -> BlockData | None:
+        """
+        Gets the block data at the given position within the chunk.
+        """
+    def get_palette_index(self, x: int, y: int, z: int) -> int:
+        """
+        Gets the palette index of the block at the given position within the chunk.
+        """
+    @property
+    def bits_per_block(self) -> int:
+        """
+        Gets the number of bits used to store the palette index of each block.
+        """
+    @property
+    def max_height(self) -> int:
+        """
+        Gets the highest Y-coordinate in this snapshot, exclusive.
+        """
+    @property
+    def memory_usage(self) -> int:
+        """
+        Gets the approximate number of bytes used by this snapshot.
+        """
+    @property
+    def min_height(self) -> int:
+        """
+        Gets the lowest Y-coordinate in this snapshot.
+        """
+    @property
+    def palette(self) -> list[BlockData]:
+        """
+        Gets the distinct block data in this chunk.
+        """
+    @property
+    def x(self) -> int:
+        """
+        Gets the X-coordinate of this chunk.
+        """
+    @property
+    def z(self) -> int:
+        """
+        Gets the Z-coordinate of this chunk.
+        """:
     """
     All supported color and format codes.
     """
@@ -784,7 +1082,7 @@ class Command:
     """
     Represents a Command, which executes various tasks upon user input
     """
-    def __init__(self, name: str, description: str | None = None, usages: list[str] | None = None, aliases: list[str] | None = None, permissions: list[str] | None = None, *args, **kwargs) -> None:
+    def __init__(self, name: str, description: str | None = None, usages: list[str] | None = None, aliases: list[str] | None = None, permissions: list[str] | None = None, is_async: bool | None = None, *args, **kwargs) -> None:
         ...
     def execute(self, sender: CommandSender, args: list[str]) -> bool:
         """
@@ -815,6 +1113,14 @@ class Command:
     def description(self, arg1: str) -> None:
         ...
     @property
+    def is_async(self) -> bool:
+        """
+        Whether this command is executed asynchronously off the server thread. Asynchronous commands report success as soon as they are scheduled, so returning False does not show the usage. Cannot be changed once the command is registered.
+        """
+    @is_async.setter
+    def is_async(self, arg1: bool) -> None:
+        ...
+    @property
     def is_registered(self) -> bool:
         """
         Returns the current registered state of this command
@@ -974,6 +1280,22 @@ class Dimension:
     NETHER: typing.ClassVar[Dimension.Type]  # value = <Type.NETHER: 1>
     OVERWORLD: typing.ClassVar[Dimension.Type]  # value = <Type.OVERWORLD: 0>
     THE_END: typing.ClassVar[Dimension.Type]  # value = <Type.THE_END: 2>
+    def apply_transaction(self, transaction: BlockTransaction, apply_physics: bool = True) -> int:
+        """
+        Applies all changes of a block transaction. Returns the number of blocks changed.
+        """
+    def fill(self, x: int, y: int, z: int, width: int, height: int, depth: int, data: BlockData, apply_physics: bool = True) -> int:
+        """
+        Fills a cuboid with the given block data. Returns the number of blocks changed.
+        """
+    def get_actors_in_box(self, min: Vector, max: Vector, type: str | None = None) -> list[Actor]:
+        """
+        Gets the actors whose bounding box intersects the given box.
+        """
+    def get_actors_in_chunk(self, x: int, z: int) -> list[Actor]:
+        """
+        Gets the actors in a chunk.
+        """
     @typing.overload
     def get_block_at(self, location: Location) -> Block:
         """
@@ -984,6 +1306,42 @@ class Dimension:
         """
         Gets the Block at the given coordinates
         """
+    def get_block_data_at(self, x: int, y: int, z: int) -> BlockData:
+        """
+        Gets the block data at the given coordinates without creating a Block.
+        """
+    def get_blocks(self, x: int, y: int, z: int, width: int, height: int, depth: int) -> BlockVolume:
+        """
+        Reads a cuboid of blocks into a BlockVolume.
+        """
+    def get_chunk_snapshot(self, x: int, z: int) -> ChunkSnapshot:
+        """
+        Captures an immutable copy of the blocks in a loaded chunk.
+        """
+    def get_nearby_actors(self, center: Vector, radius: float, type: str | None = None) -> list[Actor]:
+        """
+        Gets the actors whose bounding box is within the given radius of a point.
+        """
+    def load_chunks_async(self, min_x: int, min_z: int, max_x: int, max_z: int) -> ChunkLoadTask:
+        """
+        Starts loading, and generating if needed, every chunk in a rectangular area.
+        """
+    def ray_trace_actors(self, origin: Vector, direction: Vector, max_distance: float, ray_size: float = 0.0, exclude: Actor = None) -> ActorRayTraceResult | None:
+        """
+        Performs a ray trace that checks for collisions with the bounding boxes of actors.
+        """
+    def ray_trace_blocks(self, origin: Vector, direction: Vector, max_distance: float, fluid_mode: FluidCollisionMode = FluidCollisionMode.NEVER) -> BlockRayTraceResult | None:
+        """
+        Performs a ray trace that checks for collisions with blocks.
+        """
+    def set_block_data_at(self, x: int, y: int, z: int, data: BlockData, apply_physics: bool = True) -> None:
+        """
+        Sets the block data at the given coordinates without creating a Block.
+        """
+    def set_blocks(self, volume: BlockVolume, apply_physics: bool = True) -> int:
+        """
+        Writes the blocks of a BlockVolume back to the dimension. Returns the number of blocks changed.
+        """
     @property
     def level(self) -> Level:
         """
@@ -1118,6 +1476,40 @@ class EventPriority:
     @property
     def value(self) -> int:
         ...
+class FluidCollisionMode:
+    """
+    Determines the collision behavior of ray traces with fluids.
+    """
+    ALWAYS: typing.ClassVar[FluidCollisionMode]  # value = <FluidCollisionMode.ALWAYS: 2>
+    NEVER: typing.ClassVar[FluidCollisionMode]  # value = <FluidCollisionMode.NEVER: 0>
+    SOURCE_ONLY: typing.ClassVar[FluidCollisionMode]  # value = <FluidCollisionMode.SOURCE_ONLY: 1>
+    __members__: typing.ClassVar[dict[str, FluidCollisionMode]]  # value = {'NEVER': <FluidCollisionMode.NEVER: 0>, 'SOURCE_ONLY': <FluidCollisionMode.SOURCE_ONLY: 1>, 'ALWAYS': <FluidCollisionMode.ALWAYS: 2>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: int) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: int) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
 class GameMode:
     """
     Represents the various type of game modes that Players may have.
@@ -1313,6 +1705,11 @@ class Level:
         Get a list of all actors in this level
         """
     @property
+    def actors_version(self) -> int:
+        """
+        Gets a counter that changes whenever an actor is added to or removed from this level.
+        """
+    @property
     def dimensions(self) -> list[Dimension]:
         """
         Gets a list of all dimensions within this level.
@@ -1561,6 +1958,50 @@ class ModalForm:
     @title.setter
     def title(self, arg1: str | Translatable) -> ModalForm:
         ...
+class NetworkStats:
+    """
+    Represents the network statistics of a connection, as measured by the transport layer.
+    """
+    @property
+    def bytes_received(self) -> int:
+        """
+        Gets the total number of bytes received, including protocol overhead.
+        """
+    @property
+    def bytes_resent(self) -> int:
+        """
+        Gets the total number of bytes sent again because they were not acknowledged in time.
+        """
+    @property
+    def bytes_sent(self) -> int:
+        """
+        Gets the total number of bytes sent, including protocol overhead and resends.
+        """
+    @property
+    def packet_loss(self) -> float:
+        """
+        Gets the ratio of packets lost over the last second, between 0 and 1.
+        """
+    @property
+    def packets_received(self) -> int:
+        """
+        Gets the total number of RakNet datagrams received, including acknowledgements.
+        """
+    @property
+    def packets_sent(self) -> int:
+        """
+        Gets the total number of RakNet datagrams sent, including acknowledgements and resends.
+        """
+    @property
+    def receive_rate(self) -> int:
+        """
+        Gets the number of bytes received over the last second.
+        """
+    @property
+    def send_rate(self) -> int:
+        """
+        Gets the number of bytes sent over the last second.
+        """
 class Objective:
     """
     Represents an objective on a scoreboard that can show scores specific to entries.
@@ -1666,6 +2107,25 @@ class ObjectiveSortOrder:
     @property
     def value(self) -> int:
         ...
+class OutboundPacket:
+    """
+    Represents a read-only view of a game packet about to be sent to players.
+    """
+    @property
+    def id(self) -> int:
+        """
+        Gets the Minecraft packet ID of the packet.
+        """
+    @property
+    def payload(self) -> bytes:
+        """
+        Gets the encoded body of the packet, without the packet header.
+        """
+    @property
+    def recipients(self) -> list[Player]:
+        """
+        Gets the players the packet is sent to.
+        """
 class Packet:
     """
     Represents a packet.
@@ -1675,12 +2135,62 @@ class Packet:
         """
         Gets the type of the packet.
         """
+class PacketRateLimitConfig:
+    """
+    The limits applied to incoming RakNet datagrams before any packet is deserialized.
+    """
+    class Limit:
+        """
+        A token bucket, refilled at a constant rate up to its capacity.
+        """
+        def __init__(self, rate: float, burst: float) -> None:
+            ...
+        @property
+        def burst(self) -> float:
+            """
+            The number of datagrams allowed in a burst.
+            """
+        @burst.setter
+        def burst(self, arg0: float) -> None:
+            ...
+        @property
+        def rate(self) -> float:
+            """
+            The number of datagrams allowed per second.
+            """
+        @rate.setter
+        def rate(self, arg0: float) -> None:
+            ...
+    acknowledgement: PacketRateLimitConfig.Limit
+    block_duration: datetime.timedelta
+    block_threshold: int
+    connection: PacketRateLimitConfig.Limit
+    datagram: PacketRateLimitConfig.Limit
+    idle_timeout: datetime.timedelta
+    max_peers: int
+    new_peers_per_prefix: PacketRateLimitConfig.Limit
+    other: PacketRateLimitConfig.Limit
+    ping: PacketRateLimitConfig.Limit
+    ping_per_host: PacketRateLimitConfig.Limit
+    ping_total: PacketRateLimitConfig.Limit
+    def __init__(self) -> None:
+        ...
+    @property
+    def enabled(self) -> bool:
+        """
+        Whether incoming datagrams are rate limited at all.
+        """
+    @enabled.setter
+    def enabled(self, arg0: bool) -> None:
+        ...
 class PacketType:
     """
     Represents the types of packets.
     """
+    PLAY_SOUND: typing.ClassVar[PacketType]  # value = <PacketType.PLAY_SOUND: 86>
+    SET_TITLE: typing.ClassVar[PacketType]  # value = <PacketType.SET_TITLE: 88>
     SPAWN_PARTICLE_EFFECT: typing.ClassVar[PacketType]  # value = <PacketType.SPAWN_PARTICLE_EFFECT: 118>
-    __members__: typing.ClassVar[dict[str, PacketType]]  # value = {'SPAWN_PARTICLE_EFFECT': <PacketType.SPAWN_PARTICLE_EFFECT: 118>}
+    __members__: typing.ClassVar[dict[str, PacketType]]  # value = {'PLAY_SOUND': <PacketType.PLAY_SOUND: 86>, 'SET_TITLE': <PacketType.SET_TITLE: 88>, 'SPAWN_PARTICLE_EFFECT': <PacketType.SPAWN_PARTICLE_EFFECT: 118>}
     def __eq__(self, other: typing.Any) -> bool:
         ...
     def __getstate__(self) -> int:
@@ -1707,6 +2217,40 @@ class PacketType:
     @property
     def value(self) -> int:
         ...
+class PacketTypeStats:
+    """
+    Represents the game packets of one type exchanged with a connection.
+    """
+    @property
+    def bytes_received(self) -> int:
+        """
+        Gets the number of bytes of the packets of this type received, before compression.
+        """
+    @property
+    def bytes_sent(self) -> int:
+        """
+        Gets the number of bytes of the packets of this type sent, before compression.
+        """
+    @property
+    def id(self) -> int:
+        """
+        Gets the Minecraft packet ID of the packet type.
+        """
+    @property
+    def name(self) -> str:
+        """
+        Gets the name of the packet type.
+        """
+    @property
+    def packets_received(self) -> int:
+        """
+        Gets the number of packets of this type received.
+        """
+    @property
+    def packets_sent(self) -> int:
+        """
+        Gets the number of packets of this type sent.
+        """
 class Permissible:
     """
     Represents an object that may become a server operator and can be assigned permissions.
@@ -1929,6 +2473,16 @@ class PermissionDefault:
     @property
     def value(self) -> int:
         ...
+class PlaySoundPacket(Packet):
+    """
+    Represents a packet for playing a sound to the client.
+    """
+    pitch: float
+    position: Vector
+    sound_name: str
+    volume: float
+    def __init__(self) -> None:
+        ...
 class Player(Mob):
     """
     Represents a player.
@@ -1981,6 +2535,10 @@ class Player(Mob):
         """
         Sends this player a toast notification.
         """
+    def set_chunk_send_rate(self, chunks_per_tick: int, bytes_per_tick: int) -> None:
+        """
+        Limits the chunks sent to the player per tick, 0 for unlimited.
+        """
     @typing.overload
     def spawn_particle(self, name: str, location: Location, molang_variables_json: str | None = None) -> None:
         """
@@ -2013,6 +2571,16 @@ class Player(Mob):
     def allow_flight(self, arg1: bool) -> None:
         ...
     @property
+    def chunk_bytes_per_tick(self) -> int:
+        """
+        Gets the number of bytes of chunk data sent to the player per tick, or 0 if unlimited.
+        """
+    @property
+    def chunks_per_tick(self) -> int:
+        """
+        Gets the number of sub-chunks sent to the player per tick, or 0 if unlimited.
+        """
+    @property
     def device_id(self) -> str:
         """
         Get the player's current device id.
@@ -2078,6 +2646,16 @@ class Player(Mob):
         Get the player's current locale.
         """
     @property
+    def network_stats(self) -> NetworkStats:
+        """
+        Gets the network statistics of the player's connection.
+        """
+    @property
+    def packet_type_stats(self) -> list[PacketTypeStats]:
+        """
+        Gets the game packets exchanged with the player per packet type since the player joined.
+        """
+    @property
     def ping(self) -> int:
         """
         Gets the player's average ping in milliseconds.
@@ -2881,6 +3459,10 @@ class Server:
         """
         Broadcasts the specified message to every user with permission endstone.broadcast.user
         """
+    def broadcast_packet(self, packet: Packet, recipients: list[Player]) -> None:
+        """
+        Sends a packet to multiple players at once.
+        """
     def create_block_data(self, type: str, block_states: dict[str, bool | str | int] | None = None) -> BlockData:
         """
         Creates a new BlockData instance for the specified block type, with all properties initialized to defaults, except for those provided.
@@ -2897,6 +3479,10 @@ class Server:
         """
         Dispatches a command on this server, and executes it if found.
         """
+    def dispatch_commands(self, sender: CommandSender, command_lines: list[str]) -> list[bool]:
+        """
+        Dispatches multiple commands on this server in a batch, and executes them if found.
+        """
     @typing.overload
     def get_player(self, name: str) -> Player:
         """
@@ -2907,10 +3493,26 @@ class Server:
         """
         Gets the player with the given UUID.
         """
+    def get_player_by_xuid(self, xuid: str) -> Player:
+        """
+        Gets the player with the given Xbox User ID (XUID).
+        """
     def get_plugin_command(self, name: str) -> PluginCommand:
         """
         Gets a PluginCommand with the given name or alias.
         """
+    def invalidate_server_list_ping(self) -> None:
+        """
+        Discards the cached server info, so that ServerListPingEvent is fired for the next ping.
+        """
+    def register_packet_listener(self, plugin: Plugin, packet_id: int, listener: typing.Callable[[OutboundPacket], None]) -> None:
+        """
+        Registers a listener for the game packets with the given Minecraft packet ID sent to players.
+        """
+    def register_unconnected_message_listener(self, plugin: Plugin, message_id: int, listener: typing.Callable[[UnconnectedMessage], None]) -> None:
+        """
+        Registers a listener for the unconnected RakNet messages with the given message ID sent by the server.
+        """
     def reload(self) -> None:
         """
         Reloads the server configuration, functions, scripts and plugins.
@@ -2923,6 +3525,10 @@ class Server:
         """
         Shutdowns the server, stopping everything.
         """
+    def unregister_packet_listeners(self, plugin: Plugin) -> None:
+        """
+        Unregisters all packet listeners registered by a plugin.
+        """
     @property
     def average_mspt(self) -> float:
         """
@@ -3002,6 +3608,11 @@ class Server:
         Gets the name of this server implementation.
         """
     @property
+    def network_stats(self) -> NetworkStats:
+        """
+        Gets the network statistics of the server since it started.
+        """
+    @property
     def online_mode(self) -> bool:
         """
         Gets whether the Server is in online mode or not.
@@ -3012,6 +3623,24 @@ class Server:
         Gets a list of all currently online players.
         """
     @property
+    def online_players_version(self) -> int:
+        """
+        Gets a counter that changes whenever a player joins or quits.
+        """
+    @property
+    def packet_rate_limit(self) -> PacketRateLimitConfig:
+        """
+        Gets or sets the limits applied to incoming RakNet datagrams.
+        """
+    @packet_rate_limit.setter
+    def packet_rate_limit(self, arg1: PacketRateLimitConfig) -> None:
+        ...
+    @property
+    def packet_type_stats(self) -> list[PacketTypeStats]:
+        """
+        Gets the game packets exchanged with all players per packet type since the server started.
+        """
+    @property
     def plugin_manager(self) -> PluginManager:
         """
         Gets the plugin manager for interfacing with plugins.
@@ -3027,6 +3656,22 @@ class Server:
         Gets the primary Scoreboard controlled by the server.
         """
     @property
+    def server_list_ping_cache_ttl(self) -> datetime.timedelta:
+        """
+        Gets or sets how long the server info rendered by ServerListPingEvent is reused.
+        """
+    @server_list_ping_cache_ttl.setter
+    def server_list_ping_cache_ttl(self, arg1: datetime.timedelta) -> None:
+        ...
+    @property
+    def server_list_ping_reply_enabled(self) -> bool:
+        """
+        Gets or sets whether unconnected pings are answered from the cached server info.
+        """
+    @server_list_ping_reply_enabled.setter
+    def server_list_ping_reply_enabled(self, arg1: bool) -> None:
+        ...
+    @property
     def start_time(self) -> datetime.datetime:
         """
         Gets the start time of the server.
@@ -3185,6 +3830,63 @@ class ServerLoadEvent(Event):
     @property
     def type(self) -> ServerLoadEvent.LoadType:
         ...
+class SetTitlePacket(Packet):
+    """
+    Represents a packet for displaying titles, subtitles and action bars on the client.
+    """
+    class Type:
+        """
+        Represents the action of the packet.
+        """
+        ACTIONBAR: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.ACTIONBAR: 4>
+        CLEAR: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.CLEAR: 0>
+        RESET: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.RESET: 1>
+        SUBTITLE: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.SUBTITLE: 3>
+        TIMES: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.TIMES: 5>
+        TITLE: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.TITLE: 2>
+        __members__: typing.ClassVar[dict[str, SetTitlePacket.Type]]  # value = {'CLEAR': <Type.CLEAR: 0>, 'RESET': <Type.RESET: 1>, 'TITLE': <Type.TITLE: 2>, 'SUBTITLE': <Type.SUBTITLE: 3>, 'ACTIONBAR': <Type.ACTIONBAR: 4>, 'TIMES': <Type.TIMES: 5>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: int) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: int) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    ACTIONBAR: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.ACTIONBAR: 4>
+    CLEAR: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.CLEAR: 0>
+    RESET: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.RESET: 1>
+    SUBTITLE: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.SUBTITLE: 3>
+    TIMES: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.TIMES: 5>
+    TITLE: typing.ClassVar[SetTitlePacket.Type]  # value = <Type.TITLE: 2>
+    fade_in_time: int
+    fade_out_time: int
+    filtered_text: str
+    platform_online_id: str
+    stay_time: int
+    text: str
+    type: SetTitlePacket.Type
+    xuid: str
+    def __init__(self) -> None:
+        ...
 class Skin:
     def __init__(self, skin_id: str, skin_data: numpy.ndarray[numpy.uint8], cape_id: str | None = None, cape_data: numpy.ndarray[numpy.uint8] | None = None) -> None:
         ...
@@ -3428,6 +4130,33 @@ class Translatable:
         """
         Get the text to be translated.
         """
+class UnconnectedMessage:
+    """
+    Represents an unconnected RakNet message about to be sent over the network.
+    """
+    @property
+    def address(self) -> SocketAddress:
+        """
+        Gets the address the message is sent to.
+        """
+    @property
+    def id(self) -> int:
+        """
+        Gets the RakNet message ID of the message.
+        """
+    @property
+    def is_modified(self) -> bool:
+        """
+        Checks if the payload has been replaced.
+        """
+    @property
+    def payload(self) -> bytes:
+        """
+        Gets or sets the payload of the message, including the RakNet message ID.
+        """
+    @payload.setter
+    def payload(self, arg1: bytes) -> None:
+        ...
 class Vector:
     """
     Represents a 3-dimensional vector.
@@ -75,6 +75,10 @@ class PythonPluginLoader(PluginLoader):
     def _build_commands(commands: dict) -> list[Command]:
         results = []
         for name, command in commands.items():
+            command = dict(command)
+            if "async" in command:
+                # "async" is a reserved keyword in Python, map it to the argument name used by the binding
+                command["is_async"] = command.pop("async")
             command = Command(name, **command)
             results.append(command)
         return results
@@ -1,3 +1,11 @@
-from endstone._internal.endstone_python import Block, BlockData, BlockFace, BlockState
+from endstone._internal.endstone_python import (
+    Block,
+    BlockData,
+    BlockFace,
+    BlockRef,
+    BlockState,
+    BlockTransaction,
+    BlockVolume,
+)
 
-__all__ = ["Block", "BlockData", "BlockFace", "BlockState"]
+__all__ = ["Block", "BlockData", "BlockFace", "BlockRef", "BlockState", "BlockTransaction", "BlockVolume"]
@@ -1,3 +1,23 @@
-from endstone._internal.endstone_python import Dimension, Level, Location, Position
+from endstone._internal.endstone_python import (
+    ActorRayTraceResult,
+    BlockRayTraceResult,
+    ChunkLoadTask,
+    ChunkSnapshot,
+    Dimension,
+    FluidCollisionMode,
+    Level,
+    Location,
+    Position,
+)
 
-__all__ = ["Dimension", "Level", "Location", "Position"]
+__all__ = [
+    "ActorRayTraceResult",
+    "BlockRayTraceResult",
+    "ChunkLoadTask",
+    "ChunkSnapshot",
+    "Dimension",
+    "FluidCollisionMode",
+    "Level",
+    "Location",
+    "Position",
+]
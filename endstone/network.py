@@ -1,3 +1,25 @@
-from endstone._internal.endstone_python import Packet, PacketType, SpawnParticleEffectPacket
+from endstone._internal.endstone_python import (
+    NetworkStats,
+    OutboundPacket,
+    Packet,
+    PacketRateLimitConfig,
+    PacketType,
+    PacketTypeStats,
+    PlaySoundPacket,
+    SetTitlePacket,
+    SpawnParticleEffectPacket,
+    UnconnectedMessage,
+)
 
-__all__ = ["Packet", "PacketType", "SpawnParticleEffectPacket"]
+__all__ = [
+    "NetworkStats",
+    "OutboundPacket",
+    "Packet",
+    "PacketRateLimitConfig",
+    "PacketType",
+    "PacketTypeStats",
+    "PlaySoundPacket",
+    "SetTitlePacket",
+    "SpawnParticleEffectPacket",
+    "UnconnectedMessage",
+]
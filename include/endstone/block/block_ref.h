@@ -0,0 +1,200 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "endstone/block/block.h"
+#include "endstone/block/block_data.h"
+#include "endstone/block/block_face.h"
+#include "endstone/detail/hash.h"
+#include "endstone/level/dimension.h"
+#include "endstone/util/result.h"
+
+namespace endstone {
+
+/**
+ * @brief A lightweight, trivially copyable reference to the block at a position in a dimension.
+ *
+ * Unlike Block, a BlockRef is a plain value. It can be copied, compared, hashed and offset without any allocation,
+ * which makes it suitable for neighbour walks, flood fills and pathfinding. Accessors are validated on every call, the
+ * same way as Block, so a BlockRef may outlive the chunk it points to.
+ */
+class BlockRef {
+public:
+    BlockRef() = default;
+    BlockRef(Dimension &dimension, int x, int y, int z) noexcept : dimension_(&dimension), x_(x), y_(y), z_(z) {}
+
+    /**
+     * @brief Gets the dimension which contains this block.
+     *
+     * @return Dimension containing this block
+     */
+    [[nodiscard]] Dimension &getDimension() const
+    {
+        return *dimension_;
+    }
+
+    [[nodiscard]] int getX() const noexcept
+    {
+        return x_;
+    }
+
+    [[nodiscard]] int getY() const noexcept
+    {
+        return y_;
+    }
+
+    [[nodiscard]] int getZ() const noexcept
+    {
+        return z_;
+    }
+
+    /**
+     * @brief Gets the block at the given offsets.
+     *
+     * @param offset_x X-coordinate offset
+     * @param offset_y Y-coordinate offset
+     * @param offset_z Z-coordinate offset
+     * @return Block at the given offsets
+     */
+    [[nodiscard]] BlockRef getRelative(int offset_x, int offset_y, int offset_z) const noexcept
+    {
+        BlockRef result = *this;
+        result.x_ += offset_x;
+        result.y_ += offset_y;
+        result.z_ += offset_z;
+        return result;
+    }
+
+    /**
+     * @brief Gets the block at the given distance of the given face.
+     *
+     * @param face Face of this block to return
+     * @param distance Distance to get the block at
+     * @return Block at the given face
+     */
+    [[nodiscard]] BlockRef getRelative(BlockFace face, int distance = 1) const noexcept
+    {
+        switch (face) {
+        case BlockFace::Down:
+            return getRelative(0, -distance, 0);
+        case BlockFace::Up:
+            return getRelative(0, distance, 0);
+        case BlockFace::North:
+            return getRelative(0, 0, -distance);
+        case BlockFace::South:
+            return getRelative(0, 0, distance);
+        case BlockFace::West:
+            return getRelative(-distance, 0, 0);
+        case BlockFace::East:
+            return getRelative(distance, 0, 0);
+        default:
+            return *this;
+        }
+    }
+
+    /**
+     * @brief Gets the six blocks sharing a face with this block, in the order of BlockFace.
+     *
+     * @return The neighbours of this block
+     */
+    [[nodiscard]] std::array<BlockRef, 6> getNeighbors() const noexcept
+    {
+        return {getRelative(BlockFace::Down),  getRelative(BlockFace::Up),   getRelative(BlockFace::North),
+                getRelative(BlockFace::South), getRelative(BlockFace::West), getRelative(BlockFace::East)};
+    }
+
+    /**
+     * @brief Gets the type of this block.
+     *
+     * @return block type
+     */
+    [[nodiscard]] Result<std::string> getType() const
+    {
+        auto data = getData();
+        if (!data) {
+            return nonstd::make_unexpected(data.error());
+        }
+        return data.value()->getType();
+    }
+
+    /**
+     * @brief Gets the complete block data for this block.
+     *
+     * The returned block data is shared with every other block of the same type and states.
+     *
+     * @return block specific data
+     */
+    [[nodiscard]] Result<std::shared_ptr<BlockData>> getData() const
+    {
+        return dimension_->getBlockDataAt(x_, y_, z_);
+    }
+
+    /**
+     * @brief Sets the complete data for this block.
+     *
+     * @param data new block specific data
+     * @param apply_physics False to cancel physics from the changed block
+     */
+    Result<void> setData(std::shared_ptr<BlockData> data, bool apply_physics = true) const
+    {
+        return dimension_->setBlockDataAt(x_, y_, z_, std::move(data), apply_physics);
+    }
+
+    /**
+     * @brief Gets the Block at the position of this reference, for APIs that need one.
+     *
+     * @return Block at the position of this reference
+     */
+    [[nodiscard]] Result<std::unique_ptr<Block>> getBlock() const
+    {
+        return dimension_->getBlockAt(x_, y_, z_);
+    }
+
+    bool operator==(const BlockRef &other) const noexcept = default;
+
+private:
+    friend struct std::hash<BlockRef>;
+
+    Dimension *dimension_ = nullptr;
+    int x_ = 0;
+    int y_ = 0;
+    int z_ = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<BlockRef>);
+
+}  // namespace endstone
+
+namespace std {
+template <>
+struct hash<endstone::BlockRef> {
+    std::size_t operator()(const endstone::BlockRef &value) const noexcept
+    {
+        auto seed = std::hash<const endstone::Dimension *>{}(value.dimension_);
+        for (const auto coordinate : {value.x_, value.y_, value.z_}) {
+            endstone::detail::hash_combine(seed, std::hash<int>{}(coordinate));
+        }
+        return seed;
+    }
+};
+}  // namespace std
@@ -0,0 +1,169 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "endstone/block/block_data.h"
+#include "endstone/detail/hash.h"
+
+namespace endstone {
+
+/**
+ * @brief Collects block changes so that they can be applied to a dimension at once.
+ *
+ * When a transaction is applied with Dimension::applyTransaction, the changes are written chunk by chunk. Neighbour
+ * updates are only triggered from the blocks on the boundary of the edit, once every block in it has its final state,
+ * instead of cascading through the edit for every single block.
+ *
+ * A transaction does not refer to any dimension. It can be built on any thread.
+ */
+class BlockTransaction {
+public:
+    /**
+     * @brief A pending change of a single block.
+     */
+    struct Change {
+        int x;
+        int y;
+        int z;
+        std::shared_ptr<BlockData> data;
+    };
+
+    /**
+     * @brief Sets the block data at the given coordinates. A later change of the same block replaces this one.
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @param data The new block data
+     */
+    void setBlockData(int x, int y, int z, std::shared_ptr<BlockData> data)
+    {
+        auto [it, inserted] = index_.try_emplace(Position{x, y, z}, changes_.size());
+        if (inserted) {
+            changes_.push_back({x, y, z, std::move(data)});
+        }
+        else {
+            changes_[it->second].data = std::move(data);
+        }
+    }
+
+    /**
+     * @brief Gets the pending block data at the given coordinates.
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @return The pending block data, or null if the block is not changed by this transaction
+     */
+    [[nodiscard]] std::shared_ptr<BlockData> getBlockData(int x, int y, int z) const
+    {
+        if (auto it = index_.find(Position{x, y, z}); it != index_.end()) {
+            return changes_[it->second].data;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Checks if the block at the given coordinates is changed by this transaction.
+     */
+    [[nodiscard]] bool contains(int x, int y, int z) const
+    {
+        return index_.contains(Position{x, y, z});
+    }
+
+    /**
+     * @brief Checks if the block at the given coordinates and all six blocks sharing a face with it are changed by this
+     * transaction. Neighbour updates are not triggered from such blocks.
+     */
+    [[nodiscard]] bool isInterior(int x, int y, int z) const
+    {
+        return contains(x, y, z) && contains(x, y - 1, z) && contains(x, y + 1, z) && contains(x, y, z - 1) &&
+               contains(x, y, z + 1) && contains(x - 1, y, z) && contains(x + 1, y, z);
+    }
+
+    /**
+     * @brief Gets the changes in the order they were first made.
+     */
+    [[nodiscard]] const std::vector<Change> &getChanges() const
+    {
+        return changes_;
+    }
+
+    /**
+     * @brief Gets the changes in the order they are applied: chunk by chunk, then by Y, Z and X within a chunk.
+     */
+    [[nodiscard]] std::vector<const Change *> getChangesInChunkOrder() const
+    {
+        std::vector<const Change *> result;
+        result.reserve(changes_.size());
+        for (const auto &change : changes_) {
+            result.push_back(&change);
+        }
+        std::sort(result.begin(), result.end(), [](const Change *a, const Change *b) {
+            return std::tuple(a->x >> 4, a->z >> 4, a->y, a->z, a->x) <
+                   std::tuple(b->x >> 4, b->z >> 4, b->y, b->z, b->x);
+        });
+        return result;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return changes_.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return changes_.empty();
+    }
+
+    void clear()
+    {
+        changes_.clear();
+        index_.clear();
+    }
+
+private:
+    struct Position {
+        int x;
+        int y;
+        int z;
+
+        bool operator==(const Position &other) const = default;
+    };
+
+    struct PositionHash {
+        std::size_t operator()(const Position &position) const
+        {
+            auto seed = std::hash<int>{}(position.x);
+            detail::hash_combine(seed, std::hash<int>{}(position.z));
+            detail::hash_combine(seed, std::hash<int>{}(position.y));
+            return seed;
+        }
+    };
+
+    std::vector<Change> changes_;
+    std::unordered_map<Position, std::size_t, PositionHash> index_;
+};
+
+}  // namespace endstone
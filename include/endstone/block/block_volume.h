@@ -0,0 +1,236 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "endstone/block/block_data.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a cuboid of blocks, stored as a palette of distinct block data and one palette index per block.
+ *
+ * A volume does not refer to the world it was read from. It can be kept, copied and read from any thread.
+ */
+class BlockVolume {
+public:
+    using Index = std::uint16_t;
+
+    /**
+     * @brief The maximum number of distinct block data in a volume, as many as an Index can address.
+     */
+    static constexpr std::size_t MaxPaletteSize = static_cast<std::size_t>(std::numeric_limits<Index>::max()) + 1;
+
+    BlockVolume() = default;
+
+    /**
+     * @brief Creates an empty volume. All indices are 0 and the palette is empty.
+     *
+     * @param x X-coordinate of the minimum corner
+     * @param y Y-coordinate of the minimum corner
+     * @param z Z-coordinate of the minimum corner
+     * @param width Size along the X axis
+     * @param height Size along the Y axis
+     * @param depth Size along the Z axis
+     */
+    BlockVolume(int x, int y, int z, int width, int height, int depth)
+        : x_(x), y_(y), z_(z), width_(width), height_(height), depth_(depth),
+          indices_(static_cast<std::size_t>(width) * height * depth)
+    {
+    }
+
+    /**
+     * @brief Gets the X-coordinate of the minimum corner.
+     *
+     * @return X-coordinate of the minimum corner
+     */
+    [[nodiscard]] int getX() const
+    {
+        return x_;
+    }
+
+    /**
+     * @brief Gets the Y-coordinate of the minimum corner.
+     *
+     * @return Y-coordinate of the minimum corner
+     */
+    [[nodiscard]] int getY() const
+    {
+        return y_;
+    }
+
+    /**
+     * @brief Gets the Z-coordinate of the minimum corner.
+     *
+     * @return Z-coordinate of the minimum corner
+     */
+    [[nodiscard]] int getZ() const
+    {
+        return z_;
+    }
+
+    /**
+     * @brief Gets the size of this volume along the X axis.
+     *
+     * @return Size along the X axis
+     */
+    [[nodiscard]] int getWidth() const
+    {
+        return width_;
+    }
+
+    /**
+     * @brief Gets the size of this volume along the Y axis.
+     *
+     * @return Size along the Y axis
+     */
+    [[nodiscard]] int getHeight() const
+    {
+        return height_;
+    }
+
+    /**
+     * @brief Gets the size of this volume along the Z axis.
+     *
+     * @return Size along the Z axis
+     */
+    [[nodiscard]] int getDepth() const
+    {
+        return depth_;
+    }
+
+    /**
+     * @brief Gets the distinct block data in this volume.
+     *
+     * @return The palette
+     */
+    [[nodiscard]] const std::vector<std::shared_ptr<BlockData>> &getPalette() const
+    {
+        return palette_;
+    }
+
+    /**
+     * @brief Adds block data to the palette.
+     *
+     * @param data The block data to add
+     * @return The palette index of the block data
+     * @throws std::length_error if the palette already holds MaxPaletteSize entries
+     */
+    Index addToPalette(std::shared_ptr<BlockData> data)
+    {
+        if (palette_.size() >= MaxPaletteSize) {
+            throw std::length_error("The palette of a block volume cannot hold more than 65536 entries.");
+        }
+        palette_.push_back(std::move(data));
+        return static_cast<Index>(palette_.size() - 1);
+    }
+
+    /**
+     * @brief Gets the palette index of every block, in YZX order (X changes fastest).
+     *
+     * @return The palette indices
+     */
+    [[nodiscard]] const std::vector<Index> &getIndices() const
+    {
+        return indices_;
+    }
+
+    /**
+     * @brief Gets the palette index of every block, in YZX order (X changes fastest).
+     *
+     * @return The palette indices
+     */
+    [[nodiscard]] std::vector<Index> &getIndices()
+    {
+        return indices_;
+    }
+
+    /**
+     * @brief Gets the position in the index array of the block at the given world coordinates.
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @return Position in the index array
+     */
+    [[nodiscard]] std::size_t offsetOf(int x, int y, int z) const
+    {
+        return (static_cast<std::size_t>(y - y_) * depth_ + (z - z_)) * width_ + (x - x_);
+    }
+
+    /**
+     * @brief Checks if the given world coordinates are inside this volume.
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @return true if the coordinates are inside this volume
+     */
+    [[nodiscard]] bool contains(int x, int y, int z) const
+    {
+        return x >= x_ && x < x_ + width_ && y >= y_ && y < y_ + height_ && z >= z_ && z < z_ + depth_;
+    }
+
+    /**
+     * @brief Gets the block data at the given world coordinates.
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @return The block data, or nullptr if the coordinates are outside this volume
+     */
+    [[nodiscard]] std::shared_ptr<BlockData> getBlockData(int x, int y, int z) const
+    {
+        if (!contains(x, y, z)) {
+            return nullptr;
+        }
+        const auto index = indices_[offsetOf(x, y, z)];
+        return index < palette_.size() ? palette_[index] : nullptr;
+    }
+
+    /**
+     * @brief Sets the palette index of the block at the given world coordinates.
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @param index The palette index
+     */
+    void setIndex(int x, int y, int z, Index index)
+    {
+        if (contains(x, y, z)) {
+            indices_[offsetOf(x, y, z)] = index;
+        }
+    }
+
+private:
+    int x_{0};
+    int y_{0};
+    int z_{0};
+    int width_{0};
+    int height_{0};
+    int depth_{0};
+    std::vector<std::shared_ptr<BlockData>> palette_;
+    std::vector<Index> indices_;
+};
+
+}  // namespace endstone
@@ -22,6 +22,7 @@
 
 #include "endstone/command/command_map.h"
 #include "endstone/command/command_sender.h"
+#include "endstone/util/result.h"
 
 namespace endstone {
 
@@ -180,6 +181,39 @@ public:
         permissions_ = std::move(std::vector<std::string>{permissions...});
     }
 
+    /**
+     * Returns whether this command is executed asynchronously
+     *
+     * An asynchronous command reports success to the caller as soon as it is scheduled, see setAsync.
+     *
+     * @return true if the command is executed off the server thread, otherwise false
+     */
+    [[nodiscard]] bool isAsync() const
+    {
+        return async_;
+    }
+
+    /**
+     * Sets whether this command should be executed asynchronously.
+     *
+     * Asynchronous commands are executed on the scheduler's worker threads and receive a thread-safe proxy of the
+     * sender. Only supported for plugin commands. The dispatch reports success as soon as the command is scheduled, so
+     * the result of execute is not seen by the caller: returning false does not send the usage message, the command
+     * has to report errors to the sender itself.
+     *
+     * @param async true to execute the command off the server thread
+     * @return an error if the command is already registered, in which case it is left unchanged
+     */
+    Result<void> setAsync(bool async)
+    {
+        if (isRegistered()) {
+            return nonstd::make_unexpected(
+                Error("Cannot change whether command /" + name_ + " is asynchronous after it has been registered.", ""));
+        }
+        async_ = async;
+        return {};
+    }
+
     /**
      * Tests the given CommandSender to see if they can perform this command.
      * If they do not have permission, they will be informed that they cannot do this.
@@ -272,6 +306,7 @@ private:
     std::vector<std::string> aliases_;
     std::vector<std::string> usages_;
     std::vector<std::string> permissions_;
+    bool async_ = false;
     CommandMap *command_map_ = nullptr;
 };
 }  // namespace endstone
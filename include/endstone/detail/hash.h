@@ -0,0 +1,30 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+
+namespace endstone::detail {
+/**
+ * @brief Mixes the hash of a value into a seed, in the same way as boost::hash_combine.
+ *
+ * @param seed The hash combined so far, updated in place.
+ * @param value The hash of the next value.
+ */
+inline void hash_combine(std::size_t &seed, std::size_t value) noexcept
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+}  // namespace endstone::detail
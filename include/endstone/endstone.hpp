@@ -34,7 +34,10 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "block/block.h"
 #include "block/block_data.h"
 #include "block/block_face.h"
+#include "block/block_ref.h"
 #include "block/block_state.h"
+#include "block/block_transaction.h"
+#include "block/block_volume.h"
 #include "boss/bar_color.h"
 #include "boss/bar_flag.h"
 #include "boss/bar_style.h"
@@ -100,15 +103,26 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "inventory/player_inventory.h"
 #include "lang/language.h"
 #include "lang/translatable.h"
+#include "level/chunk_load_task.h"
+#include "level/chunk_snapshot.h"
 #include "level/dimension.h"
+#include "level/fluid_collision_mode.h"
 #include "level/level.h"
 #include "level/location.h"
 #include "level/position.h"
+#include "level/ray_trace_result.h"
 #include "logger.h"
 #include "message.h"
+#include "network/network_stats.h"
+#include "network/outbound_packet.h"
+#include "network/packet_rate_limit_config.h"
 #include "network/packet.h"
 #include "network/packet_type.h"
+#include "network/packet_type_stats.h"
+#include "network/play_sound_packet.h"
+#include "network/set_title_packet.h"
 #include "network/spawn_particle_effect_packet.h"
+#include "network/unconnected_message.h"
 #include "permissions/permissible.h"
 #include "permissions/permission.h"
 #include "permissions/permission_attachment.h"
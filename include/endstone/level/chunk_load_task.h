@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace endstone {
+
+/**
+ * @brief Represents a request to load an area of chunks, started by Dimension::loadChunksAsync.
+ *
+ * The chunks are loaded in batches by the server thread, a few batches at a time. A task may be queried or cancelled
+ * from any thread, but it only completes on the server thread.
+ */
+class ChunkLoadTask {
+public:
+    virtual ~ChunkLoadTask() = default;
+
+    /**
+     * @brief Gets the number of chunks requested by this task.
+     *
+     * @return The number of chunks in the area
+     */
+    [[nodiscard]] virtual std::size_t getTotalChunks() const = 0;
+
+    /**
+     * @brief Gets the number of chunks loaded so far.
+     *
+     * @return The number of chunks loaded
+     */
+    [[nodiscard]] virtual std::size_t getLoadedChunks() const = 0;
+
+    /**
+     * @brief Gets the average number of chunks loaded per second since the first batch was started.
+     *
+     * @return The average load rate
+     */
+    [[nodiscard]] virtual float getChunksPerSecond() const = 0;
+
+    /**
+     * @brief Gets the average ticks per second below which no new batch is started for this task.
+     *
+     * @return The minimum ticks per second
+     */
+    [[nodiscard]] virtual float getMinTicksPerSecond() const = 0;
+
+    /**
+     * @brief Sets the average ticks per second below which no new batch is started for this task.
+     *
+     * Batches already in progress are not affected. Use 0 to load the chunks as fast as possible.
+     *
+     * @param min_tps The minimum ticks per second
+     */
+    virtual void setMinTicksPerSecond(float min_tps) = 0;
+
+    /**
+     * @brief Checks if this task has finished, either because every batch was processed or because it was cancelled.
+     *
+     * @return true if the task has finished
+     */
+    [[nodiscard]] virtual bool isDone() const = 0;
+
+    /**
+     * @brief Checks if this task has been cancelled.
+     *
+     * @return true if the task has been cancelled
+     */
+    [[nodiscard]] virtual bool isCancelled() const = 0;
+
+    /**
+     * @brief Cancels this task. Chunks already loaded stay loaded until the server unloads them.
+     *
+     * The task is done once the batches in progress have finished, at the latest on the next server tick.
+     */
+    virtual void cancel() = 0;
+
+    /**
+     * @brief Registers a callback to run on the server thread once this task is done.
+     *
+     * The callback runs immediately on the calling thread if the task is already done.
+     *
+     * @param callback The callback to run
+     */
+    virtual void whenComplete(std::function<void(ChunkLoadTask &)> callback) = 0;
+};
+
+}  // namespace endstone
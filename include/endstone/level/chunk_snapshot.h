@@ -0,0 +1,185 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "endstone/block/block_data.h"
+#include "endstone/block/block_volume.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents an immutable copy of the blocks in a chunk.
+ *
+ * Palette indices are bit-packed with as few bits per block as the palette needs, so a chunk with 16 distinct blocks
+ * takes 4 bits per block. A snapshot never changes after it has been created and can be read from any thread.
+ */
+class ChunkSnapshot {
+public:
+    /**
+     * @brief Creates a snapshot from a volume covering a whole chunk column.
+     *
+     * @param x X-coordinate of the chunk
+     * @param z Z-coordinate of the chunk
+     * @param volume The blocks of the chunk, 16 blocks wide and deep
+     * @throws std::invalid_argument if the volume is not 16 blocks wide and deep
+     */
+    ChunkSnapshot(int x, int z, const BlockVolume &volume)
+        : x_(x), z_(z), min_height_(volume.getY()), height_(volume.getHeight()), palette_(volume.getPalette())
+    {
+        if (volume.getWidth() != 16 || volume.getDepth() != 16) {
+            throw std::invalid_argument("A chunk snapshot must be created from a volume 16 blocks wide and deep.");
+        }
+        bits_per_block_ = palette_.size() <= 1 ? 0 : static_cast<int>(std::bit_width(palette_.size() - 1));
+        if (bits_per_block_ == 0) {
+            return;
+        }
+
+        const auto &indices = volume.getIndices();
+        const auto blocks_per_word = 64 / bits_per_block_;
+        words_.resize((indices.size() + blocks_per_word - 1) / blocks_per_word);
+        std::size_t i = 0;
+        for (auto &word : words_) {
+            for (auto shift = 0; shift + bits_per_block_ <= 64 && i < indices.size(); shift += bits_per_block_) {
+                word |= static_cast<std::uint64_t>(indices[i++]) << shift;
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the X-coordinate of this chunk.
+     *
+     * @return X-coordinate of this chunk
+     */
+    [[nodiscard]] int getX() const
+    {
+        return x_;
+    }
+
+    /**
+     * @brief Gets the Z-coordinate of this chunk.
+     *
+     * @return Z-coordinate of this chunk
+     */
+    [[nodiscard]] int getZ() const
+    {
+        return z_;
+    }
+
+    /**
+     * @brief Gets the lowest Y-coordinate in this snapshot.
+     *
+     * @return The minimum height
+     */
+    [[nodiscard]] int getMinHeight() const
+    {
+        return min_height_;
+    }
+
+    /**
+     * @brief Gets the highest Y-coordinate in this snapshot, exclusive.
+     *
+     * @return The maximum height
+     */
+    [[nodiscard]] int getMaxHeight() const
+    {
+        return min_height_ + height_;
+    }
+
+    /**
+     * @brief Gets the distinct block data in this chunk.
+     *
+     * @return The palette
+     */
+    [[nodiscard]] const std::vector<std::shared_ptr<BlockData>> &getPalette() const
+    {
+        return palette_;
+    }
+
+    /**
+     * @brief Gets the palette index of the block at the given position.
+     *
+     * @param x X-coordinate within the chunk, from 0 to 15
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate within the chunk, from 0 to 15
+     * @return The palette index, or 0 if the position is outside this chunk
+     */
+    [[nodiscard]] BlockVolume::Index getPaletteIndex(int x, int y, int z) const
+    {
+        if (bits_per_block_ == 0 || x < 0 || x > 15 || z < 0 || z > 15 || y < min_height_ || y >= getMaxHeight()) {
+            return 0;
+        }
+        const auto i = (static_cast<std::size_t>(y - min_height_) * 16 + z) * 16 + x;
+        const auto blocks_per_word = 64 / bits_per_block_;
+        const auto mask = (std::uint64_t{1} << bits_per_block_) - 1;
+        return static_cast<BlockVolume::Index>((words_[i / blocks_per_word] >>
+                                                ((i % blocks_per_word) * bits_per_block_)) &
+                                               mask);
+    }
+
+    /**
+     * @brief Gets the block data at the given position.
+     *
+     * @param x X-coordinate within the chunk, from 0 to 15
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate within the chunk, from 0 to 15
+     * @return The block data, or nullptr if the position is outside this chunk
+     */
+    [[nodiscard]] std::shared_ptr<BlockData> getBlockData(int x, int y, int z) const
+    {
+        if (palette_.empty() || x < 0 || x > 15 || z < 0 || z > 15 || y < min_height_ || y >= getMaxHeight()) {
+            return nullptr;
+        }
+        return palette_[getPaletteIndex(x, y, z)];
+    }
+
+    /**
+     * @brief Gets the number of bits used to store the palette index of each block.
+     *
+     * @return Bits per block
+     */
+    [[nodiscard]] int getBitsPerBlock() const
+    {
+        return bits_per_block_;
+    }
+
+    /**
+     * @brief Gets the approximate number of bytes used by this snapshot, excluding the shared block data.
+     *
+     * @return Memory usage in bytes
+     */
+    [[nodiscard]] std::size_t getMemoryUsage() const
+    {
+        return sizeof(*this) + words_.capacity() * sizeof(std::uint64_t) +
+               palette_.capacity() * sizeof(std::shared_ptr<BlockData>);
+    }
+
+private:
+    int x_;
+    int z_;
+    int min_height_;
+    int height_;
+    int bits_per_block_;
+    std::vector<std::shared_ptr<BlockData>> palette_;
+    std::vector<std::uint64_t> words_;
+};
+
+}  // namespace endstone
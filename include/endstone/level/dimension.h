@@ -14,7 +14,19 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "endstone/actor/actor.h"
 #include "endstone/block/block.h"
+#include "endstone/block/block_transaction.h"
+#include "endstone/block/block_volume.h"
+#include "endstone/level/chunk_load_task.h"
+#include "endstone/level/chunk_snapshot.h"
+#include "endstone/level/fluid_collision_mode.h"
+#include "endstone/level/ray_trace_result.h"
 #include "endstone/util/result.h"
 
 namespace endstone {
@@ -74,5 +86,183 @@ public:
      * @return Block at the given coordinates
      */
     virtual Result<std::unique_ptr<Block>> getBlockAt(Location location) = 0;
+
+    /**
+     * @brief Gets the block data at the given coordinates without creating a Block.
+     *
+     * The returned block data is shared with every other block of the same type and states.
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @return The block data at the given coordinates
+     */
+    [[nodiscard]] virtual Result<std::shared_ptr<BlockData>> getBlockDataAt(int x, int y, int z) = 0;
+
+    /**
+     * @brief Sets the block data at the given coordinates without creating a Block.
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @param data The new block data
+     * @param apply_physics False to cancel physics from the changed block
+     */
+    virtual Result<void> setBlockDataAt(int x, int y, int z, std::shared_ptr<BlockData> data, bool apply_physics) = 0;
+
+    /**
+     * @brief Reads a cuboid of blocks into a BlockVolume.
+     *
+     * This is much faster than calling getBlockAt for every block, as each distinct block data is only created once.
+     *
+     * @param x X-coordinate of the minimum corner
+     * @param y Y-coordinate of the minimum corner
+     * @param z Z-coordinate of the minimum corner
+     * @param width Size along the X axis
+     * @param height Size along the Y axis
+     * @param depth Size along the Z axis
+     * @return The blocks in the cuboid
+     */
+    virtual Result<BlockVolume> getBlocks(int x, int y, int z, int width, int height, int depth) = 0;
+
+    /**
+     * @brief Writes the blocks of a BlockVolume back to the dimension, at the coordinates of the volume.
+     *
+     * Blocks that already have the requested data are skipped.
+     *
+     * @param volume The blocks to write
+     * @param apply_physics False to cancel updates to the neighbouring blocks
+     * @return The number of blocks changed
+     */
+    virtual Result<std::size_t> setBlocks(const BlockVolume &volume, bool apply_physics) = 0;
+
+    /**
+     * @brief Fills a cuboid with the given block data.
+     *
+     * Blocks that already have the requested data are skipped.
+     *
+     * @param x X-coordinate of the minimum corner
+     * @param y Y-coordinate of the minimum corner
+     * @param z Z-coordinate of the minimum corner
+     * @param width Size along the X axis
+     * @param height Size along the Y axis
+     * @param depth Size along the Z axis
+     * @param data The block data to fill the cuboid with
+     * @param apply_physics False to cancel updates to the neighbouring blocks
+     * @return The number of blocks changed
+     */
+    virtual Result<std::size_t> fill(int x, int y, int z, int width, int height, int depth,
+                                     std::shared_ptr<BlockData> data, bool apply_physics) = 0;
+
+    /**
+     * @brief Applies all changes of a block transaction.
+     *
+     * The changes are written chunk by chunk. With physics applied, neighbour updates are only run on the blocks on
+     * the boundary of the edit and their neighbours outside of it, after every block has its final state. Blocks that
+     * already have the requested data are not written, but still take part in neighbour updates when on the boundary.
+     * Nothing is changed if any block of the transaction cannot be accessed.
+     *
+     * @param transaction The changes to apply
+     * @param apply_physics False to cancel updates to the neighbouring blocks
+     * @return The number of blocks changed
+     */
+    virtual Result<std::size_t> applyTransaction(const BlockTransaction &transaction, bool apply_physics) = 0;
+
+    /**
+     * @brief Captures an immutable copy of the blocks in a chunk.
+     *
+     * The snapshot can be handed to asynchronous tasks and read from any thread, while the chunk keeps changing. The
+     * chunk only needs to be loaded, not ticking.
+     *
+     * @param x X-coordinate of the chunk
+     * @param z Z-coordinate of the chunk
+     * @return The snapshot of the chunk
+     */
+    virtual Result<ChunkSnapshot> getChunkSnapshot(int x, int z) = 0;
+
+    /**
+     * @brief Starts loading, and generating if needed, every chunk in a rectangular area.
+     *
+     * The chunks are loaded by the server in the background, in batches. The number of batches loading at the same
+     * time is limited for the whole server, so that loading a large area does not stall the server. The returned task
+     * reports the progress and can be used to cancel the request.
+     *
+     * @param min_x X-coordinate of the minimum corner chunk
+     * @param min_z Z-coordinate of the minimum corner chunk
+     * @param max_x X-coordinate of the maximum corner chunk
+     * @param max_z Z-coordinate of the maximum corner chunk
+     * @return The task loading the chunks
+     */
+    virtual Result<std::shared_ptr<ChunkLoadTask>> loadChunksAsync(int min_x, int min_z, int max_x, int max_z) = 0;
+
+    /**
+     * @brief Gets the actors whose bounding box is within the given radius of a point.
+     *
+     * Only the chunks around the point are searched, so the cost depends on the number of actors nearby rather than
+     * the number of actors in the level.
+     *
+     * @param center The center of the search
+     * @param radius The radius of the search, between 0 and 256 blocks
+     * @param type The type of actors to get (e.g. minecraft:cow), or std::nullopt for all types
+     * @return The actors found, or an error if the center or the radius is invalid
+     */
+    [[nodiscard]] virtual Result<std::vector<Actor *>> getNearbyActors(const Vector<float> &center, float radius,
+                                                                       std::optional<std::string> type) = 0;
+
+    /**
+     * @brief Gets the actors whose bounding box intersects the given box.
+     *
+     * @param min The minimum corner of the box
+     * @param max The maximum corner of the box, at most 512 blocks away from the minimum corner on each axis
+     * @param type The type of actors to get (e.g. minecraft:cow), or std::nullopt for all types
+     * @return The actors found, or an error if the box is invalid or too large
+     */
+    [[nodiscard]] virtual Result<std::vector<Actor *>> getActorsInBox(const Vector<float> &min,
+                                                                      const Vector<float> &max,
+                                                                      std::optional<std::string> type) = 0;
+
+    /**
+     * @brief Gets the actors in a chunk.
+     *
+     * @param x X-coordinate of the chunk
+     * @param z Z-coordinate of the chunk
+     * @return The actors found
+     */
+    [[nodiscard]] virtual std::vector<Actor *> getActorsInChunk(int x, int z) = 0;
+
+    /**
+     * @brief Performs a ray trace that checks for collisions with blocks.
+     *
+     * Only the blocks crossed by the ray are read, and nothing is allocated on the way. Blocks without a collision
+     * shape, such as grass or flowers, are ignored. The ray stops at the first chunk that is not loaded, and once it
+     * has left the height range of the dimension.
+     *
+     * @param origin The origin of the ray
+     * @param direction The direction of the ray, does not need to be normalized
+     * @param max_distance The maximum distance to trace, clamped to 1024 blocks
+     * @param fluid_mode Whether the ray collides with fluids
+     * @return The closest block hit, or std::nullopt if no block was hit
+     */
+    [[nodiscard]] virtual Result<std::optional<BlockRayTraceResult>> rayTraceBlocks(const Vector<float> &origin,
+                                                                                    const Vector<float> &direction,
+                                                                                    float max_distance,
+                                                                                    FluidCollisionMode fluid_mode) = 0;
+
+    /**
+     * @brief Performs a ray trace that checks for collisions with the bounding boxes of actors.
+     *
+     * Blocks do not stop the ray, compare the distance with the result of rayTraceBlocks to check for obstacles.
+     *
+     * @param origin The origin of the ray
+     * @param direction The direction of the ray, does not need to be normalized
+     * @param max_distance The maximum distance to trace, clamped to 1024 blocks
+     * @param ray_size The amount by which the bounding boxes of the actors are grown
+     * @param exclude An actor to ignore, such as the actor the ray starts from, or nullptr
+     * @return The closest actor hit, or std::nullopt if no actor was hit
+     */
+    [[nodiscard]] virtual Result<std::optional<ActorRayTraceResult>> rayTraceActors(const Vector<float> &origin,
+                                                                                    const Vector<float> &direction,
+                                                                                    float max_distance, float ray_size,
+                                                                                    const Actor *exclude) = 0;
 };
 }  // namespace endstone
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -42,6 +43,15 @@ public:
      */
     [[nodiscard]] virtual std::vector<Actor *> getActors() const = 0;
 
+    /**
+     * @brief Gets a counter that changes whenever an actor is added to or removed from this level.
+     *
+     * Compare it with a previously seen value to find out whether a cached copy of getActors() is still valid.
+     *
+     * @return the version of the list of actors
+     */
+    [[nodiscard]] virtual std::uint64_t getActorsVersion() const = 0;
+
     /**
      * @brief Gets the relative in-game time of this level.
      *
@@ -0,0 +1,64 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "endstone/block/block_face.h"
+#include "endstone/util/vector.h"
+
+namespace endstone {
+
+class Actor;
+
+/**
+ * @brief The block hit by a ray trace.
+ */
+struct BlockRayTraceResult {
+    /**
+     * @brief The point where the ray hit the block.
+     */
+    Vector<float> position;
+    /**
+     * @brief The distance from the origin of the ray to the hit position.
+     */
+    float distance;
+    int x;
+    int y;
+    int z;
+    /**
+     * @brief The face of the block hit by the ray.
+     */
+    BlockFace face;
+};
+
+/**
+ * @brief The actor hit by a ray trace.
+ */
+struct ActorRayTraceResult {
+    /**
+     * @brief The point where the ray hit the bounding box of the actor.
+     */
+    Vector<float> position;
+    /**
+     * @brief The distance from the origin of the ray to the hit position.
+     */
+    float distance;
+    Actor *actor;
+    /**
+     * @brief The face of the bounding box hit by the ray.
+     */
+    BlockFace face;
+};
+
+}  // namespace endstone
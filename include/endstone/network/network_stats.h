@@ -0,0 +1,127 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace endstone {
+
+/**
+ * @brief Represents the network statistics of a connection, as measured by the transport layer.
+ */
+class NetworkStats {
+public:
+    NetworkStats() = default;
+    NetworkStats(std::uint64_t bytes_sent, std::uint64_t bytes_received, std::uint64_t bytes_resent,
+                 std::uint64_t packets_sent, std::uint64_t packets_received, std::uint64_t send_rate,
+                 std::uint64_t receive_rate, float packet_loss)
+        : bytes_sent_(bytes_sent), bytes_received_(bytes_received), bytes_resent_(bytes_resent),
+          packets_sent_(packets_sent), packets_received_(packets_received), send_rate_(send_rate),
+          receive_rate_(receive_rate), packet_loss_(packet_loss)
+    {
+    }
+
+    /**
+     * @brief Gets the total number of bytes sent, including protocol overhead and resends.
+     *
+     * @return The number of bytes sent.
+     */
+    [[nodiscard]] std::uint64_t getBytesSent() const
+    {
+        return bytes_sent_;
+    }
+
+    /**
+     * @brief Gets the total number of bytes received, including protocol overhead.
+     *
+     * @return The number of bytes received.
+     */
+    [[nodiscard]] std::uint64_t getBytesReceived() const
+    {
+        return bytes_received_;
+    }
+
+    /**
+     * @brief Gets the total number of bytes sent again because they were not acknowledged in time.
+     *
+     * @return The number of bytes resent.
+     */
+    [[nodiscard]] std::uint64_t getBytesResent() const
+    {
+        return bytes_resent_;
+    }
+
+    /**
+     * @brief Gets the total number of RakNet datagrams sent, including acknowledgements and resends.
+     *
+     * @return The number of datagrams sent.
+     */
+    [[nodiscard]] std::uint64_t getPacketsSent() const
+    {
+        return packets_sent_;
+    }
+
+    /**
+     * @brief Gets the total number of RakNet datagrams received, including acknowledgements.
+     *
+     * @return The number of datagrams received.
+     */
+    [[nodiscard]] std::uint64_t getPacketsReceived() const
+    {
+        return packets_received_;
+    }
+
+    /**
+     * @brief Gets the number of bytes sent over the last second.
+     *
+     * @return The send rate in bytes per second.
+     */
+    [[nodiscard]] std::uint64_t getSendRate() const
+    {
+        return send_rate_;
+    }
+
+    /**
+     * @brief Gets the number of bytes received over the last second.
+     *
+     * @return The receive rate in bytes per second.
+     */
+    [[nodiscard]] std::uint64_t getReceiveRate() const
+    {
+        return receive_rate_;
+    }
+
+    /**
+     * @brief Gets the ratio of packets lost over the last second.
+     *
+     * @return The packet loss, between 0 and 1.
+     */
+    [[nodiscard]] float getPacketLoss() const
+    {
+        return packet_loss_;
+    }
+
+private:
+    std::uint64_t bytes_sent_{0};
+    std::uint64_t bytes_received_{0};
+    std::uint64_t bytes_resent_{0};
+    std::uint64_t packets_sent_{0};
+    std::uint64_t packets_received_{0};
+    std::uint64_t send_rate_{0};
+    std::uint64_t receive_rate_{0};
+    float packet_loss_{0.0F};
+};
+
+}  // namespace endstone
@@ -0,0 +1,75 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace endstone {
+
+class Player;
+
+/**
+ * @brief Represents a read-only view of a game packet about to be sent to players.
+ *
+ * The payload is the body of the packet as encoded by the server, without the packet header, before it is batched and
+ * compressed. It is not copied and is only valid for the duration of the listener call.
+ */
+class OutboundPacket {
+public:
+    OutboundPacket(int id, std::span<const std::byte> payload, std::span<Player *const> recipients)
+        : id_(id), payload_(payload), recipients_(recipients)
+    {
+    }
+
+    /**
+     * @brief Gets the Minecraft packet ID of the packet.
+     *
+     * @return The packet ID.
+     */
+    [[nodiscard]] int getId() const
+    {
+        return id_;
+    }
+
+    /**
+     * @brief Gets the encoded body of the packet, without the packet header.
+     *
+     * @return The payload of the packet.
+     */
+    [[nodiscard]] std::span<const std::byte> getPayload() const
+    {
+        return payload_;
+    }
+
+    /**
+     * @brief Gets the players the packet is sent to.
+     *
+     * Recipients are only resolved on the server thread, the list is empty for packets sent from other threads.
+     *
+     * @return The recipients of the packet.
+     */
+    [[nodiscard]] std::span<Player *const> getRecipients() const
+    {
+        return recipients_;
+    }
+
+private:
+    int id_;
+    std::span<const std::byte> payload_;
+    std::span<Player *const> recipients_;
+};
+
+}  // namespace endstone
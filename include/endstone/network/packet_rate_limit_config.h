@@ -0,0 +1,63 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace endstone {
+
+/**
+ * @brief The limits applied to incoming RakNet datagrams before any packet is deserialized.
+ *
+ * Each remote address (IP and port) has a token bucket per kind of datagram. Datagrams are dropped when the bucket is
+ * empty, and peers that keep exceeding their limits are disconnected and blocked for a while.
+ */
+struct PacketRateLimitConfig {
+    /**
+     * @brief A token bucket, refilled at a constant rate up to its capacity.
+     */
+    struct Limit {
+        /**
+         * @brief The number of datagrams allowed per second.
+         */
+        double rate;
+        /**
+         * @brief The number of datagrams allowed in a burst.
+         */
+        double burst;
+    };
+
+    /**
+     * @brief Whether incoming datagrams are rate limited at all.
+     */
+    bool enabled{true};
+    Limit ping{5, 10};                        // unconnected pings, per peer
+    Limit connection{10, 20};                 // offline connection handshake, per peer
+    Limit datagram{2000, 4000};               // connected datagrams carrying game packets, per peer
+    Limit acknowledgement{2000, 4000};        // ACK and NAK, per peer
+    Limit other{10, 20};                      // any other datagram, per peer
+    Limit ping_per_host{20, 40};              // pings from one IP address, whatever the source port
+    Limit ping_total{10000, 20000};           // pings from all peers, bounds the bandwidth spent on pongs
+    Limit new_peers_per_prefix{100, 200};     // new peers tracked per /24 or /64 prefix
+    std::uint32_t block_threshold{10000};     // drops within one second before a peer is blocked
+    std::chrono::seconds block_duration{60};  // how long a blocked peer stays blocked
+    std::chrono::seconds idle_timeout{30};    // peers idle for longer than this are forgotten
+    std::size_t max_peers{65536};             // peers tracked at once, the least recently seen is evicted
+};
+
+}  // namespace endstone
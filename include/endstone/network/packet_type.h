@@ -19,6 +19,8 @@ namespace endstone {
  * @brief Represents the types of packets.
  */
 enum class PacketType {
+    PlaySound = 86,
+    SetTitle = 88,
     SpawnParticleEffect = 118
 };
 }  // namespace endstone
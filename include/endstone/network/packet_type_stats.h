@@ -0,0 +1,106 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace endstone {
+
+/**
+ * @brief Represents the game packets of one type exchanged with a connection.
+ *
+ * Sizes are those of the encoded packets, before they are batched and compressed.
+ */
+class PacketTypeStats {
+public:
+    PacketTypeStats(int id, std::string name, std::uint64_t packets_sent, std::uint64_t bytes_sent,
+                    std::uint64_t packets_received, std::uint64_t bytes_received)
+        : id_(id), name_(std::move(name)), packets_sent_(packets_sent), bytes_sent_(bytes_sent),
+          packets_received_(packets_received), bytes_received_(bytes_received)
+    {
+    }
+
+    /**
+     * @brief Gets the Minecraft packet ID of the packet type.
+     *
+     * @return The packet ID.
+     */
+    [[nodiscard]] int getId() const
+    {
+        return id_;
+    }
+
+    /**
+     * @brief Gets the name of the packet type, e.g. "MovePlayer".
+     *
+     * @return The name of the packet type.
+     */
+    [[nodiscard]] const std::string &getName() const
+    {
+        return name_;
+    }
+
+    /**
+     * @brief Gets the number of packets of this type sent.
+     *
+     * @return The number of packets sent.
+     */
+    [[nodiscard]] std::uint64_t getPacketsSent() const
+    {
+        return packets_sent_;
+    }
+
+    /**
+     * @brief Gets the number of bytes of the packets of this type sent.
+     *
+     * @return The number of bytes sent.
+     */
+    [[nodiscard]] std::uint64_t getBytesSent() const
+    {
+        return bytes_sent_;
+    }
+
+    /**
+     * @brief Gets the number of packets of this type received.
+     *
+     * @return The number of packets received.
+     */
+    [[nodiscard]] std::uint64_t getPacketsReceived() const
+    {
+        return packets_received_;
+    }
+
+    /**
+     * @brief Gets the number of bytes of the packets of this type received.
+     *
+     * @return The number of bytes received.
+     */
+    [[nodiscard]] std::uint64_t getBytesReceived() const
+    {
+        return bytes_received_;
+    }
+
+private:
+    int id_;
+    std::string name_;
+    std::uint64_t packets_sent_;
+    std::uint64_t bytes_sent_;
+    std::uint64_t packets_received_;
+    std::uint64_t bytes_received_;
+};
+
+}  // namespace endstone
@@ -0,0 +1,53 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "endstone/network/packet.h"
+#include "endstone/network/packet_type.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a packet for displaying titles, subtitles and action bars on the client.
+ */
+class SetTitlePacket final : public Packet {
+public:
+    enum class Type {
+        Clear = 0,
+        Reset = 1,
+        Title = 2,
+        Subtitle = 3,
+        Actionbar = 4,
+        Times = 5,
+    };
+
+    [[nodiscard]] PacketType getType() const override
+    {
+        return PacketType::SetTitle;
+    }
+
+    Type type{Type::Title};
+    std::string text;
+    int fade_in_time{10};
+    int stay_time{70};
+    int fade_out_time{20};
+    std::string xuid;
+    std::string platform_online_id;
+    std::string filtered_text;
+};
+
+}  // namespace endstone
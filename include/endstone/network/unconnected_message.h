@@ -0,0 +1,104 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "endstone/util/socket_address.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents an unconnected RakNet message about to be sent over the network, e.g. an unconnected pong.
+ *
+ * Unconnected messages are sent outside of any connection, so their payload is the raw datagram handed to the socket.
+ * Its first byte is the RakNet message ID (e.g. 0x1c for ID_UNCONNECTED_PONG).
+ *
+ * The payload is not copied, it is only valid for the duration of the listener call. Listeners may replace the
+ * payload with setPayload.
+ */
+class UnconnectedMessage {
+public:
+    UnconnectedMessage(std::span<const std::byte> payload, SocketAddress address)
+        : payload_(payload), address_(std::move(address))
+    {
+    }
+
+    /**
+     * @brief Gets the RakNet message ID of the message, i.e. the first byte of the payload.
+     *
+     * @return The RakNet message ID of the message.
+     */
+    [[nodiscard]] std::uint8_t getId() const
+    {
+        const auto payload = getPayload();
+        return payload.empty() ? 0 : static_cast<std::uint8_t>(payload[0]);
+    }
+
+    /**
+     * @brief Gets the payload of the message, including the RakNet message ID.
+     *
+     * @return The payload of the message.
+     */
+    [[nodiscard]] std::span<const std::byte> getPayload() const
+    {
+        if (replacement_.has_value()) {
+            return replacement_.value();
+        }
+        return payload_;
+    }
+
+    /**
+     * @brief Replaces the payload of the message, including the RakNet message ID.
+     *
+     * @param payload The new payload.
+     */
+    void setPayload(std::vector<std::byte> payload)
+    {
+        replacement_ = std::move(payload);
+    }
+
+    /**
+     * @brief Checks if the payload has been replaced.
+     *
+     * @return true if the payload has been replaced, false otherwise.
+     */
+    [[nodiscard]] bool isModified() const
+    {
+        return replacement_.has_value();
+    }
+
+    /**
+     * @brief Gets the address the message is sent to.
+     *
+     * @return The address of the recipient.
+     */
+    [[nodiscard]] const SocketAddress &getAddress() const
+    {
+        return address_;
+    }
+
+private:
+    std::span<const std::byte> payload_;
+    SocketAddress address_;
+    std::optional<std::vector<std::byte>> replacement_;
+};
+
+}  // namespace endstone
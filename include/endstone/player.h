@@ -23,6 +23,8 @@
 #include "endstone/form/modal_form.h"
 #include "endstone/game_mode.h"
 #include "endstone/inventory/player_inventory.h"
+#include "endstone/network/network_stats.h"
+#include "endstone/network/packet_type_stats.h"
 #include "endstone/network/spawn_particle_effect_packet.h"
 #include "endstone/scoreboard/scoreboard.h"
 #include "endstone/skin.h"
@@ -295,6 +297,49 @@ public:
      */
     [[nodiscard]] virtual std::chrono::milliseconds getPing() const = 0;
 
+    /**
+     * @brief Gets the network statistics of the player's connection.
+     *
+     * @return The network statistics of the player.
+     */
+    [[nodiscard]] virtual NetworkStats getNetworkStats() const = 0;
+
+    /**
+     * @brief Gets the game packets exchanged with the player per packet type since the player joined.
+     *
+     * Only the packet types that have been sent or received at least once are included.
+     *
+     * @return The statistics of each packet type.
+     */
+    [[nodiscard]] virtual std::vector<PacketTypeStats> getPacketTypeStats() const = 0;
+
+    /**
+     * @brief Limits the chunks sent to the player per tick.
+     *
+     * Once the budget of a tick is spent, the chunk requests of the player wait for the next ticks and are then
+     * answered starting with the nearest chunks in front of the player. This spreads the chunk traffic of players
+     * joining or flying fast over time. The budget is unlimited by default.
+     *
+     * @param chunks_per_tick the number of sub-chunks sent per tick, or 0 for unlimited
+     * @param bytes_per_tick the number of bytes of chunk data sent per tick, or 0 for unlimited
+     * @return an error if a limit is negative
+     */
+    virtual Result<void> setChunkSendRate(int chunks_per_tick, int bytes_per_tick) = 0;
+
+    /**
+     * @brief Gets the number of sub-chunks sent to the player per tick.
+     *
+     * @return The number of sub-chunks per tick, or 0 if unlimited.
+     */
+    [[nodiscard]] virtual int getChunksPerTick() const = 0;
+
+    /**
+     * @brief Gets the number of bytes of chunk data sent to the player per tick.
+     *
+     * @return The number of bytes per tick, or 0 if unlimited.
+     */
+    [[nodiscard]] virtual int getChunkBytesPerTick() const = 0;
+
     /**
      * @brief Send the list of commands to the client.
      *
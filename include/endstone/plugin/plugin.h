@@ -237,11 +237,19 @@ public:
         return *this;
     }
 
+    CommandBuilder &async(bool async = true)
+    {
+        async_ = async;
+        return *this;
+    }
+
     [[nodiscard]] Command build() const
     {
-        return Command(name_, description_, std::vector<std::string>(usages_.begin(), usages_.end()),
-                       std::vector<std::string>(aliases_.begin(), aliases_.end()),
-                       std::vector<std::string>(permissions_.begin(), permissions_.end()));
+        auto command = Command(name_, description_, std::vector<std::string>(usages_.begin(), usages_.end()),
+                               std::vector<std::string>(aliases_.begin(), aliases_.end()),
+                               std::vector<std::string>(permissions_.begin(), permissions_.end()));
+        command.setAsync(async_);
+        return command;
     }
 
 private:
@@ -250,6 +258,7 @@ private:
     std::set<std::string> usages_;
     std::set<std::string> aliases_;
     std::set<std::string> permissions_;
+    bool async_ = false;
 };
 
 class PermissionBuilder {
@@ -15,7 +15,10 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -27,6 +30,11 @@
 #include "endstone/lang/language.h"
 #include "endstone/level/level.h"
 #include "endstone/logger.h"
+#include "endstone/network/network_stats.h"
+#include "endstone/network/outbound_packet.h"
+#include "endstone/network/packet_rate_limit_config.h"
+#include "endstone/network/packet_type_stats.h"
+#include "endstone/network/unconnected_message.h"
 #include "endstone/player.h"
 #include "endstone/scoreboard/scoreboard.h"
 #include "endstone/util/result.h"
@@ -37,6 +45,7 @@ namespace endstone {
 class ConsoleCommandSender;
 class Scheduler;
 class PluginCommand;
+class Plugin;
 class PluginManager;
 
 /**
@@ -116,6 +125,19 @@ public:
      */
     [[nodiscard]] virtual bool dispatchCommand(CommandSender &sender, std::string command_line) const = 0;
 
+    /**
+     * @brief Dispatches multiple commands on this server in a batch, and executes them if found.
+     *
+     * This is considerably faster than calling dispatchCommand repeatedly for bulk operations, as the command context
+     * of the sender is only resolved once for the whole batch.
+     *
+     * @param sender the apparent sender of the commands
+     * @param command_lines the commands + arguments.
+     * @return the execution result of each command, in the same order as the given command lines
+     */
+    [[nodiscard]] virtual std::vector<bool> dispatchCommands(CommandSender &sender,
+                                                             std::span<const std::string> command_lines) const = 0;
+
     /**
      * @brief Gets the scheduler for managing scheduled events.
      *
@@ -137,6 +159,15 @@ public:
      */
     [[nodiscard]] virtual std::vector<Player *> getOnlinePlayers() const = 0;
 
+    /**
+     * @brief Gets a counter that changes whenever a player joins or quits.
+     *
+     * Compare it with a previously seen value to find out whether a cached copy of getOnlinePlayers() is still valid.
+     *
+     * @return the version of the list of online players
+     */
+    [[nodiscard]] virtual std::uint64_t getOnlinePlayersVersion() const = 0;
+
     /**
      * @brief Get the maximum amount of players which can login to this server.
      *
@@ -174,6 +205,14 @@ public:
      */
     [[nodiscard]] virtual Player *getPlayer(std::string name) const = 0;
 
+    /**
+     * @brief Gets the player with the given Xbox User ID (XUID).
+     *
+     * @param xuid XUID of the player to retrieve
+     * @return a player object if one was found, null otherwise
+     */
+    [[nodiscard]] virtual Player *getPlayerByXuid(std::string xuid) const = 0;
+
     /**
      * @brief Shutdowns the server, stopping everything.
      */
@@ -206,6 +245,136 @@ public:
      */
     virtual void broadcastMessage(const Message &message) const = 0;
 
+    /**
+     * @brief Sends a packet to multiple players at once.
+     *
+     * The packet is only encoded once and the same payload is sent to each recipient, which is considerably faster than
+     * calling Player::sendPacket for each of them.
+     *
+     * @param packet the packet to send
+     * @param recipients the players to receive the packet
+     */
+    virtual void broadcastPacket(Packet &packet, const std::vector<Player *> &recipients) const = 0;
+
+    /**
+     * @brief Registers a listener for the game packets with the given Minecraft packet ID sent to players.
+     *
+     * Listeners are called when the server encodes the packet for sending, with a read-only view of its body and the
+     * players it is sent to. A packet sent to several players at once is encoded and dispatched once. Listeners are
+     * called on the thread sending the packet and must be thread-safe. They are unregistered automatically when the
+     * plugin is disabled.
+     *
+     * @param plugin the plugin registering the listener
+     * @param packet_id the Minecraft packet ID of the packets to listen for
+     * @param listener the listener to call for each matching packet
+     * @return an error if the plugin is not enabled or the packet ID is out of range
+     */
+    virtual Result<void> registerPacketListener(Plugin &plugin, int packet_id,
+                                                std::function<void(const OutboundPacket &)> listener) = 0;
+
+    /**
+     * @brief Registers a listener for the unconnected RakNet messages with the given message ID sent by the server.
+     *
+     * The ID is the first byte of the message, e.g. 0x1c for ID_UNCONNECTED_PONG. Listeners may inspect the payload
+     * of the message or replace it. Listeners are called on the network threads and must be thread-safe. They are
+     * unregistered automatically when the plugin is disabled.
+     *
+     * @param plugin the plugin registering the listener
+     * @param message_id the RakNet message ID of the messages to listen for, below 0x80
+     * @param listener the listener to call for each matching message
+     * @return an error if the plugin is not enabled or the message ID is not the one of an unconnected message
+     */
+    virtual Result<void> registerUnconnectedMessageListener(Plugin &plugin, std::uint8_t message_id,
+                                                            std::function<void(UnconnectedMessage &)> listener) = 0;
+
+    /**
+     * @brief Unregisters all packet listeners registered by a plugin.
+     *
+     * @param plugin the plugin whose listeners to unregister
+     */
+    virtual void unregisterPacketListeners(Plugin &plugin) = 0;
+
+    /**
+     * @brief Gets the network statistics of the server.
+     *
+     * Bytes and datagrams are running totals since the server started, counting every connection including the ones
+     * that have closed and unconnected traffic such as pings. Rates and packet loss cover the online players.
+     *
+     * @return the network statistics of the server
+     */
+    [[nodiscard]] virtual NetworkStats getNetworkStats() const = 0;
+
+    /**
+     * @brief Gets the game packets exchanged with all players per packet type since the server started.
+     *
+     * Only the packet types that have been sent or received at least once are included.
+     *
+     * @return The statistics of each packet type.
+     */
+    [[nodiscard]] virtual std::vector<PacketTypeStats> getPacketTypeStats() const = 0;
+
+    /**
+     * @brief Gets the limits applied to incoming RakNet datagrams.
+     *
+     * @return the current limits
+     */
+    [[nodiscard]] virtual PacketRateLimitConfig getPacketRateLimit() const = 0;
+
+    /**
+     * @brief Sets the limits applied to incoming RakNet datagrams, or disables the rate limiting.
+     *
+     * The limits apply immediately to every connection, including the ones already open.
+     *
+     * @param config the new limits
+     * @return an error if a limit is negative or not finite, a burst is below 1, or a threshold or size is zero
+     */
+    virtual Result<void> setPacketRateLimit(const PacketRateLimitConfig &config) = 0;
+
+    /**
+     * @brief Gets how long the server info rendered by ServerListPingEvent is reused for later pings.
+     *
+     * @return the time to live of the cached server info, zero if the cache is disabled
+     */
+    [[nodiscard]] virtual std::chrono::milliseconds getServerListPingCacheTtl() const = 0;
+
+    /**
+     * @brief Sets how long the server info rendered by ServerListPingEvent is reused for later pings.
+     *
+     * While the server info is cached, ServerListPingEvent is not fired and every remote address gets the answer
+     * rendered for the first one. The server info is rendered again as soon as the server info reported by the game
+     * changes, e.g. when a player joins. A time to live of zero, the default, fires the event for every ping.
+     *
+     * @param ttl the time to live of the cached server info
+     * @return an error if the time to live is negative
+     */
+    virtual Result<void> setServerListPingCacheTtl(std::chrono::milliseconds ttl) = 0;
+
+    /**
+     * @brief Discards the cached server info, so that ServerListPingEvent is fired for the next ping.
+     *
+     * Plugins that change how they answer ServerListPingEvent, e.g. to show a new message, should call this so that
+     * the change is visible before the cache expires.
+     */
+    virtual void invalidateServerListPing() = 0;
+
+    /**
+     * @brief Checks whether unconnected pings are answered from the cached server info on the network thread.
+     *
+     * @return true if pings are answered from the cache
+     */
+    [[nodiscard]] virtual bool isServerListPingReplyEnabled() const = 0;
+
+    /**
+     * @brief Sets whether unconnected pings are answered from the cached server info on the network thread.
+     *
+     * While the cache is enabled with setServerListPingCacheTtl and fresh, pings are answered as soon as they are
+     * received, without waiting for RakNet and without any allocation, which keeps floods of pings away from the
+     * server. Pings are always left to RakNet while the cache is disabled or has expired. Enabled by default.
+     *
+     * @param enabled whether to answer pings from the cache
+     */
+    virtual void setServerListPingReplyEnabled(bool enabled) = 0;
+
     template <typename... Args>
     void broadcastMessage(const fmt::format_string<Args...> format, Args &&...args) const
     {
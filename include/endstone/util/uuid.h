@@ -17,8 +17,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <string>
 
+#include "endstone/detail/hash.h"
+
 namespace endstone {
 
 /**
@@ -146,7 +149,7 @@ inline std::size_t hash_value(UUID const &u) noexcept
 {
     std::size_t seed = 0;
     for (unsigned char i : u) {
-        seed ^= static_cast<std::size_t>(i) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        detail::hash_combine(seed, static_cast<std::size_t>(i));
     }
 
     return seed;
@@ -0,0 +1,132 @@
+"""
+Synthetic RakNet flood generator for testing the packet rate limiter on localhost.
+
+Example:
+    python scripts/udp_flood.py --port 19132 --kind ping --rate 50000 --duration 10 --sockets 4
+
+Pass --spoof to send from many loopback addresses (127.0.0.1, 127.0.0.2, ...) instead of many ports of one address, to
+simulate a flood from many hosts. This only works when the server listens on localhost.
+
+Pass --replies to count the datagrams sent back by the server, e.g. to measure how many unconnected pongs per second
+the server can answer. Raise the ping limits of the rate limiter first, it also applies to localhost.
+
+Pass --pid with the process ID of the server to check that the flood does not leak memory. The resident set size of the
+server is sampled before and after the flood, and the script exits with status 1 when it grew by more than
+--max-rss-growth MiB (Linux only). For example, a flood of rejected datagrams should leave the memory flat:
+
+    python scripts/udp_flood.py --kind datagram --rate 0 --duration 60 --sockets 64 --spoof --pid 1234
+
+Only use this against servers you own.
+"""
+
+import argparse
+import os
+import socket
+import struct
+import sys
+import time
+
+OFFLINE_MESSAGE_ID = bytes.fromhex("00ffff00fefefefefdfdfdfd12345678")
+
+
+def make_payload(kind: str) -> bytes:
+    """Build a single datagram of the given kind."""
+    if kind == "ping":
+        # ID_UNCONNECTED_PING, time, offline message ID, client GUID
+        return b"\x01" + struct.pack(">q", int(time.time() * 1000)) + OFFLINE_MESSAGE_ID + os.urandom(8)
+    if kind == "connect":
+        # ID_OPEN_CONNECTION_REQUEST_1, offline message ID, protocol version, MTU padding
+        return b"\x05" + OFFLINE_MESSAGE_ID + b"\x0b" + bytes(1400)
+    if kind == "datagram":
+        # a valid datagram header followed by garbage, as sent by a misbehaving connected peer
+        return b"\x84" + os.urandom(64)
+    raise ValueError(f"Unknown kind: {kind}")
+
+
+def loopback_address(index: int) -> str:
+    """Return the index-th address of 127.0.0.0/8, starting at 127.0.0.1."""
+    index += 1
+    return f"127.{(index >> 16) & 0xFF}.{(index >> 8) & 0xFF}.{index & 0xFF}"
+
+
+def drain(sockets) -> int:
+    """Receive all pending datagrams and return how many there were."""
+    count = 0
+    for sock in sockets:
+        while True:
+            try:
+                sock.recv(4096)
+                count += 1
+            except (BlockingIOError, ConnectionResetError):
+                break
+    return count
+
+
+def resident_set_size(pid: int) -> int:
+    """Return the resident set size of a process in KiB."""
+    with open(f"/proc/{pid}/status") as f:
+        for line in f:
+            if line.startswith("VmRSS:"):
+                return int(line.split()[1])
+    raise RuntimeError(f"Unable to read the resident set size of process {pid}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flood a local RakNet server with datagrams.")
+    parser.add_argument("--host", default="127.0.0.1", help="address of the server")
+    parser.add_argument("--port", type=int, default=19132, help="port of the server")
+    parser.add_argument("--kind", choices=["ping", "connect", "datagram"], default="ping", help="datagrams to send")
+    parser.add_argument("--rate", type=int, default=10000, help="datagrams per second, 0 for unlimited")
+    parser.add_argument("--duration", type=float, default=10.0, help="duration in seconds")
+    parser.add_argument("--sockets", type=int, default=1, help="number of source ports to spread the flood over")
+    parser.add_argument("--spoof", action="store_true", help="bind each socket to a different loopback address")
+    parser.add_argument("--replies", action="store_true", help="count the datagrams sent back by the server")
+    parser.add_argument("--pid", type=int, help="process ID of the server, to check its memory usage")
+    parser.add_argument("--max-rss-growth", type=float, default=16.0, help="allowed memory growth in MiB with --pid")
+    args = parser.parse_args()
+
+    sockets = [socket.socket(socket.AF_INET, socket.SOCK_DGRAM) for _ in range(args.sockets)]
+    for i, sock in enumerate(sockets):
+        sock.setblocking(False)
+        if args.spoof:
+            sock.bind((loopback_address(i), 0))
+    payload = make_payload(args.kind)
+    target = (args.host, args.port)
+
+    rss_before = resident_set_size(args.pid) if args.pid else 0
+    sent = 0
+    received = 0
+    start = time.perf_counter()
+    deadline = start + args.duration
+    while (now := time.perf_counter()) < deadline:
+        if args.rate and sent >= args.rate * (now - start):
+            if args.replies:
+                received += drain(sockets)
+            time.sleep(0.0005)
+            continue
+        if args.replies and sent % 1024 == 0:
+            received += drain(sockets)
+        try:
+            sockets[sent % len(sockets)].sendto(payload, target)
+            sent += 1
+        except BlockingIOError:
+            pass
+
+    elapsed = time.perf_counter() - start
+    print(f"Sent {sent} {args.kind} datagrams in {elapsed:.2f}s ({sent / elapsed:.0f}/s) from {len(sockets)} sockets")
+    if args.replies:
+        time.sleep(0.5)
+        received += drain(sockets)
+        print(f"Received {received} replies ({received / elapsed:.0f}/s)")
+    if args.pid:
+        # give the server time to process the datagrams still queued
+        time.sleep(2.0)
+        growth = (resident_set_size(args.pid) - rss_before) / 1024
+        print(f"Resident set size of the server grew by {growth:.1f} MiB")
+        if growth > args.max_rss_growth:
+            print(f"Memory grew by more than {args.max_rss_growth} MiB, datagrams may be leaking")
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
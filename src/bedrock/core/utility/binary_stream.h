@@ -21,6 +21,16 @@ public:
     virtual ~ReadOnlyBinaryStream();
     virtual Bedrock::Result<void> read(void *, std::uint64_t);
 
+    [[nodiscard]] std::size_t getUnreadLength() const
+    {
+        return view_.size() - read_pointer_;
+    }
+
+    [[nodiscard]] std::string_view getView() const  // Endstone
+    {
+        return view_;
+    }
+
 protected:
     std::string owned_buffer_;  // +8
     std::string_view view_;     // +40
@@ -44,6 +54,11 @@ public:
     void writeFloat(float value);
     void writeString(std::string_view value);
 
+    [[nodiscard]] const std::string &getBuffer() const  // Endstone
+    {
+        return *buffer_;
+    }
+
 private:
     void write(const void *data, std::size_t size);
     std::string *buffer_;  // +72
@@ -15,5 +15,6 @@
 #pragma once
 
 enum MessageIdentifiers : unsigned char {
+    UnconnectedPing = 1,
     UnconnectedPong = 28
 };
@@ -16,6 +16,7 @@
 
 #include <memory>
 
+#include "bedrock/deps/raknet/packet_priority.h"
 #include "bedrock/deps/raknet/raknet_socket2.h"
 #include "bedrock/deps/raknet/raknet_types.h"
 
@@ -26,12 +27,11 @@ class Packet;
 struct PublicKey;
 class RakNetSocket2;
 class ShadowBanList;
-class RakNetStatistics;
+struct RakNetStatistics;
 class SocketDescriptor;
 class PluginInterface2;
 enum class ConnectionAttemptResult;
 enum class ConnectionState;
-enum class PacketPriority;
 enum class PacketReliability;
 
 namespace DataStructures {
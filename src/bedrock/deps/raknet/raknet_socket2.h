@@ -88,6 +88,11 @@ class RakNetSocket2 : std::enable_shared_from_this<RakNetSocket2> {
 public:
     virtual ~RakNetSocket2() = 0;
 
+    [[nodiscard]] RNS2EventHandler *GetEventHandler() const  // NOLINT
+    {
+        return event_handler_;
+    }
+
 protected:
     RNS2EventHandler *event_handler_;            // +24
     RNS2Type socket_type_;                       // +32
@@ -105,6 +110,11 @@ class RNS2_Berkley : public IRNS2_Berkley {  // NOLINT
 public:
     virtual ~RNS2_Berkley() override = 0;
 
+    [[nodiscard]] RNS2Socket GetSocket() const  // NOLINT
+    {
+        return rns2_socket_;
+    }
+
 protected:
     RNS2Socket rns2_socket_;                                    // +184 (+180)
     RNS2_BerkleyBindParameters binding_;                        // +192 (+184)
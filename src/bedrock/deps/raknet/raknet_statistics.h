@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "bedrock/deps/raknet/packet_priority.h"
+#include "bedrock/deps/raknet/raknet_types.h"
+
+/**
+ * https://github.com/facebookarchive/RakNet/blob/master/Source/RakNetStatistics.h
+ */
+
+namespace RakNet {
+
+enum RNSPerSecondMetrics {
+    // NOLINTBEGIN
+    USER_MESSAGE_BYTES_PUSHED,
+    USER_MESSAGE_BYTES_SENT,
+    USER_MESSAGE_BYTES_RESENT,
+    USER_MESSAGE_BYTES_RECEIVED_PROCESSED,
+    USER_MESSAGE_BYTES_RECEIVED_IGNORED,
+    ACTUAL_BYTES_SENT,
+    ACTUAL_BYTES_RECEIVED,
+    RNS_PER_SECOND_METRICS_COUNT
+    // NOLINTEND
+};
+
+struct RakNetStatistics {
+    std::uint64_t value_over_last_second[RNS_PER_SECOND_METRICS_COUNT];
+    std::uint64_t running_total[RNS_PER_SECOND_METRICS_COUNT];
+    RakNet::TimeUS connection_start_time;
+    bool is_limited_by_congestion_control;
+    std::uint64_t bps_limit_by_congestion_control;
+    bool is_limited_by_outgoing_bandwidth_limit;
+    std::uint64_t bps_limit_by_outgoing_bandwidth_limit;
+    unsigned int message_in_send_buffer[static_cast<int>(PacketPriority::NUMBER_OF_PRIORITIES)];
+    double bytes_in_send_buffer[static_cast<int>(PacketPriority::NUMBER_OF_PRIORITIES)];
+    unsigned int messages_in_resend_buffer;
+    std::uint64_t bytes_in_resend_buffer;
+    float packetloss_last_second;
+    float packetloss_total;
+};
+
+}  // namespace RakNet
@@ -257,6 +257,16 @@ public:
     // [[nodiscard]] virtual bool disallowBatching() const = 0;
     // [[nodiscard]] virtual bool isValid() const = 0;
 
+    [[nodiscard]] SubClientId getClientSubId() const  // Endstone
+    {
+        return client_sub_id_;
+    }
+
+    [[nodiscard]] const void *getHandler() const  // Endstone
+    {
+        return handler_;
+    }
+
 private:
     // [[nodiscard]] virtual Bedrock::Result<void> _read(ReadOnlyBinaryStream &) = 0;
 
@@ -80,6 +80,14 @@ const std::vector<CommandOutputMessage> &CommandOutput::getMessages() const
     return messages_;
 }
 
+void CommandOutput::reset()
+{
+    data_.reset();
+    messages_.clear();
+    success_count_ = 0;
+    has_player_text_ = false;
+}
+
 void CommandOutput::addMessage(const std::string &message_id, const std::vector<CommandOutputParameter> &params,
                                CommandOutputMessageType type)
 {
@@ -67,6 +67,7 @@ public:
     void error(const std::string &message_id, const std::vector<CommandOutputParameter> &params);
     [[nodiscard]] int getSuccessCount() const;
     [[nodiscard]] const std::vector<CommandOutputMessage> &getMessages() const;
+    void reset();  // used by Endstone
 
 private:
     void addMessage(const std::string &message_id, const std::vector<CommandOutputParameter> &params,
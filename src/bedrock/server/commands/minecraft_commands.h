@@ -35,6 +35,10 @@ public:
     }
 
     ENDSTONE_HOOK MCRESULT executeCommand(CommandContext &ctx, bool suppress_output) const;
+
+    // Returns a command owned by this instance, or nullptr if the command line fails to parse. Compiled commands are
+    // kept in a map of this instance keyed by the command line (not declared here) and are never erased from it, so
+    // the pointer stays valid until this instance is destroyed. Do not delete it.
     Command *compileCommand(HashedString const &command_str, CommandOrigin &origin,
                                           CurrentCmdVersion command_version,
                                           std::function<void(const std::string &)> on_parser_error);
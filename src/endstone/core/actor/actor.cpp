@@ -31,6 +31,14 @@ EndstoneActor::EndstoneActor(EndstoneServer &server, ::Actor &actor) : server_(s
     getPermissibleBase();
 }
 
+EndstoneActor::~EndstoneActor()
+{
+    // Actors can leave the level without being removed, e.g. when the chunk they are in is unloaded
+    if (auto *level = static_cast<EndstoneLevel *>(server_.getLevel()); level) {
+        level->removeActor(*this);
+    }
+}
+
 void EndstoneActor::sendMessage(const Message &message) const {}
 
 void EndstoneActor::sendErrorMessage(const Message &message) const {}
@@ -34,6 +34,8 @@ protected:
     EndstoneActor(EndstoneServer &server, ::Actor &actor);
 
 public:
+    ~EndstoneActor() override;
+
     // CommandSender
     void sendMessage(const Message &message) const override;
     void sendErrorMessage(const Message &message) const override;
@@ -14,10 +14,17 @@
 
 #pragma once
 
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <list>
+#include <memory>
+#include <queue>
 #include <sstream>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <date/date.h>
 #include <fmt/format.h>
@@ -25,6 +32,8 @@
 #include <nlohmann/json.hpp>
 
 #include "endstone/ban/ip_ban_list.h"
+#include "endstone/core/scheduler/serial_executor.h"
+#include "endstone/core/util/durable_file.h"
 #include "endstone/core/util/error.h"
 #include "endstone/util/result.h"
 
@@ -32,41 +41,45 @@ namespace fs = std::filesystem;
 
 namespace endstone::core {
 
+/**
+ * Base implementation of a ban list persisted to a JSON file.
+ *
+ * Entries are indexed by the key returned by Matcher::key (e.g. the lowercased player name), so lookups only need to
+ * test the few entries that share the same key instead of scanning the whole list. Entries with an expiration date are
+ * tracked in a min-heap so expired entries can be removed without visiting the ones that are still valid.
+ *
+ * Changes are appended to a journal file next to the ban list by a writer thread, which may be shared with other ban
+ * lists. Each record is synced to disk before the next one is written. The ban list file itself is only rewritten once
+ * the journal grows large enough, or when save() is called explicitly.
+ */
 template <typename T, typename Matcher>
 class EndstoneBanList : public BanList<T> {
 public:
-    explicit EndstoneBanList(fs::path file) : file_(std::move(file)){};
+    explicit EndstoneBanList(fs::path file, std::shared_ptr<SerialExecutor> writer = std::make_shared<SerialExecutor>())
+        : file_(std::move(file)), journal_file_(fs::path(file_).concat(".journal")), writer_(std::move(writer))
+    {
+    }
 
-    ~EndstoneBanList() override = default;
+    ~EndstoneBanList() override
+    {
+        // the writer may outlive this list, so wait for the writes that still reference it
+        writer_->submit([]() {}).get();
+    }
 
     [[nodiscard]] const T *getBanEntry(std::string target) const override
     {
-        const auto it =
-            std::find_if(entries_.begin(), entries_.end(), [&](const T &entry) { return matcher_(entry, target); });
-
-        if (it != entries_.end()) {
-            return &(*it);
-        }
-        return nullptr;
+        return findIf(target, [&](const T &entry) { return matcher_(entry, target); });
     }
 
     [[nodiscard]] T *getBanEntry(std::string target) override
     {
-        const auto it =
-            std::find_if(entries_.begin(), entries_.end(), [&](T &entry) { return matcher_(entry, target); });
-
-        if (it != entries_.end()) {
-            return &(*it);
-        }
-        return nullptr;
+        return findIf(target, [&](const T &entry) { return matcher_(entry, target); });
     }
 
     T &addBan(std::string target, std::optional<std::string> reason, std::optional<BanEntry::Date> expires,
               std::optional<std::string> source) override
     {
-        entries_.erase(
-            std::remove_if(entries_.begin(), entries_.end(), [&](T &entry) { return matcher_(entry, target); }),
-            entries_.end());
+        eraseIf(target, [&](const T &entry) { return matcher_(entry, target); });
 
         T new_entry{target};
         if (reason.has_value()) {
@@ -76,8 +89,8 @@ public:
         if (source.has_value()) {
             new_entry.setSource(source.value());
         }
-        auto &entry = entries_.emplace_back(new_entry);
-        save();
+        auto &entry = insert(std::move(new_entry));
+        journal(target);
 
         return entry;
     }
@@ -110,119 +123,351 @@ public:
 
     [[nodiscard]] bool isBanned(std::string target) const override
     {
-        const_cast<EndstoneBanList *>(this)->removeExpired();
-        return getBanEntry(target) != nullptr;
+        return const_cast<EndstoneBanList *>(this)->isBannedIf(
+            target, [&](const T &entry) { return matcher_(entry, target); });
     }
 
     void removeBan(std::string target) override
     {
-        const auto it =
-            std::find_if(entries_.begin(), entries_.end(), [&](T &entry) { return matcher_(entry, target); });
-        if (it != entries_.end()) {
-            entries_.erase(it);
-            save();
+        if (eraseIf(target, [&](const T &entry) { return matcher_(entry, target); })) {
+            journal(target);
         }
     }
 
+    /**
+     * Writes a snapshot of the ban list to the file and clears the journal. Blocks until all pending writes are done.
+     */
     Result<void> save()
     {
-        nlohmann::json array = nlohmann::json::array();
-        for (const auto &entry : entries_) {
-            nlohmann::json json = entry;
-            json["created"] = date::format(BanEntry::DateFormat, date::floor<std::chrono::seconds>(entry.getCreated()));
-            json["source"] = entry.getSource();
-            if (entry.getExpiration().has_value()) {
-                json["expires"] = date::format(BanEntry::DateFormat,
-                                               date::floor<std::chrono::seconds>(entry.getExpiration().value()));
+        return writer_->submit([this, snapshot = std::vector<T>(entries_.begin(), entries_.end())]() {
+                          return writeSnapshot(snapshot);
+                      })
+            .get();
+    }
+
+    /**
+     * Loads the ban list from the file, then replays the changes recorded in the journal since the last snapshot.
+     */
+    Result<void> load()
+    {
+        // make sure everything queued so far has reached the disk
+        writer_->submit([]() {}).get();
+
+        if (!exists(file_) && !exists(journal_file_)) {
+            return {};
+        }
+
+        clear();
+        journal_size_ = 0;
+
+        if (exists(file_)) {
+            std::ifstream file(file_);
+            if (!file) {
+                return nonstd::make_unexpected(make_error("Unable to open file '{}'.", file_));
             }
-            else {
-                json["expires"] = "forever";
+
+            try {
+                // Entries are loaded one by one and discarded as soon as they are parsed, so the whole document never
+                // has to be held in memory.
+                nlohmann::json::parse(file, [&](int depth, nlohmann::json::parse_event_t event, nlohmann::json &json) {
+                    if (depth == 1 && event == nlohmann::json::parse_event_t::object_end) {
+                        insert(fromJson(json));
+                        return false;
+                    }
+                    return true;
+                });
+            }
+            catch (const std::exception &e) {
+                return nonstd::make_unexpected(make_error("Unable to read file '{}': {}", file_, e.what()));
             }
-            json["reason"] = entry.getReason();
-            array.push_back(json);
         }
 
-        std::ofstream file(file_);
-        if (!file) {
-            return nonstd::make_unexpected(make_error("Unable to open file '{}'.", file_));
+        if (exists(journal_file_)) {
+            std::ifstream journal(journal_file_);
+            if (!journal) {
+                return nonstd::make_unexpected(make_error("Unable to open file '{}'.", journal_file_));
+            }
+
+            std::string line;
+            while (std::getline(journal, line)) {
+                if (line.empty()) {
+                    continue;
+                }
+                try {
+                    replay(nlohmann::json::parse(line));
+                    journal_size_++;
+                }
+                catch (const std::exception &) {
+                    break;  // the last record may be incomplete if the server crashed while writing it
+                }
+            }
         }
+        return {};
+    }
 
-        try {
-            file << array;
-            return {};
+protected:
+    using Iterator = typename std::list<T>::iterator;
+    using Expiry = std::pair<BanEntry::Date, std::string>;
+
+    template <typename Predicate>
+    [[nodiscard]] T *findIf(const std::string &target, Predicate &&pred) const
+    {
+        auto [begin, end] = index_.equal_range(matcher_.key(target));
+        for (auto it = begin; it != end; ++it) {
+            if (pred(*it->second)) {
+                return &(*it->second);
+            }
         }
-        catch (const std::exception &e) {
-            return nonstd::make_unexpected(make_error("Unable to write file '{}': {}", file_, e.what()));
+        return nullptr;
+    }
+
+    template <typename Predicate>
+    bool isBannedIf(const std::string &target, Predicate &&pred)
+    {
+        removeExpired();
+        auto *entry = findIf(target, pred);
+        if (entry && isExpired(*entry)) {
+            // the expiration was brought forward after the entry was added
+            eraseIf(target, [&](const T &e) { return &e == entry; });
+            return false;
         }
+        return entry != nullptr;
     }
 
-    Result<void> load()
+    T &insert(T entry)
     {
-        if (!exists(file_)) {
-            return {};
+        auto key = matcher_.key(entry);
+        if (entry.getExpiration().has_value()) {
+            expiry_queue_.emplace(entry.getExpiration().value(), key);
         }
+        entries_.push_back(std::move(entry));
+        auto it = std::prev(entries_.end());
+        index_.emplace(std::move(key), it);
+        onInsert(*it);
+        return *it;
+    }
 
+    template <typename Predicate>
+    bool eraseIf(const std::string &target, Predicate &&pred)
+    {
+        bool erased = false;
+        auto [begin, end] = index_.equal_range(matcher_.key(target));
+        for (auto it = begin; it != end;) {
+            if (pred(*it->second)) {
+                onErase(*it->second);
+                entries_.erase(it->second);
+                it = index_.erase(it);
+                erased = true;
+            }
+            else {
+                ++it;
+            }
+        }
+        // Entries left in the expiry queue are dropped lazily by removeExpired.
+        return erased;
+    }
+
+    void clear()
+    {
         entries_.clear();
+        index_.clear();
+        expiry_queue_ = {};
+        onClear();
+    }
 
-        std::ifstream file(file_);
-        if (!file) {
-            return nonstd::make_unexpected(make_error("Unable to open file '{}'.", file_));
-        }
-
-        try {
-            auto array = nlohmann::json::parse(file);
-            for (const auto &json : array) {
-                auto entry = json.get<T>();
-                if (json.contains("created")) {
-                    std::string created = json["created"];
-                    std::istringstream in{created};
-                    BanEntry::Date date;
-                    in >> date::parse(BanEntry::DateFormat, date);
-                    if (!in.fail()) {
-                        entry.setCreated(date);
-                    }
-                }
-                if (json.contains("source")) {
-                    entry.setSource(json["source"]);
-                }
-                if (json.contains("expires")) {
-                    std::string expires = json["expires"];
-                    std::istringstream in{expires};
-                    BanEntry::Date date;
-                    in >> date::parse(BanEntry::DateFormat, date);
-                    if (!in.fail()) {
-                        entry.setExpiration(date);
-                    }
+    void removeExpired()
+    {
+        const auto now = std::chrono::system_clock::now();
+        while (!expiry_queue_.empty() && expiry_queue_.top().first < now) {
+            auto key = expiry_queue_.top().second;
+            expiry_queue_.pop();
+
+            // The entry may have been removed, replaced or had its expiration changed since it was queued, so always
+            // check the actual expiration of the entries with the same key.
+            auto [begin, end] = index_.equal_range(key);
+            for (auto it = begin; it != end;) {
+                auto &entry = *it->second;
+                if (isExpired(entry, now)) {
+                    onErase(entry);
+                    entries_.erase(it->second);
+                    it = index_.erase(it);
+                    continue;
                 }
-                if (json.contains("reason")) {
-                    entry.setReason(json["reason"]);
+                if (entry.getExpiration().has_value() && entry.getExpiration().value() > now) {
+                    expiry_queue_.emplace(entry.getExpiration().value(), key);
                 }
-                entries_.emplace_back(entry);
+                ++it;
             }
-            return {};
         }
-        catch (const std::exception &e) {
-            return nonstd::make_unexpected(make_error("Unable to read file '{}': {}", file_, e.what()));
+    }
+
+    [[nodiscard]] static bool isExpired(const T &entry, BanEntry::Date now = std::chrono::system_clock::now())
+    {
+        return entry.getExpiration().has_value() && entry.getExpiration().value() < now;
+    }
+
+    /**
+     * Records the current entries of a key in the journal. Writing happens off the main thread, and the full list is
+     * only rewritten once enough records have accumulated.
+     */
+    void journal(const std::string &target)
+    {
+        const auto key = matcher_.key(target);
+        nlohmann::json record;
+        record["key"] = key;
+        record["entries"] = nlohmann::json::array();
+        auto [begin, end] = index_.equal_range(key);
+        for (auto it = begin; it != end; ++it) {
+            record["entries"].push_back(toJson(*it->second));
+        }
+
+        writer_->submit([this, line = record.dump()]() { appendJournal(line); });
+        if (++journal_size_ >= CompactionThreshold) {
+            journal_size_ = 0;
+            writer_->submit([this, snapshot = std::vector<T>(entries_.begin(), entries_.end())]() {
+                writeSnapshot(snapshot);
+            });
         }
     }
 
-protected:
-    void removeExpired()
+    virtual void onInsert(const T &entry) {}
+    virtual void onErase(const T &entry) {}
+    virtual void onClear() {}
+
+    static constexpr std::size_t CompactionThreshold = 1000;
+
+    std::list<T> entries_;
+    std::unordered_multimap<std::string, Iterator> index_;
+    std::priority_queue<Expiry, std::vector<Expiry>, std::greater<>> expiry_queue_;
+    fs::path file_;
+    fs::path journal_file_;
+    std::size_t journal_size_{0};
+    Matcher matcher_;
+
+private:
+    static nlohmann::json toJson(const T &entry)
+    {
+        nlohmann::json json = entry;
+        json["created"] = date::format(BanEntry::DateFormat, date::floor<std::chrono::seconds>(entry.getCreated()));
+        json["source"] = entry.getSource();
+        if (entry.getExpiration().has_value()) {
+            json["expires"] =
+                date::format(BanEntry::DateFormat, date::floor<std::chrono::seconds>(entry.getExpiration().value()));
+        }
+        else {
+            json["expires"] = "forever";
+        }
+        json["reason"] = entry.getReason();
+        return json;
+    }
+
+    static T fromJson(const nlohmann::json &json)
     {
-        auto it = entries_.begin();
-        while (it != entries_.end()) {
-            if (it->getExpiration().has_value() && it->getExpiration().value() < std::chrono::system_clock::now()) {
-                it = entries_.erase(it);
+        auto entry = json.get<T>();
+        if (json.contains("created")) {
+            std::string created = json["created"];
+            std::istringstream in{created};
+            BanEntry::Date date;
+            in >> date::parse(BanEntry::DateFormat, date);
+            if (!in.fail()) {
+                entry.setCreated(date);
             }
-            else {
-                ++it;
+        }
+        if (json.contains("source")) {
+            entry.setSource(json["source"]);
+        }
+        if (json.contains("expires")) {
+            std::string expires = json["expires"];
+            std::istringstream in{expires};
+            BanEntry::Date date;
+            in >> date::parse(BanEntry::DateFormat, date);
+            if (!in.fail()) {
+                entry.setExpiration(date);
             }
         }
+        if (json.contains("reason")) {
+            entry.setReason(json["reason"]);
+        }
+        return entry;
     }
 
-    std::vector<T> entries_;
-    fs::path file_;
-    Matcher matcher_;
+    void replay(const nlohmann::json &record)
+    {
+        const std::string key = record.at("key");
+        eraseIf(key, [](const T &) { return true; });
+        for (const auto &json : record.at("entries")) {
+            insert(fromJson(json));
+        }
+    }
+
+    // The functions below are only called on the writer thread
+
+    void appendJournal(const std::string &line)
+    {
+        if (!journal_stream_.isOpen()) {
+            auto file = DurableFile::open(journal_file_, DurableFile::Mode::Append);
+            if (!file) {
+                return;  // the change stays in memory and is written with the next snapshot
+            }
+            journal_stream_ = std::move(file.value());
+        }
+        if (journal_stream_.write(line + '\n')) {
+            journal_stream_.sync();
+        }
+    }
+
+    Result<void> writeSnapshot(const std::vector<T> &entries)
+    {
+        // Write to a temporary file first and rename it, so the file is never left half-written
+        // and sync it before the rename, so the file is never left half-written even after a power loss
+        auto tmp_file = fs::path(file_).concat(".tmp");
+        {
+            auto file = DurableFile::open(tmp_file, DurableFile::Mode::Truncate);
+            if (!file) {
+                return nonstd::make_unexpected(make_error("Unable to open file '{}'.", file_));
+            }
+
+            std::string buffer = "[";
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                if (i > 0) {
+                    buffer += ',';
+                }
+                buffer += toJson(entries[i]).dump();
+                if (buffer.size() >= SnapshotBufferSize) {
+                    if (auto result = file->write(buffer); !result) {
+                        return result;
+                    }
+                    buffer.clear();
+                }
+            }
+            buffer += ']';
+
+            if (auto result = file->write(buffer); !result) {
+                return result;
+            }
+            if (auto result = file->sync(); !result) {
+                return result;
+            }
+            if (auto result = file->close(); !result) {
+                return result;
+            }
+        }
+
+        if (auto result = rename_durably(tmp_file, file_); !result) {
+            return result;
+        }
+
+        // The snapshot contains every change recorded in the journal so far
+        journal_stream_.close();
+        std::error_code ec;
+        fs::remove(journal_file_, ec);
+        return {};
+    }
+
+    static constexpr std::size_t SnapshotBufferSize = 64 * 1024;
+
+    DurableFile journal_stream_;
+    std::shared_ptr<SerialExecutor> writer_;
 };
 
 }  // namespace endstone::core
@@ -0,0 +1,186 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/ban/cidr_tree.h"
+
+#include <algorithm>
+#include <charconv>
+#include <optional>
+#include <string>
+
+#include "bedrock/deps/raknet/socket_includes.h"
+
+namespace endstone::core {
+
+namespace {
+struct Prefix {
+    bool ipv6;
+    std::array<std::uint8_t, 16> bytes;
+    int length;
+
+    [[nodiscard]] int getBit(int i) const
+    {
+        return (bytes[i / 8] >> (7 - i % 8)) & 1;
+    }
+};
+
+std::optional<Prefix> parsePrefix(std::string_view text, bool require_length)
+{
+    Prefix prefix{};
+    const auto slash = text.find('/');
+    if (require_length == (slash == std::string_view::npos)) {
+        return std::nullopt;
+    }
+
+    const std::string address{text.substr(0, slash)};
+    if (inet_pton(AF_INET, address.c_str(), prefix.bytes.data()) == 1) {
+        prefix.ipv6 = false;
+        prefix.length = 32;
+    }
+    else if (inet_pton(AF_INET6, address.c_str(), prefix.bytes.data()) == 1) {
+        prefix.ipv6 = true;
+        prefix.length = 128;
+    }
+    else {
+        return std::nullopt;
+    }
+
+    if (slash != std::string_view::npos) {
+        const auto length = text.substr(slash + 1);
+        int value = -1;
+        const auto [ptr, ec] = std::from_chars(length.data(), length.data() + length.size(), value);
+        if (ec != std::errc() || ptr != length.data() + length.size() || value < 0 || value > prefix.length) {
+            return std::nullopt;
+        }
+        prefix.length = value;
+    }
+    return prefix;
+}
+}  // namespace
+
+CidrTree::CidrTree()
+{
+    clear();
+}
+
+bool CidrTree::insert(std::string_view range)
+{
+    const auto prefix = parsePrefix(range, true);
+    if (!prefix) {
+        return false;
+    }
+
+    auto &nodes = getNodes(prefix->ipv6);
+    std::uint32_t current = 0;
+    for (int i = 0; i < prefix->length; i++) {
+        const auto bit = prefix->getBit(i);
+        if (nodes[current].children[bit] == 0) {
+            nodes[current].children[bit] = static_cast<std::uint32_t>(nodes.size());
+            nodes.emplace_back();
+        }
+        current = nodes[current].children[bit];
+    }
+    nodes[current].ranges.emplace_back(range);
+    return true;
+}
+
+bool CidrTree::erase(std::string_view range)
+{
+    const auto prefix = parsePrefix(range, true);
+    if (!prefix) {
+        return false;
+    }
+
+    // Nodes are not reclaimed, the tree only grows until it is cleared
+    auto &nodes = getNodes(prefix->ipv6);
+    std::uint32_t current = 0;
+    for (int i = 0; i < prefix->length; i++) {
+        current = nodes[current].children[prefix->getBit(i)];
+        if (current == 0) {
+            return false;
+        }
+    }
+    auto &ranges = nodes[current].ranges;
+    const auto it = std::ranges::find(ranges, range);
+    if (it == ranges.end()) {
+        return false;
+    }
+    ranges.erase(it);
+    return true;
+}
+
+bool CidrTree::contains(std::string_view address) const
+{
+    const auto prefix = parsePrefix(address, false);
+    if (!prefix) {
+        return false;
+    }
+
+    const auto &nodes = prefix->ipv6 ? ipv6_ : ipv4_;
+    std::uint32_t current = 0;
+    for (int i = 0;; i++) {
+        if (!nodes[current].ranges.empty()) {
+            return true;
+        }
+        if (i == prefix->length) {
+            return false;
+        }
+        current = nodes[current].children[prefix->getBit(i)];
+        if (current == 0) {
+            return false;
+        }
+    }
+}
+
+const std::string *CidrTree::find(std::string_view address) const
+{
+    const auto prefix = parsePrefix(address, false);
+    if (!prefix) {
+        return nullptr;
+    }
+
+    const auto &nodes = prefix->ipv6 ? ipv6_ : ipv4_;
+    const std::string *result = nullptr;
+    std::uint32_t current = 0;
+    for (int i = 0;; i++) {
+        if (!nodes[current].ranges.empty()) {
+            result = &nodes[current].ranges.front();
+        }
+        if (i == prefix->length) {
+            return result;
+        }
+        current = nodes[current].children[prefix->getBit(i)];
+        if (current == 0) {
+            return result;
+        }
+    }
+}
+
+void CidrTree::clear()
+{
+    ipv4_.assign(1, Node{});
+    ipv6_.assign(1, Node{});
+}
+
+bool CidrTree::isRange(std::string_view range)
+{
+    return parsePrefix(range, true).has_value();
+}
+
+std::vector<CidrTree::Node> &CidrTree::getNodes(bool ipv6)
+{
+    return ipv6 ? ipv6_ : ipv4_;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,86 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace endstone::core {
+
+/**
+ * A binary radix tree of IPv4 and IPv6 ranges in CIDR notation (e.g. 192.168.0.0/16, 2001:db8::/32).
+ *
+ * Checking whether an address is covered by any of the ranges walks at most one node per bit of the address, regardless
+ * of the number of ranges in the tree.
+ */
+class CidrTree {
+public:
+    CidrTree();
+
+    /**
+     * Adds a range to the tree.
+     *
+     * @param range the range in CIDR notation
+     * @return true if the range is valid and was added, false otherwise
+     */
+    bool insert(std::string_view range);
+
+    /**
+     * Removes a range previously added to the tree.
+     *
+     * @param range the range in CIDR notation
+     * @return true if the range was found and removed, false otherwise
+     */
+    bool erase(std::string_view range);
+
+    /**
+     * Checks if an address is covered by any of the ranges in the tree.
+     *
+     * @param address the IPv4 or IPv6 address
+     * @return true if the address is covered, false otherwise
+     */
+    [[nodiscard]] bool contains(std::string_view address) const;
+
+    /**
+     * Finds the most specific range in the tree that covers an address.
+     *
+     * @param address the IPv4 or IPv6 address
+     * @return the range as it was added, or nullptr if the address is not covered
+     */
+    [[nodiscard]] const std::string *find(std::string_view address) const;
+
+    void clear();
+
+    /**
+     * Checks if a string is a valid range in CIDR notation.
+     */
+    [[nodiscard]] static bool isRange(std::string_view range);
+
+private:
+    struct Node {
+        std::array<std::uint32_t, 2> children{0, 0};  // 0 means no child as the root is never a child
+        std::vector<std::string> ranges;              // ranges ending at this node, as they were added
+    };
+
+    std::vector<Node> &getNodes(bool ipv6);
+
+    std::vector<Node> ipv4_;
+    std::vector<Node> ipv6_;
+};
+
+}  // namespace endstone::core
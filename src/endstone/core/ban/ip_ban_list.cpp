@@ -21,14 +21,36 @@ bool IpBanEntryMatcher::operator()(const IpBanEntry &entry, const std::string &a
     return entry.getAddress() == address;
 }
 
+std::string IpBanEntryMatcher::key(const IpBanEntry &entry) const
+{
+    return entry.getAddress();
+}
+
+std::string IpBanEntryMatcher::key(const std::string &address) const
+{
+    return address;
+}
+
 const IpBanEntry *EndstoneIpBanList::getBanEntry(std::string address) const
 {
-    return EndstoneBanList::getBanEntry(address);
+    if (const auto *entry = EndstoneBanList::getBanEntry(address)) {
+        return entry;
+    }
+    if (const auto *range = ranges_.find(address)) {
+        return EndstoneBanList::getBanEntry(*range);
+    }
+    return nullptr;
 }
 
 IpBanEntry *EndstoneIpBanList::getBanEntry(std::string address)
 {
-    return EndstoneBanList::getBanEntry(address);
+    if (auto *entry = EndstoneBanList::getBanEntry(address)) {
+        return entry;
+    }
+    if (const auto *range = ranges_.find(address)) {
+        return EndstoneBanList::getBanEntry(*range);
+    }
+    return nullptr;
 }
 
 IpBanEntry &EndstoneIpBanList::addBan(std::string address, std::optional<std::string> reason,
@@ -55,7 +77,12 @@ std::vector<IpBanEntry *> EndstoneIpBanList::getEntries()
 
 bool EndstoneIpBanList::isBanned(std::string address) const
 {
-    return EndstoneBanList::isBanned(address);
+    if (EndstoneBanList::isBanned(address)) {
+        return true;
+    }
+    // check the entry of the range as well, its expiration may have been brought forward after it was added
+    const auto *range = ranges_.find(address);
+    return range && EndstoneBanList::isBanned(*range);
 }
 
 void EndstoneIpBanList::removeBan(std::string address)
@@ -63,4 +90,19 @@ void EndstoneIpBanList::removeBan(std::string address)
     EndstoneBanList::removeBan(address);
 }
 
+void EndstoneIpBanList::onInsert(const IpBanEntry &entry)
+{
+    ranges_.insert(entry.getAddress());
+}
+
+void EndstoneIpBanList::onErase(const IpBanEntry &entry)
+{
+    ranges_.erase(entry.getAddress());
+}
+
+void EndstoneIpBanList::onClear()
+{
+    ranges_.clear();
+}
+
 }  // namespace endstone::core
@@ -16,6 +16,7 @@
 
 #include "endstone/ban/ip_ban_list.h"
 #include "endstone/core/ban/ban_list.h"
+#include "endstone/core/ban/cidr_tree.h"
 
 namespace nlohmann {
 template <>
@@ -38,8 +39,15 @@ bool match(const IpBanEntry &entry, const std::string &address);
 
 struct IpBanEntryMatcher {
     bool operator()(const IpBanEntry &entry, const std::string &address) const;
+    [[nodiscard]] std::string key(const IpBanEntry &entry) const;
+    [[nodiscard]] std::string key(const std::string &address) const;
 };
 
+/**
+ * The IP ban list. Besides single addresses, entries may also be ranges in CIDR notation (e.g. 192.168.0.0/16), in
+ * which case every address in the range is banned. Looking up an address without an entry of its own returns the entry
+ * of the most specific range covering it.
+ */
 class EndstoneIpBanList : public IpBanList, public EndstoneBanList<IpBanEntry, IpBanEntryMatcher> {
 public:
     using EndstoneBanList::EndstoneBanList;
@@ -54,6 +62,14 @@ public:
     [[nodiscard]] std::vector<IpBanEntry *> getEntries() override;
     [[nodiscard]] bool isBanned(std::string address) const override;
     void removeBan(std::string address) override;
+
+protected:
+    void onInsert(const IpBanEntry &entry) override;
+    void onErase(const IpBanEntry &entry) override;
+    void onClear() override;
+
+private:
+    CidrTree ranges_;
 };
 
 }  // namespace endstone::core
@@ -31,6 +31,16 @@ bool PlayerBanEntryMatcher::operator()(const PlayerBanEntry &entry, const std::s
     return name_match && uuid_match && xuid_match;
 }
 
+std::string PlayerBanEntryMatcher::key(const PlayerBanEntry &entry) const
+{
+    return key(entry.getName());
+}
+
+std::string PlayerBanEntryMatcher::key(const std::string &name) const
+{
+    return boost::algorithm::to_lower_copy(name);
+}
+
 const PlayerBanEntry *EndstonePlayerBanList::getBanEntry(std::string name) const
 {
     return getBanEntry(name, std::nullopt, std::nullopt);
@@ -44,25 +54,13 @@ PlayerBanEntry *EndstonePlayerBanList::getBanEntry(std::string name)
 const PlayerBanEntry *EndstonePlayerBanList::getBanEntry(std::string name, std::optional<UUID> uuid,
                                                          std::optional<std::string> xuid) const
 {
-    const auto it = std::find_if(entries_.begin(), entries_.end(),
-                                 [&](const PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); });
-
-    if (it != entries_.end()) {
-        return &(*it);
-    }
-    return nullptr;
+    return findIf(name, [&](const PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); });
 }
 
 PlayerBanEntry *EndstonePlayerBanList::getBanEntry(std::string name, std::optional<UUID> uuid,
                                                    std::optional<std::string> xuid)
 {
-    const auto it = std::find_if(entries_.begin(), entries_.end(),
-                                 [&](PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); });
-
-    if (it != entries_.end()) {
-        return &(*it);
-    }
-    return nullptr;
+    return findIf(name, [&](const PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); });
 }
 
 PlayerBanEntry &EndstonePlayerBanList::addBan(std::string name, std::optional<std::string> reason,
@@ -75,9 +73,7 @@ PlayerBanEntry &EndstonePlayerBanList::addBan(std::string name, std::optional<UU
                                               std::optional<std::string> xuid, std::optional<std::string> reason,
                                               std::optional<BanEntry::Date> expires, std::optional<std::string> source)
 {
-    entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
-                                  [&](PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); }),
-                   entries_.end());
+    eraseIf(name, [&](const PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); });
 
     PlayerBanEntry new_entry{name, uuid, xuid};
     if (reason.has_value()) {
@@ -87,8 +83,8 @@ PlayerBanEntry &EndstonePlayerBanList::addBan(std::string name, std::optional<UU
     if (source.has_value()) {
         new_entry.setSource(source.value());
     }
-    auto &entry = entries_.emplace_back(new_entry);
-    save();
+    auto &entry = insert(std::move(new_entry));
+    journal(name);
 
     return entry;
 }
@@ -123,8 +119,8 @@ bool EndstonePlayerBanList::isBanned(std::string name) const
 
 bool EndstonePlayerBanList::isBanned(std::string name, std::optional<UUID> uuid, std::optional<std::string> xuid) const
 {
-    const_cast<EndstonePlayerBanList *>(this)->removeExpired();
-    return getBanEntry(name, uuid, xuid) != nullptr;
+    return const_cast<EndstonePlayerBanList *>(this)->isBannedIf(
+        name, [&](const PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); });
 }
 
 void EndstonePlayerBanList::removeBan(std::string name)
@@ -134,11 +130,8 @@ void EndstonePlayerBanList::removeBan(std::string name)
 
 void EndstonePlayerBanList::removeBan(std::string name, std::optional<UUID> uuid, std::optional<std::string> xuid)
 {
-    const auto it = std::find_if(entries_.begin(), entries_.end(),
-                                 [&](PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); });
-    if (it != entries_.end()) {
-        entries_.erase(it);
-        save();
+    if (eraseIf(name, [&](const PlayerBanEntry &entry) { return matcher_(entry, name, uuid, xuid); })) {
+        journal(name);
     }
 }
 
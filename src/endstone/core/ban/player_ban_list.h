@@ -64,6 +64,8 @@ struct PlayerBanEntryMatcher {
     bool operator()(const PlayerBanEntry &entry, const std::string &name,
                     const std::optional<UUID> &uuid = std::nullopt,
                     const std::optional<std::string> &xuid = std::nullopt) const;
+    [[nodiscard]] std::string key(const PlayerBanEntry &entry) const;
+    [[nodiscard]] std::string key(const std::string &name) const;
 };
 
 class EndstonePlayerBanList : public PlayerBanList, public EndstoneBanList<PlayerBanEntry, PlayerBanEntryMatcher> {
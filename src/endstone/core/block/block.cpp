@@ -62,7 +62,7 @@ Result<void> EndstoneBlock::setType(std::string type, bool apply_physics)
 Result<std::shared_ptr<BlockData>> EndstoneBlock::getData() const
 {
     return checkState().and_then([&](const auto * /*self*/) -> Result<std::shared_ptr<BlockData>> {
-        return std::make_shared<EndstoneBlockData>(getMinecraftBlock());
+        return entt::locator<EndstoneServer>::value().getBlockDataCache().intern(getMinecraftBlock());
     });
 }
 
@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/block/block_data_cache.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "endstone/core/block/block_data.h"
+
+namespace endstone::core {
+
+BlockDataCache::BlockDataCache(std::size_t capacity) : capacity_(capacity) {}
+
+std::shared_ptr<BlockData> BlockDataCache::intern(const ::Block &block)
+{
+    std::lock_guard lock(mutex_);
+    auto &data = interned_[&block];
+    if (!data) {
+        data = std::make_shared<EndstoneBlockData>(const_cast<::Block &>(block));
+    }
+    return data;
+}
+
+std::shared_ptr<BlockData> BlockDataCache::get(const std::string &key)
+{
+    std::lock_guard lock(mutex_);
+    auto it = resolved_.find(key);
+    if (it == resolved_.end()) {
+        misses_++;
+        return nullptr;
+    }
+    hits_++;
+    return it->second;
+}
+
+void BlockDataCache::put(std::string key, std::shared_ptr<BlockData> data)
+{
+    if (capacity_ == 0 || !data) {
+        return;
+    }
+
+    std::lock_guard lock(mutex_);
+    if (resolved_.size() >= capacity_ && !resolved_.contains(key)) {
+        // Keys are cheap to rebuild, so a full cache simply starts over instead of tracking recency
+        resolved_.clear();
+    }
+    resolved_.insert_or_assign(std::move(key), std::move(data));
+}
+
+BlockDataCache::Stats BlockDataCache::getStats() const
+{
+    std::lock_guard lock(mutex_);
+    return {hits_, misses_, resolved_.size(), capacity_};
+}
+
+std::string BlockDataCache::makeKey(std::string_view type, const BlockStates &states)
+{
+    std::string key;
+    if (type.find(':') == std::string_view::npos) {
+        key = "minecraft:";
+    }
+    key += type;
+    if (states.empty()) {
+        return key;
+    }
+
+    std::vector<const BlockStates::value_type *> sorted;
+    sorted.reserve(states.size());
+    for (const auto &state : states) {
+        sorted.push_back(&state);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto *a, const auto *b) { return a->first < b->first; });
+
+    key += '[';
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        if (i > 0) {
+            key += ',';
+        }
+        fmt::format_to(std::back_inserter(key), "{}", *sorted[i]);
+    }
+    key += ']';
+    return key;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,94 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "endstone/block/block_data.h"
+
+class Block;
+
+namespace endstone::core {
+
+/**
+ * Interns the block data handed out to plugins.
+ *
+ * Every block permutation in the registry is represented by a single shared, immutable BlockData instance. On top of
+ * that, the results of resolving a type and block states through the block registry are cached by their canonical
+ * form, so that creating the same block data again is a single hash lookup.
+ *
+ * This class is thread-safe.
+ */
+class BlockDataCache {
+public:
+    struct Stats {
+        std::uint64_t hits;
+        std::uint64_t misses;
+        std::size_t size;
+        std::size_t capacity;
+
+        [[nodiscard]] float getHitRate() const
+        {
+            const auto total = hits + misses;
+            return total == 0 ? 0.0F : static_cast<float>(hits) / static_cast<float>(total);
+        }
+    };
+
+    static constexpr std::size_t DefaultCapacity = 65536;
+
+    explicit BlockDataCache(std::size_t capacity = DefaultCapacity);
+
+    /**
+     * Gets the shared block data of a block permutation, creating it on first use.
+     */
+    [[nodiscard]] std::shared_ptr<BlockData> intern(const ::Block &block);
+
+    /**
+     * Gets the block data previously resolved for the given canonical key.
+     *
+     * @param key the key returned by makeKey
+     * @return the cached block data, or null on a miss
+     */
+    [[nodiscard]] std::shared_ptr<BlockData> get(const std::string &key);
+
+    /**
+     * Caches the block data resolved for the given canonical key. The cache is emptied when it reaches its capacity,
+     * the interned block data are kept.
+     */
+    void put(std::string key, std::shared_ptr<BlockData> data);
+    [[nodiscard]] Stats getStats() const;
+
+    /**
+     * Builds the canonical form of a block type and its states, e.g. minecraft:wool["color"="red"]. The namespace
+     * defaults to minecraft and the states are sorted by name, so that equivalent inputs share a key.
+     */
+    [[nodiscard]] static std::string makeKey(std::string_view type, const BlockStates &states);
+
+private:
+    std::size_t capacity_;
+    mutable std::mutex mutex_;
+    std::unordered_map<const ::Block *, std::shared_ptr<BlockData>> interned_;
+    std::unordered_map<std::string, std::shared_ptr<BlockData>> resolved_;
+    std::uint64_t hits_{0};
+    std::uint64_t misses_{0};
+};
+
+}  // namespace endstone::core
@@ -14,9 +14,9 @@
 
 #include "endstone/core/block/block_state.h"
 
-#include "bedrock/world/level/block/block_descriptor.h"
 #include "endstone/core/block/block.h"
 #include "endstone/core/block/block_data.h"
+#include "endstone/core/server.h"
 #include "endstone/core/util/error.h"
 
 namespace endstone::core {
@@ -45,20 +45,19 @@ std::string EndstoneBlockState::getType() const
 Result<void> EndstoneBlockState::setType(std::string type)
 {
     if (getType() != type) {
-        using ScriptModuleMinecraft::ScriptBlockUtils::createBlockDescriptor;
-        const auto block_descriptor = createBlockDescriptor(type, std::nullopt);
-        auto *block = const_cast<::Block *>(block_descriptor.tryGetBlockNoLogging());
-        if (!block) {
+        const auto &server = entt::locator<EndstoneServer>::value();
+        auto result = server.createBlockData(type);
+        if (!result) {
             return nonstd::make_unexpected(make_error("BlockState::setType failed: unknown block type {}.", type));
         }
-        block_ = block;
+        block_ = &static_cast<EndstoneBlockData &>(*result.value()).getHandle();
     }
     return {};
 }
 
 std::shared_ptr<BlockData> EndstoneBlockState::getData() const
 {
-    return std::make_shared<EndstoneBlockData>(*block_);
+    return entt::locator<EndstoneServer>::value().getBlockDataCache().intern(*block_);
 }
 
 Result<void> EndstoneBlockState::setData(std::shared_ptr<BlockData> data)
@@ -156,7 +156,8 @@ void EndstoneBossBar::send(BossEventUpdateType event_type, Player &player)
 {
     const auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::BossEvent);
     const auto pk = std::static_pointer_cast<BossEventPacket>(packet);
-    const auto &handle = static_cast<EndstonePlayer &>(player).getHandle();
+    auto &endstone_player = static_cast<EndstonePlayer &>(player);
+    const auto &handle = endstone_player.getHandle();
     pk->boss_id = handle.getOrCreateUniqueID();
     pk->player_id = handle.getOrCreateUniqueID();
     pk->event_type = event_type;
@@ -165,7 +166,7 @@ void EndstoneBossBar::send(BossEventUpdateType event_type, Player &player)
     pk->color = static_cast<BossBarColor>(color_);
     pk->overlay = static_cast<BossBarOverlay>(style_);
     pk->darken_screen = hasFlag(BarFlag::DarkenSky);
-    handle.sendNetworkPacket(*packet);
+    endstone_player.queuePacket(packet);
 }
 
 void EndstoneBossBar::broadcast(BossEventUpdateType event_type)
@@ -0,0 +1,178 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/command/async_command_sender.h"
+
+#include <algorithm>
+
+#include "endstone/core/permissions/permissible.h"
+#include "endstone/core/server.h"
+#include "endstone/core/util/error.h"
+#include "endstone/permissions/permission_attachment_info.h"
+
+namespace endstone::core {
+
+namespace {
+std::string toLower(std::string name)
+{
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    return name;
+}
+}  // namespace
+
+AsyncCommandSender::AsyncCommandSender(EndstoneServer &server, const CommandSender &sender)
+    : server_(server), name_(sender.getName()), op_(sender.isOp())
+{
+    if (const auto *player = sender.asPlayer(); player) {
+        player_id_ = player->getUniqueId();
+    }
+
+    for (const auto *info : sender.getEffectivePermissions()) {
+        permissions_.emplace(toLower(info->getPermission()), info->getValue());
+    }
+}
+
+void AsyncCommandSender::sendMessage(const Message &message) const
+{
+    enqueue(message, false);
+}
+
+void AsyncCommandSender::sendErrorMessage(const Message &message) const
+{
+    enqueue(message, true);
+}
+
+Server &AsyncCommandSender::getServer() const
+{
+    return server_;
+}
+
+std::string AsyncCommandSender::getName() const
+{
+    return name_;
+}
+
+bool AsyncCommandSender::isOp() const
+{
+    return op_;
+}
+
+void AsyncCommandSender::setOp(bool value)
+{
+    server_.getLogger().error("Changing the operator status of {} is not supported in asynchronous commands.",
+                              getName());
+}
+
+bool AsyncCommandSender::isPermissionSet(std::string name) const
+{
+    return permissions_.find(toLower(std::move(name))) != permissions_.end();
+}
+
+bool AsyncCommandSender::isPermissionSet(const Permission &perm) const
+{
+    return isPermissionSet(perm.getName());
+}
+
+bool AsyncCommandSender::hasPermission(std::string name) const
+{
+    // Reading the permission registry is not safe off the server thread, so unknown permissions are denied
+    if (auto it = permissions_.find(toLower(std::move(name))); it != permissions_.end()) {
+        return it->second;
+    }
+    return false;
+}
+
+bool AsyncCommandSender::hasPermission(const Permission &perm) const
+{
+    return hasPermission(perm.getName());
+}
+
+Result<PermissionAttachment *> AsyncCommandSender::addAttachment(Plugin &plugin, const std::string &name, bool value)
+{
+    return nonstd::make_unexpected(make_error("Permission attachments are not supported in asynchronous commands."));
+}
+
+Result<PermissionAttachment *> AsyncCommandSender::addAttachment(Plugin &plugin)
+{
+    return nonstd::make_unexpected(make_error("Permission attachments are not supported in asynchronous commands."));
+}
+
+Result<void> AsyncCommandSender::removeAttachment(PermissionAttachment &attachment)
+{
+    return nonstd::make_unexpected(make_error("Permission attachments are not supported in asynchronous commands."));
+}
+
+void AsyncCommandSender::recalculatePermissions()
+{
+    // Permissions are captured when the command is dispatched, nothing to recalculate
+}
+
+std::unordered_set<PermissionAttachmentInfo *> AsyncCommandSender::getEffectivePermissions() const
+{
+    return {};
+}
+
+void AsyncCommandSender::flush() const
+{
+    std::vector<std::pair<Message, bool>> messages;
+    {
+        std::lock_guard lock(mutex_);
+        messages.swap(pending_);
+        flush_scheduled_ = false;
+    }
+
+    auto *target = getTarget();
+    if (!target) {
+        return;
+    }
+
+    for (const auto &[message, error] : messages) {
+        if (error) {
+            target->sendErrorMessage(message);
+        }
+        else {
+            target->sendMessage(message);
+        }
+    }
+}
+
+std::shared_ptr<AsyncCommandSender> AsyncCommandSender::create(EndstoneServer &server, const CommandSender &sender)
+{
+    return PermissibleFactory::create<AsyncCommandSender>(server, sender);
+}
+
+void AsyncCommandSender::enqueue(Message message, bool error) const
+{
+    {
+        std::lock_guard lock(mutex_);
+        pending_.emplace_back(std::move(message), error);
+        if (flush_scheduled_) {
+            return;  // messages sent before the next flush will be delivered in the same batch
+        }
+        flush_scheduled_ = true;
+    }
+
+    auto self = std::const_pointer_cast<AsyncCommandSender>(shared_from_this());
+    static_cast<EndstoneScheduler &>(server_.getScheduler()).runTask([self]() { self->flush(); });
+}
+
+CommandSender *AsyncCommandSender::getTarget() const
+{
+    if (player_id_.has_value()) {
+        return server_.getPlayer(player_id_.value());
+    }
+    return &server_.getCommandSender();
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/command/command_sender.h"
+#include "endstone/util/uuid.h"
+
+namespace endstone::core {
+
+class EndstoneServer;
+
+/**
+ * A thread-safe proxy of a CommandSender, handed to plugin commands that are executed asynchronously.
+ *
+ * The name, operator status and effective permissions of the original sender are captured on the server thread when the
+ * proxy is created. The effective permissions already include every permission granted by default, so a permission
+ * that is not among them is denied. Messages are buffered and delivered to the original sender on the server thread in batches. If the original
+ * sender is a player who has left in the meantime, the messages are dropped.
+ */
+class AsyncCommandSender : public CommandSender, public std::enable_shared_from_this<AsyncCommandSender> {
+protected:
+    AsyncCommandSender(EndstoneServer &server, const CommandSender &sender);
+
+public:
+    void sendMessage(const Message &message) const override;
+    void sendErrorMessage(const Message &message) const override;
+    [[nodiscard]] Server &getServer() const override;
+    [[nodiscard]] std::string getName() const override;
+
+    [[nodiscard]] bool isOp() const override;
+    void setOp(bool value) override;
+    [[nodiscard]] bool isPermissionSet(std::string name) const override;
+    [[nodiscard]] bool isPermissionSet(const Permission &perm) const override;
+    [[nodiscard]] bool hasPermission(std::string name) const override;
+    [[nodiscard]] bool hasPermission(const Permission &perm) const override;
+    Result<PermissionAttachment *> addAttachment(Plugin &plugin, const std::string &name, bool value) override;
+    Result<PermissionAttachment *> addAttachment(Plugin &plugin) override;
+    Result<void> removeAttachment(PermissionAttachment &attachment) override;
+    void recalculatePermissions() override;
+    [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
+
+    /**
+     * Delivers all buffered messages to the original sender. Must be called on the server thread.
+     */
+    void flush() const;
+
+    static std::shared_ptr<AsyncCommandSender> create(EndstoneServer &server, const CommandSender &sender);
+
+private:
+    void enqueue(Message message, bool error) const;
+    [[nodiscard]] CommandSender *getTarget() const;
+
+    EndstoneServer &server_;
+    std::string name_;
+    bool op_;
+    std::optional<UUID> player_id_;
+    std::unordered_map<std::string, bool> permissions_;
+
+    mutable std::mutex mutex_;
+    mutable std::vector<std::pair<Message, bool>> pending_;
+    mutable bool flush_scheduled_{false};
+};
+
+}  // namespace endstone::core
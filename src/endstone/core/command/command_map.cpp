@@ -24,13 +24,16 @@
 #include "bedrock/locale/i18n.h"
 #include "bedrock/server/commands/command_registry.h"
 #include "endstone/command/plugin_command.h"
+#include "endstone/core/command/command_output_with_sender.h"
 #include "endstone/core/command/command_usage_parser.h"
 #include "endstone/core/command/defaults/ban_command.h"
 #include "endstone/core/command/defaults/ban_ip_command.h"
 #include "endstone/core/command/defaults/ban_list_command.h"
+#include "endstone/core/command/defaults/netstats_command.h"
 #include "endstone/core/command/defaults/pardon_command.h"
 #include "endstone/core/command/defaults/pardon_ip_command.h"
 #include "endstone/core/command/defaults/plugins_command.h"
+#include "endstone/core/command/defaults/pregen_command.h"
 #include "endstone/core/command/defaults/reload_command.h"
 #include "endstone/core/command/defaults/status_command.h"
 #include "endstone/core/command/defaults/version_command.h"
@@ -50,14 +53,22 @@ EndstoneCommandMap::EndstoneCommandMap(EndstoneServer &server) : server_(server)
     setDefaultCommands();
 }
 
-bool EndstoneCommandMap::dispatch(CommandSender &sender, std::string command_line) const
+namespace {
+std::vector<std::string> splitCommandLine(std::string_view command_line)
 {
     if (!command_line.empty() && command_line[0] == '/') {
-        command_line = command_line.substr(1);
+        command_line.remove_prefix(1);
     }
 
     std::vector<std::string> args;
     split(args, command_line, boost::is_any_of(" "), boost::token_compress_on);
+    return args;
+}
+}  // namespace
+
+bool EndstoneCommandMap::dispatch(CommandSender &sender, std::string command_line) const
+{
+    auto args = splitCommandLine(command_line);
     if (args.empty()) {
         return false;
     }
@@ -77,6 +88,46 @@ bool EndstoneCommandMap::dispatch(CommandSender &sender, std::string command_lin
     }
 }
 
+std::vector<bool> EndstoneCommandMap::dispatch(CommandSender &sender, std::span<const std::string> command_lines) const
+{
+    std::vector<bool> results;
+    results.reserve(command_lines.size());
+
+    // The origin and output are resolved lazily and shared by all commands in the batch
+    std::unique_ptr<CommandOrigin> origin;
+    CommandOutputWithSender output{CommandOutputType::AllOutput, sender};
+
+    for (const auto &command_line : command_lines) {
+        auto args = splitCommandLine(command_line);
+        if (args.empty()) {
+            results.push_back(false);
+            continue;
+        }
+
+        const auto *target = static_cast<CommandWrapper *>(getCommand(args[0]));
+        if (!target) {
+            sender.sendErrorMessage(Translatable("commands.generic.unknown", {args[0]}));
+            results.push_back(false);
+            continue;
+        }
+
+        try {
+            if (!origin) {
+                origin = CommandWrapper::getCommandOrigin(sender);
+                if (!origin) {
+                    throw std::runtime_error("Unsupported command origin type");
+                }
+            }
+            results.push_back(target->execute(sender, std::vector(args.begin() + 1, args.end()), *origin, output));
+        }
+        catch (const std::exception &e) {
+            server_.getLogger().error("Unhandled exception executing '{}': {}", command_line, e.what());
+            results.push_back(false);
+        }
+    }
+    return results;
+}
+
 void EndstoneCommandMap::clearCommands()
 {
     std::lock_guard lock(mutex_);
@@ -101,14 +152,32 @@ Command *EndstoneCommandMap::getCommand(std::string name) const
     return it->second.get();
 }
 
+std::vector<CommandWrapper *> EndstoneCommandMap::getCommands() const
+{
+    std::vector<CommandWrapper *> result;
+    for (const auto &[name, command] : known_commands_) {
+        if (command->getName() == name) {  // skip aliases
+            result.push_back(command.get());
+        }
+    }
+    return result;
+}
+
+const LatencyTracker &EndstoneCommandMap::getCompileLatency() const
+{
+    return compile_latency_;
+}
+
 void EndstoneCommandMap::setDefaultCommands()
 {
     registerCommand(std::make_unique<BanCommand>());
     registerCommand(std::make_unique<BanIpCommand>());
     registerCommand(std::make_unique<BanListCommand>());
+    registerCommand(std::make_unique<NetStatsCommand>());
     registerCommand(std::make_unique<PardonCommand>());
     registerCommand(std::make_unique<PardonIpCommand>());
     registerCommand(std::make_unique<PluginsCommand>());
+    registerCommand(std::make_unique<PregenCommand>());
     registerCommand(std::make_unique<ReloadCommand>());
     registerCommand(std::make_unique<StatusCommand>());
     registerCommand(std::make_unique<VersionCommand>());
@@ -148,7 +217,7 @@ void EndstoneCommandMap::setMinecraftCommands()
         }
 
         auto command = std::make_shared<CommandWrapper>(
-            server_.getMinecraftCommands(),
+            server_.getMinecraftCommands(), compile_latency_,
             std::make_unique<MinecraftCommand>(command_name, description, usages, aliases));
         command->registerTo(*this);
 
@@ -214,7 +283,7 @@ bool EndstoneCommandMap::registerCommand(std::shared_ptr<Command> command)
         return false;
     }
 
-    auto wrapped = std::make_shared<CommandWrapper>(server_.getMinecraftCommands(), command);
+    auto wrapped = std::make_shared<CommandWrapper>(server_.getMinecraftCommands(), compile_latency_, command);
     command = wrapped;
 
     // Check if the command name is available
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <mutex>
+#include <span>
 #include <unordered_map>
 
 #include "endstone/command/command.h"
@@ -29,8 +30,11 @@ public:
     explicit EndstoneCommandMap(EndstoneServer &server);
     bool registerCommand(std::shared_ptr<Command> command) override;
     bool dispatch(CommandSender &sender, std::string command_line) const override;
+    std::vector<bool> dispatch(CommandSender &sender, std::span<const std::string> command_lines) const;
     void clearCommands() override;
     [[nodiscard]] Command *getCommand(std::string name) const override;
+    [[nodiscard]] std::vector<CommandWrapper *> getCommands() const;
+    [[nodiscard]] const LatencyTracker &getCompileLatency() const;
 
 private:
     friend class EndstoneServer;
@@ -44,6 +48,7 @@ private:
 
     EndstoneServer &server_;
     std::recursive_mutex mutex_;
+    LatencyTracker compile_latency_;
     std::unordered_map<std::string, std::shared_ptr<CommandWrapper>> known_commands_;
 };
 
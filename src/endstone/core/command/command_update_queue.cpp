@@ -0,0 +1,62 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/command/command_update_queue.h"
+
+#include <algorithm>
+
+namespace endstone::core {
+
+CommandUpdateQueue::CommandUpdateQueue(std::size_t max_per_tick) : max_per_tick_(std::max<std::size_t>(max_per_tick, 1))
+{
+}
+
+void CommandUpdateQueue::push(const UUID &player_id)
+{
+    requested_++;
+    if (!queued_.insert(player_id).second) {
+        coalesced_++;
+        return;
+    }
+    queue_.push_back(player_id);
+}
+
+std::vector<UUID> CommandUpdateQueue::pop()
+{
+    const auto count = std::min(queue_.size(), max_per_tick_);
+    std::vector<UUID> result(queue_.begin(), queue_.begin() + static_cast<std::ptrdiff_t>(count));
+    queue_.erase(queue_.begin(), queue_.begin() + static_cast<std::ptrdiff_t>(count));
+    for (const auto &player_id : result) {
+        queued_.erase(player_id);
+    }
+    sent_ += count;
+    return result;
+}
+
+bool CommandUpdateQueue::empty() const
+{
+    return queue_.empty();
+}
+
+void CommandUpdateQueue::setMaxPerTick(std::size_t max_per_tick)
+{
+    max_per_tick_ = std::max<std::size_t>(max_per_tick, 1);
+}
+
+CommandUpdateQueue::Stats CommandUpdateQueue::getStats() const
+{
+    return {requested_, coalesced_, sent_, queue_.size()};
+}
+
+}  // namespace endstone::core
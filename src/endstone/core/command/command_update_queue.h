@@ -0,0 +1,68 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_set>
+#include <vector>
+
+#include "endstone/util/uuid.h"
+
+namespace endstone::core {
+
+/**
+ * Players waiting for their list of available commands to be sent.
+ *
+ * The command registry is serialized once for all the players updated in the same tick instead of once per player.
+ * Requests are coalesced, so a player asking for several updates before being served (e.g. on join, when both the
+ * permissions and the command list change) only gets one. At most max_per_tick players are served per tick, in the
+ * order they asked, to spread the cost of /reload and join storms over several ticks.
+ */
+class CommandUpdateQueue {
+public:
+    struct Stats {
+        std::uint64_t requested;
+        std::uint64_t coalesced;
+        std::uint64_t sent;
+        std::size_t pending;
+    };
+
+    static constexpr std::size_t DefaultMaxPerTick = 20;
+
+    explicit CommandUpdateQueue(std::size_t max_per_tick = DefaultMaxPerTick);
+
+    void push(const UUID &player_id);
+
+    /**
+     * Removes and returns the players to serve in this tick, in the order they asked.
+     */
+    [[nodiscard]] std::vector<UUID> pop();
+
+    [[nodiscard]] bool empty() const;
+    void setMaxPerTick(std::size_t max_per_tick);
+    [[nodiscard]] Stats getStats() const;
+
+private:
+    std::size_t max_per_tick_;
+    std::deque<UUID> queue_;
+    std::unordered_set<UUID> queued_;
+    std::uint64_t requested_{0};
+    std::uint64_t coalesced_{0};
+    std::uint64_t sent_{0};
+};
+
+}  // namespace endstone::core
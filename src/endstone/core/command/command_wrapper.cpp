@@ -17,14 +17,18 @@
 #include <boost/algorithm/string.hpp>
 
 #include "bedrock/server/commands/command_origin_loader.h"
+#include "endstone/command/plugin_command.h"
+#include "endstone/core/command/async_command_sender.h"
 #include "endstone/core/command/command_output_with_sender.h"
 #include "endstone/core/level/level.h"
 #include "endstone/core/server.h"
 
 namespace endstone::core {
 
-CommandWrapper::CommandWrapper(MinecraftCommands &minecraft_commands, std::shared_ptr<Command> command)
-    : Command(*command), minecraft_commands_(minecraft_commands), command_(std::move(command))
+CommandWrapper::CommandWrapper(MinecraftCommands &minecraft_commands, LatencyTracker &compile_latency,
+                               std::shared_ptr<Command> command)
+    : Command(*command), minecraft_commands_(minecraft_commands), compile_latency_(compile_latency),
+      command_(std::move(command)), async_latency_(std::make_shared<LatencyTracker>())
 {
 }
 
@@ -39,21 +43,38 @@ bool CommandWrapper::execute(CommandSender &sender, const std::vector<std::strin
         throw std::runtime_error("Unsupported command origin type");
     }
 
+    CommandOutputWithSender output{CommandOutputType::AllOutput, sender};
+    return run(sender, args, *command_origin, output);
+}
+
+bool CommandWrapper::execute(CommandSender &sender, const std::vector<std::string> &args, CommandOrigin &origin,
+                             CommandOutputWithSender &output) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    output.reset();
+    return run(sender, args, origin, output);
+}
+
+bool CommandWrapper::run(CommandSender &sender, const std::vector<std::string> &args, CommandOrigin &origin,
+                         CommandOutputWithSender &output) const
+{
     // compile command
     std::vector command_parts = {"/" + getName()};
     command_parts.insert(command_parts.end(), args.begin(), args.end());
     const auto full_command = boost::algorithm::join(command_parts, " ");
+    const auto start = std::chrono::steady_clock::now();
     const auto *command = minecraft_commands_.compileCommand(  //
-        full_command, *command_origin, CurrentCmdVersion::Latest,
-        [&sender](auto const &err) { sender.sendErrorMessage(err); });
-
+        full_command, origin, CurrentCmdVersion::Latest, [&sender](auto const &err) { sender.sendErrorMessage(err); });
+    compile_latency_.record(std::chrono::steady_clock::now() - start);
     if (!command) {
         return false;
     }
 
     // run the command and pass down the sender
-    CommandOutputWithSender output{CommandOutputType::AllOutput, sender};
-    command->run(*command_origin, output);
+    command->run(origin, output);
 
     // redirect outputs to sender
     for (const auto &message : output.getMessages()) {
@@ -82,6 +103,34 @@ Command &CommandWrapper::unwrap() const
     return *command_;
 }
 
+bool CommandWrapper::executeWrapped(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    auto *plugin_command = command_->asPluginCommand();
+    if (!plugin_command || !plugin_command->isAsync()) {
+        return command_->execute(sender, args);
+    }
+
+    // Messages can only be delivered later to senders that outlive the command, run the rest synchronously
+    if (!sender.asPlayer() && !sender.asConsole()) {
+        return command_->execute(sender, args);
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto proxy = AsyncCommandSender::create(server, sender);
+    auto task = server.getScheduler().runTaskAsync(
+        plugin_command->getPlugin(),
+        [command = command_, proxy, args, latency = async_latency_, start = std::chrono::steady_clock::now()]() {
+            command->execute(*proxy, args);
+            latency->record(std::chrono::steady_clock::now() - start);
+        });
+    return task != nullptr;
+}
+
+const LatencyTracker &CommandWrapper::getAsyncLatency() const
+{
+    return *async_latency_;
+}
+
 std::unique_ptr<CommandOrigin> CommandWrapper::getCommandOrigin(CommandSender &sender)
 {
     const auto &server = entt::locator<EndstoneServer>::value();
@@ -16,22 +16,34 @@
 
 #include "bedrock/server/commands/minecraft_commands.h"
 #include "endstone/command/command.h"
+#include "endstone/core/command/command_output_with_sender.h"
+#include "endstone/core/util/latency_tracker.h"
 
 namespace endstone::core {
 
 class CommandWrapper : public Command {
 public:
-    CommandWrapper(MinecraftCommands &minecraft_commands, std::shared_ptr<Command> command);
+    CommandWrapper(MinecraftCommands &minecraft_commands, LatencyTracker &compile_latency,
+                   std::shared_ptr<Command> command);
 
     [[nodiscard]] bool execute(CommandSender &sender, const std::vector<std::string> &args) const override;
+    [[nodiscard]] bool execute(CommandSender &sender, const std::vector<std::string> &args, CommandOrigin &origin,
+                               CommandOutputWithSender &output) const;
     [[nodiscard]] PluginCommand *asPluginCommand() const override;
     [[nodiscard]] Command &unwrap() const;
+    [[nodiscard]] bool executeWrapped(CommandSender &sender, const std::vector<std::string> &args) const;
+    [[nodiscard]] const LatencyTracker &getAsyncLatency() const;
 
     static std::unique_ptr<CommandOrigin> getCommandOrigin(CommandSender &sender);
 
 private:
+    [[nodiscard]] bool run(CommandSender &sender, const std::vector<std::string> &args, CommandOrigin &origin,
+                           CommandOutputWithSender &output) const;
+
     MinecraftCommands &minecraft_commands_;
+    LatencyTracker &compile_latency_;
     std::shared_ptr<Command> command_;
+    std::shared_ptr<LatencyTracker> async_latency_;
 };
 
 }  // namespace endstone::core
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "bedrock/deps/raknet/socket_includes.h"
+#include "endstone/core/ban/cidr_tree.h"
 #include "endstone/core/server.h"
 
 namespace endstone::core {
@@ -51,6 +52,9 @@ bool BanIpCommand::execute(CommandSender &sender, const std::vector<std::string>
     else if (sockaddr_in6 sa_v6{}; inet_pton(AF_INET6, name_or_address.c_str(), &(sa_v6.sin6_addr)) == 1) {
         address = name_or_address;
     }
+    else if (CidrTree::isRange(name_or_address)) {
+        address = name_or_address;
+    }
     else if (player = server.getPlayer(name_or_address); player) {
         address = player->getAddress().getHostname();
     }
@@ -79,7 +83,7 @@ bool BanIpCommand::execute(CommandSender &sender, const std::vector<std::string>
     }
 
     for (const auto &online_player : server.getOnlinePlayers()) {
-        if (online_player->getAddress().getHostname() == address) {
+        if (ban_list.isBanned(online_player->getAddress().getHostname())) {
             online_player->kick("You have been IP banned from this server.");
         }
     }
@@ -0,0 +1,137 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/command/defaults/netstats_command.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "endstone/color_format.h"
+#include "endstone/core/server.h"
+
+namespace endstone::core {
+
+namespace {
+constexpr std::size_t MaxEntries = 5;
+
+void sendStats(CommandSender &sender, const std::string &label, const NetworkStats &stats)
+{
+    sender.sendMessage("{}{}: {}{:.1f} KiB/s up, {:.1f} KiB/s down {}({:.1f} MiB / {} datagrams sent, "
+                       "{:.1f} MiB / {} datagrams received, {:.1f} MiB resent, {:.2f}% loss)",
+                       ColorFormat::Gold, label, ColorFormat::Red, static_cast<double>(stats.getSendRate()) / 1024,
+                       static_cast<double>(stats.getReceiveRate()) / 1024, ColorFormat::Gold,
+                       static_cast<double>(stats.getBytesSent()) / (1024 * 1024), stats.getPacketsSent(),
+                       static_cast<double>(stats.getBytesReceived()) / (1024 * 1024), stats.getPacketsReceived(),
+                       static_cast<double>(stats.getBytesResent()) / (1024 * 1024), stats.getPacketLoss() * 100);
+}
+
+// game packet types with the most bytes in each direction
+void sendPacketTypeStats(CommandSender &sender, std::vector<PacketTypeStats> stats)
+{
+    for (const auto outbound : {true, false}) {
+        const auto bytes = [outbound](const PacketTypeStats &s) {
+            return outbound ? s.getBytesSent() : s.getBytesReceived();
+        };
+        const auto num_types = std::min(stats.size(), MaxEntries);
+        std::partial_sort(stats.begin(), stats.begin() + static_cast<std::ptrdiff_t>(num_types), stats.end(),
+                          [&](const auto &a, const auto &b) { return bytes(a) > bytes(b); });
+
+        sender.sendMessage("{}{} game packets:", ColorFormat::Green, outbound ? "Outbound" : "Inbound");
+        for (std::size_t i = 0; i < num_types && bytes(stats[i]) > 0; ++i) {
+            const auto &type = stats[i];
+            sender.sendMessage("{}{} ({}): {}{:.1f} MiB {}({} packets)", ColorFormat::Gold,
+                               type.getName().empty() ? "Unknown" : type.getName(), type.getId(), ColorFormat::Red,
+                               static_cast<double>(bytes(type)) / (1024 * 1024), ColorFormat::Gold,
+                               outbound ? type.getPacketsSent() : type.getPacketsReceived());
+        }
+    }
+}
+}  // namespace
+
+NetStatsCommand::NetStatsCommand() : EndstoneCommand("netstats")
+{
+    setDescription("Gets the network statistics of the server or a player.");
+    setUsages("/netstats [player: player]");
+    setPermissions("endstone.command.netstats");
+}
+
+bool NetStatsCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    if (!args.empty()) {
+        const auto *player = server.getPlayer(args.front());
+        if (!player) {
+            sender.sendErrorMessage("No player was found.");
+            return true;
+        }
+        sendStats(sender, player->getName(), player->getNetworkStats());
+        sendPacketTypeStats(sender, player->getPacketTypeStats());
+        return true;
+    }
+
+    sender.sendMessage("{}---- {}Network statistics{} ----", ColorFormat::Green, ColorFormat::Reset,
+                       ColorFormat::Green);
+    sendStats(sender, "Total", server.getNetworkStats());
+
+    // players with the highest send rate
+    std::vector<std::pair<Player *, NetworkStats>> players;
+    for (auto *player : server.getOnlinePlayers()) {
+        players.emplace_back(player, player->getNetworkStats());
+    }
+    const auto num_players = std::min(players.size(), MaxEntries);
+    std::partial_sort(players.begin(), players.begin() + static_cast<std::ptrdiff_t>(num_players), players.end(),
+                      [](const auto &a, const auto &b) { return a.second.getSendRate() > b.second.getSendRate(); });
+    for (std::size_t i = 0; i < num_players; ++i) {
+        sendStats(sender, players[i].first->getName(), players[i].second);
+    }
+
+    // RakNet message IDs with the most bytes in each direction since the server started
+    auto &datagram_stats = server.getDatagramStats();
+    for (const auto direction : {DatagramStats::Direction::Outbound, DatagramStats::Direction::Inbound}) {
+        std::vector<std::pair<std::uint8_t, DatagramStats::Counter>> counters;
+        for (int id = 0; id < 256; ++id) {
+            const auto counter = datagram_stats.get(direction, static_cast<std::uint8_t>(id));
+            if (counter.datagrams > 0) {
+                counters.emplace_back(static_cast<std::uint8_t>(id), counter);
+            }
+        }
+        const auto num_counters = std::min(counters.size(), MaxEntries);
+        std::partial_sort(counters.begin(), counters.begin() + static_cast<std::ptrdiff_t>(num_counters),
+                          counters.end(), [](const auto &a, const auto &b) { return a.second.bytes > b.second.bytes; });
+
+        sender.sendMessage("{}{} datagrams:", ColorFormat::Green,
+                           direction == DatagramStats::Direction::Outbound ? "Outbound" : "Inbound");
+        for (std::size_t i = 0; i < num_counters; ++i) {
+            const auto &[id, counter] = counters[i];
+            sender.sendMessage("{}{} (0x{:02x}): {}{:.1f} MiB {}({} datagrams)", ColorFormat::Gold,
+                               DatagramStats::getName(id), id, ColorFormat::Red,
+                               static_cast<double>(counter.bytes) / (1024 * 1024), ColorFormat::Gold,
+                               counter.datagrams);
+        }
+    }
+
+    sendPacketTypeStats(sender, server.getPacketTypeStats());
+    return true;
+}
+
+}  // namespace endstone::core
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "bedrock/deps/raknet/socket_includes.h"
+#include "endstone/core/ban/cidr_tree.h"
 #include "endstone/core/server.h"
 
 namespace endstone::core {
@@ -50,6 +51,9 @@ bool PardonIpCommand::execute(CommandSender &sender, const std::vector<std::stri
     else if (sockaddr_in6 sa_v6{}; inet_pton(AF_INET6, address.c_str(), &(sa_v6.sin6_addr)) == 1) {
         // valid ipv6 address
     }
+    else if (CidrTree::isRange(address)) {
+        // valid address range
+    }
     else {
         sender.sendErrorMessage(Translatable{"commands.unbanip.invalid"});
         return true;
@@ -60,6 +64,11 @@ bool PardonIpCommand::execute(CommandSender &sender, const std::vector<std::stri
         sender.sendErrorMessage("Nothing changed. That IP is not banned.");
         return true;
     }
+    if (entry->getAddress() != address) {
+        // the address is only covered by a banned range, which has to be pardoned as a whole
+        sender.sendErrorMessage("Nothing changed. That IP is banned by the range {}.", entry->getAddress());
+        return true;
+    }
 
     sender.sendMessage(Translatable{"commands.unbanip.success", {entry->getAddress()}});
     ban_list.removeBan(address);
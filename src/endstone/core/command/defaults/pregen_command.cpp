@@ -0,0 +1,131 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/command/defaults/pregen_command.h"
+
+#include <optional>
+#include <string>
+
+#include <entt/entt.hpp>
+
+#include "endstone/color_format.h"
+#include "endstone/core/server.h"
+
+namespace endstone::core {
+
+namespace {
+constexpr int MaxRadius = 1024;
+constexpr float DefaultMinTicksPerSecond = 18.0F;
+
+void sendProgress(CommandSender &sender, const ChunkLoadTask &task)
+{
+    const auto total = task.getTotalChunks();
+    const auto loaded = task.getLoadedChunks();
+    sender.sendMessage("{}Chunks loaded: {}{}/{} ({:.1f}%) {}at {:.1f} chunks/s, minimum TPS {:.1f}",
+                       ColorFormat::Gold, ColorFormat::Red, loaded, total,
+                       100.0 * static_cast<double>(loaded) / static_cast<double>(total), ColorFormat::Gold,
+                       task.getChunksPerSecond(), task.getMinTicksPerSecond());
+}
+}  // namespace
+
+PregenCommand::PregenCommand() : EndstoneCommand("pregen")
+{
+    setDescription("Loads or generates the chunks around you, or around the world origin from the console.");
+    setUsages("/pregen <radius: int> [min_tps: float]", "/pregen (status|stop)<action: PregenAction>");
+    setPermissions("endstone.command.pregen");
+}
+
+bool PregenCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    const auto running = task_ && !task_->isDone();
+    if (args.empty() || args[0] == "status") {
+        if (!task_) {
+            sender.sendErrorMessage("No chunks are being loaded.");
+            return true;
+        }
+        sendProgress(sender, *task_);
+        return true;
+    }
+    if (args[0] == "stop") {
+        if (!running) {
+            sender.sendErrorMessage("No chunks are being loaded.");
+            return true;
+        }
+        task_->cancel();
+        sender.sendMessage("Stopped loading chunks.");
+        return true;
+    }
+    if (running) {
+        sender.sendErrorMessage("Chunks are already being loaded, use /pregen stop first.");
+        return true;
+    }
+
+    const auto radius = std::stoi(args[0]);
+    const auto min_tps = args.size() > 1 ? std::stof(args[1]) : DefaultMinTicksPerSecond;
+    if (radius < 0 || radius > MaxRadius) {
+        sender.sendErrorMessage("The radius must be between 0 and {} chunks.", MaxRadius);
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    Dimension *dimension = nullptr;
+    auto center_x = 0;
+    auto center_z = 0;
+    std::optional<UUID> player_id;
+    if (const auto *player = sender.asPlayer(); player) {
+        const auto location = player->getLocation();
+        dimension = location.getDimension();
+        center_x = location.getBlockX() >> 4;
+        center_z = location.getBlockZ() >> 4;
+        player_id = player->getUniqueId();
+    }
+    else if (auto *level = server.getLevel(); level) {
+        dimension = level->getDimension("overworld");
+    }
+    if (!dimension) {
+        sender.sendErrorMessage("No dimension to load chunks in.");
+        return true;
+    }
+
+    auto result =
+        dimension->loadChunksAsync(center_x - radius, center_z - radius, center_x + radius, center_z + radius);
+    if (!result) {
+        sender.sendErrorMessage("{}", result.error().getMessage());
+        return true;
+    }
+
+    task_ = result.value();
+    task_->setMinTicksPerSecond(min_tps);
+    sender.sendMessage("Loading {} chunks around chunk ({}, {}) in {}...", task_->getTotalChunks(), center_x, center_z,
+                       dimension->getName());
+    task_->whenComplete([&server, player_id](ChunkLoadTask &task) {
+        // the player may have left in the meantime
+        CommandSender *target = &server.getCommandSender();
+        if (player_id.has_value()) {
+            target = server.getPlayer(player_id.value());
+        }
+        if (target) {
+            target->sendMessage("{}Finished loading chunks{}.", ColorFormat::Green,
+                                task.isCancelled() ? " (cancelled)" : "");
+            sendProgress(*target, task);
+        }
+    });
+    return true;
+}
+
+}  // namespace endstone::core
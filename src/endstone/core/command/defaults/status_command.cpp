@@ -14,6 +14,9 @@
 
 #include "endstone/core/command/defaults/status_command.h"
 
+#include <cstdint>
+#include <numeric>
+
 #include <entt/entt.hpp>
 
 #include "endstone/color_format.h"
@@ -68,6 +71,54 @@ bool StatusCommand::execute(CommandSender &sender, const std::vector<std::string
     sender.sendMessage("{}TPS: {}{:.2f}", ColorFormat::Gold, color, server.getAverageTicksPerSecond());
     sender.sendMessage("{}Usage: {}{:.2f}%", ColorFormat::Gold, color, server.getAverageTickUsage() * 100);
 
+    const auto &compile_latency = server.getCommandMap().getCompileLatency();
+    sender.sendMessage("{}Command compiles: {}{} {}(p50 {:.3f} ms, p99 {:.3f} ms)", ColorFormat::Gold, ColorFormat::Red,
+                       compile_latency.getCount(), ColorFormat::Gold, compile_latency.getPercentile(50).count(),
+                       compile_latency.getPercentile(99).count());
+
+    const auto block_data_stats = server.getBlockDataCache().getStats();
+    sender.sendMessage("{}Block data cache: {}{:.2f}% hits {}({} hits, {} misses, {}/{} entries)", ColorFormat::Gold,
+                       ColorFormat::Red, block_data_stats.getHitRate() * 100, ColorFormat::Gold, block_data_stats.hits,
+                       block_data_stats.misses, block_data_stats.size, block_data_stats.capacity);
+
+    const auto update_stats = server.getCommandUpdateQueue().getStats();
+    sender.sendMessage("{}Command updates: {}{} sent {}({} requests coalesced, {} pending)", ColorFormat::Gold,
+                       ColorFormat::Red, update_stats.sent, ColorFormat::Gold, update_stats.coalesced,
+                       update_stats.pending);
+
+    const auto &batch_stats = server.getPacketBatchStats();
+    sender.sendMessage(
+        "{}Packet batches: {}{:.2f} packets/flush, {:.0f} bytes/flush {}({} flushes, max {} packets, {} bytes)",
+        ColorFormat::Gold, ColorFormat::Red, batch_stats.getAveragePackets(), batch_stats.getAverageBytes(),
+        ColorFormat::Gold, batch_stats.flushes, batch_stats.max_packets, batch_stats.max_bytes);
+
+    const auto pipeline_stats = server.getPacketPipeline().getStats();
+    sender.sendMessage("{}Packet listeners: {}{} packets dispatched {}({} modified)", ColorFormat::Gold,
+                       ColorFormat::Red, pipeline_stats.dispatched, ColorFormat::Gold, pipeline_stats.modified);
+
+    const auto limiter_stats = server.getPacketRateLimiter().getStats();
+    const auto accepted =
+        std::accumulate(limiter_stats.accepted.begin(), limiter_stats.accepted.end(), std::uint64_t{0});
+    const auto dropped = std::accumulate(limiter_stats.dropped.begin(), limiter_stats.dropped.end(), std::uint64_t{0});
+    sender.sendMessage("{}Rate limiter: {}{} dropped {}({} accepted, {} peers blocked, {} peers tracked)",
+                       ColorFormat::Gold, ColorFormat::Red, dropped, ColorFormat::Gold, accepted, limiter_stats.blocked,
+                       limiter_stats.peers);
+
+    const auto ping_stats = server.getServerListPing().getStats();
+    sender.sendMessage("{}Server list pings: {}{} cached {}({} rendered, {} answered directly)", ColorFormat::Gold,
+                       ColorFormat::Red, ping_stats.hits, ColorFormat::Gold, ping_stats.misses, ping_stats.replies);
+
+    for (const auto *command : server.getCommandMap().getCommands()) {
+        const auto &latency = command->getAsyncLatency();
+        if (!command->isAsync() || latency.getCount() == 0) {
+            continue;
+        }
+        sender.sendMessage("{}/{}: {}p50 {:.2f}ms, p95 {:.2f}ms, p99 {:.2f}ms {}({} runs)", ColorFormat::Gold,
+                           command->getName(), ColorFormat::Red, latency.getPercentile(50).count(),
+                           latency.getPercentile(95).count(), latency.getPercentile(99).count(), ColorFormat::Gold,
+                           latency.getCount());
+    }
+
     return true;
 }
 
@@ -37,7 +37,7 @@ void MinecraftCommandAdapter::execute(const CommandOrigin &origin, CommandOutput
 
     // We already have a sender passed down from CommandWrapper::execute
     if (output.has_command_sender) {
-        if (command->unwrap().execute(static_cast<CommandOutputWithSender &>(output).sender_, args_)) {
+        if (command->executeWrapped(static_cast<CommandOutputWithSender &>(output).sender_, args_)) {
             output.success();
         }
         return;
@@ -51,7 +51,7 @@ void MinecraftCommandAdapter::execute(const CommandOrigin &origin, CommandOutput
         wrapper->init();
         sender = wrapper;
     }
-    if (command->unwrap().execute(*sender, args_)) {
+    if (command->executeWrapped(*sender, args_)) {
         output.success();
     }
 }
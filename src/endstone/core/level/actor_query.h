@@ -12,24 +12,24 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "bedrock/core/utility/binary_stream.h"
-#include "endstone/core/network/packet_codec.h"
-#include "endstone/network/spawn_particle_effect_packet.h"
+
+#pragma once
+
+#include <algorithm>
+
+#include "endstone/util/vector.h"
 
 namespace endstone::core {
-template <>
-void PacketCodec::encode(BinaryStream &stream, SpawnParticleEffectPacket &packet)
+
+/**
+ * Squared distance from a point to the closest point of a box, 0 if the point is inside the box.
+ */
+inline float distanceSquaredToBox(const Vector<float> &point, const Vector<float> &min, const Vector<float> &max)
 {
-    stream.writeByte(packet.dimension_id);
-    stream.writeVarInt64(packet.actor_id);
-    stream.writeFloat(packet.position.getX());
-    stream.writeFloat(packet.position.getY());
-    stream.writeFloat(packet.position.getZ());
-    stream.writeString(packet.effect_name);
-    stream.writeBool(packet.molang_variables_json.has_value());
-    if (packet.molang_variables_json.has_value()) {
-        stream.writeString(packet.molang_variables_json.value());
-    }
+    const auto dx = std::max({min.getX() - point.getX(), 0.0F, point.getX() - max.getX()});
+    const auto dy = std::max({min.getY() - point.getY(), 0.0F, point.getY() - max.getY()});
+    const auto dz = std::max({min.getZ() - point.getZ(), 0.0F, point.getZ() - max.getZ()});
+    return dx * dx + dy * dy + dz * dz;
 }
 
 }  // namespace endstone::core
@@ -0,0 +1,181 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/level/chunk_load_task.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace endstone::core {
+
+EndstoneChunkLoadTask::EndstoneChunkLoadTask(int min_x, int min_z, int max_x, int max_z, int batch_size)
+{
+    const auto batches = planBatches(min_x, min_z, max_x, max_z, batch_size);
+    pending_.assign(batches.begin(), batches.end());
+    total_ = ChunkLoadBatch{min_x, min_z, max_x, max_z}.size();
+}
+
+std::size_t EndstoneChunkLoadTask::getTotalChunks() const
+{
+    return total_;
+}
+
+std::size_t EndstoneChunkLoadTask::getLoadedChunks() const
+{
+    std::lock_guard lock(mutex_);
+    return loaded_;
+}
+
+float EndstoneChunkLoadTask::getChunksPerSecond() const
+{
+    std::lock_guard lock(mutex_);
+    if (!start_time_.has_value()) {
+        return 0.0F;
+    }
+    const auto end = done_ ? end_time_ : Clock::now();
+    const auto seconds = std::chrono::duration<float>(end - start_time_.value()).count();
+    return seconds > 0.0F ? static_cast<float>(loaded_) / seconds : 0.0F;
+}
+
+float EndstoneChunkLoadTask::getMinTicksPerSecond() const
+{
+    std::lock_guard lock(mutex_);
+    return min_tps_;
+}
+
+void EndstoneChunkLoadTask::setMinTicksPerSecond(float min_tps)
+{
+    std::lock_guard lock(mutex_);
+    min_tps_ = std::max(0.0F, min_tps);
+}
+
+bool EndstoneChunkLoadTask::isDone() const
+{
+    std::lock_guard lock(mutex_);
+    return done_;
+}
+
+bool EndstoneChunkLoadTask::isCancelled() const
+{
+    std::lock_guard lock(mutex_);
+    return cancelled_;
+}
+
+void EndstoneChunkLoadTask::cancel()
+{
+    // the task completes on the server thread, once the batches in progress have finished
+    std::lock_guard lock(mutex_);
+    if (done_ || cancelled_) {
+        return;
+    }
+    cancelled_ = true;
+    pending_.clear();
+}
+
+void EndstoneChunkLoadTask::whenComplete(std::function<void(ChunkLoadTask &)> callback)
+{
+    if (!callback) {
+        return;
+    }
+    {
+        std::lock_guard lock(mutex_);
+        if (!done_) {
+            callbacks_.emplace_back(std::move(callback));
+            return;
+        }
+    }
+    callback(*this);
+}
+
+std::optional<ChunkLoadBatch> EndstoneChunkLoadTask::nextBatch()
+{
+    std::lock_guard lock(mutex_);
+    if (pending_.empty()) {
+        return std::nullopt;
+    }
+    if (!start_time_.has_value()) {
+        start_time_ = Clock::now();
+    }
+    const auto batch = pending_.front();
+    pending_.pop_front();
+    in_flight_++;
+    return batch;
+}
+
+void EndstoneChunkLoadTask::retryBatch(const ChunkLoadBatch &batch)
+{
+    std::unique_lock lock(mutex_);
+    in_flight_--;
+    if (!cancelled_) {
+        pending_.push_front(batch);
+        return;
+    }
+    completeIfFinished(lock);
+}
+
+void EndstoneChunkLoadTask::finishBatch(const ChunkLoadBatch &batch, std::size_t loaded)
+{
+    std::unique_lock lock(mutex_);
+    in_flight_--;
+    loaded_ += std::min(loaded, batch.size());
+    completeIfFinished(lock);
+}
+
+void EndstoneChunkLoadTask::update()
+{
+    std::unique_lock lock(mutex_);
+    completeIfFinished(lock);
+}
+
+std::vector<ChunkLoadBatch> EndstoneChunkLoadTask::planBatches(int min_x, int min_z, int max_x, int max_z,
+                                                               int batch_size)
+{
+    batch_size = std::max(1, batch_size);
+    std::vector<ChunkLoadBatch> batches;
+    for (auto x = min_x; x <= max_x; x += batch_size) {
+        for (auto z = min_z; z <= max_z; z += batch_size) {
+            batches.push_back({x, z, std::min(max_x, x + batch_size - 1), std::min(max_z, z + batch_size - 1)});
+        }
+    }
+
+    // load the center of the area first, it is usually where the players are
+    const auto distance = [center_x = static_cast<long long>(min_x) + max_x,
+                           center_z = static_cast<long long>(min_z) + max_z](const ChunkLoadBatch &batch) {
+        const auto dx = static_cast<long long>(batch.min_x) + batch.max_x - center_x;
+        const auto dz = static_cast<long long>(batch.min_z) + batch.max_z - center_z;
+        return dx * dx + dz * dz;
+    };
+    std::stable_sort(batches.begin(), batches.end(),
+                     [&](const auto &lhs, const auto &rhs) { return distance(lhs) < distance(rhs); });
+    return batches;
+}
+
+void EndstoneChunkLoadTask::completeIfFinished(std::unique_lock<std::mutex> &lock)
+{
+    if (done_ || !pending_.empty() || in_flight_ > 0) {
+        return;
+    }
+    done_ = true;
+    end_time_ = Clock::now();
+    auto callbacks = std::move(callbacks_);
+    callbacks_.clear();
+
+    // callbacks may query the task
+    lock.unlock();
+    for (const auto &callback : callbacks) {
+        callback(*this);
+    }
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,107 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "endstone/level/chunk_load_task.h"
+
+namespace endstone::core {
+
+/**
+ * A rectangle of chunks loaded together, bounds inclusive.
+ */
+struct ChunkLoadBatch {
+    int min_x;
+    int min_z;
+    int max_x;
+    int max_z;
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return static_cast<std::size_t>(max_x - min_x + 1) * static_cast<std::size_t>(max_z - min_z + 1);
+    }
+};
+
+/**
+ * Keeps track of the batches and the progress of a chunk load request. The batches are driven by the ChunkLoader.
+ *
+ * The state is guarded by a mutex, so plugins may query or cancel a task from any thread. The task only completes on
+ * the server thread, so the callbacks always run there.
+ */
+class EndstoneChunkLoadTask : public ChunkLoadTask {
+public:
+    EndstoneChunkLoadTask(int min_x, int min_z, int max_x, int max_z, int batch_size);
+
+    [[nodiscard]] std::size_t getTotalChunks() const override;
+    [[nodiscard]] std::size_t getLoadedChunks() const override;
+    [[nodiscard]] float getChunksPerSecond() const override;
+    [[nodiscard]] float getMinTicksPerSecond() const override;
+    void setMinTicksPerSecond(float min_tps) override;
+    [[nodiscard]] bool isDone() const override;
+    [[nodiscard]] bool isCancelled() const override;
+    void cancel() override;
+    void whenComplete(std::function<void(ChunkLoadTask &)> callback) override;
+
+    /**
+     * Takes the next batch to load, or std::nullopt if there is none left.
+     */
+    std::optional<ChunkLoadBatch> nextBatch();
+
+    /**
+     * Puts back a batch taken with nextBatch that could not be started, so that it is the next one to be taken.
+     */
+    void retryBatch(const ChunkLoadBatch &batch);
+
+    /**
+     * Records that a batch taken with nextBatch has finished, with the given number of chunks loaded.
+     */
+    void finishBatch(const ChunkLoadBatch &batch, std::size_t loaded);
+
+    /**
+     * Completes the task if it was cancelled while no batch was in progress. Called by the ChunkLoader every tick.
+     */
+    void update();
+
+    /**
+     * Splits an area into square batches of at most batch_size by batch_size chunks, closest to the center first.
+     */
+    static std::vector<ChunkLoadBatch> planBatches(int min_x, int min_z, int max_x, int max_z, int batch_size);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void completeIfFinished(std::unique_lock<std::mutex> &lock);
+
+    mutable std::mutex mutex_;
+    std::deque<ChunkLoadBatch> pending_;
+    std::size_t total_;
+    std::size_t loaded_{0};
+    std::size_t in_flight_{0};
+    float min_tps_{0.0F};
+    bool cancelled_{false};
+    bool done_{false};
+    std::optional<Clock::time_point> start_time_;
+    Clock::time_point end_time_;
+    std::vector<std::function<void(ChunkLoadTask &)>> callbacks_;
+};
+
+}  // namespace endstone::core
@@ -0,0 +1,219 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/level/chunk_loader.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "bedrock/world/level/level.h"
+#include "endstone/command/command_sender_wrapper.h"
+#include "endstone/core/level/dimension.h"
+#include "endstone/core/server.h"
+
+namespace endstone::core {
+
+namespace {
+const char *getCommandName(const EndstoneDimension &dimension)
+{
+    switch (dimension.getType()) {
+    case Dimension::Type::Overworld:
+        return "overworld";
+    case Dimension::Type::Nether:
+        return "nether";
+    case Dimension::Type::TheEnd:
+        return "the_end";
+    default:
+        return nullptr;
+    }
+}
+}  // namespace
+
+ChunkLoader::ChunkLoader(EndstoneServer &server) : server_(server) {}
+
+void ChunkLoader::start()
+{
+    for (auto *dimension : server_.getLevel()->getDimensions()) {
+        for (std::size_t i = 0; i < slots_.size(); ++i) {
+            runCommand(static_cast<EndstoneDimension &>(*dimension),
+                       fmt::format("tickingarea remove {}", getAreaName(i)));
+        }
+    }
+}
+
+void ChunkLoader::stop()
+{
+    for (std::size_t i = 0; i < slots_.size(); ++i) {
+        if (auto task = slots_[i].task) {
+            const auto batch = slots_[i].batch;
+            const auto loaded = countLoadedChunks(slots_[i]);
+            releaseSlot(i);
+            task->cancel();
+            task->finishBatch(batch, loaded);
+        }
+    }
+    for (const auto &request : requests_) {
+        request.task->cancel();
+        request.task->update();
+    }
+    requests_.clear();
+}
+
+std::shared_ptr<EndstoneChunkLoadTask> ChunkLoader::submit(EndstoneDimension &dimension, int min_x, int min_z,
+                                                           int max_x, int max_z)
+{
+    auto task = std::make_shared<EndstoneChunkLoadTask>(min_x, min_z, max_x, max_z, BatchSize);
+    requests_.push_back({task, &dimension});
+    return task;
+}
+
+void ChunkLoader::tick(std::uint64_t current_tick)
+{
+    if (requests_.empty()) {
+        return;
+    }
+
+    // check the batches in progress
+    for (std::size_t i = 0; i < slots_.size(); ++i) {
+        auto &slot = slots_[i];
+        if (!slot.task) {
+            continue;
+        }
+        const auto loaded = countLoadedChunks(slot);
+        if (slot.task->isCancelled() || loaded == slot.batch.size() ||
+            current_tick - slot.start_tick >= BatchTimeoutTicks) {
+            slot.task->finishBatch(slot.batch, loaded);
+            releaseSlot(i);
+        }
+    }
+
+    for (const auto &request : requests_) {
+        request.task->update();
+    }
+    std::erase_if(requests_, [](const auto &request) { return request.task->isDone(); });
+    if (requests_.empty() || current_tick < retry_tick_) {
+        return;
+    }
+
+    // start new batches, taking turns between the requests that are allowed to run at the current tps
+    const auto tps = server_.getAverageTicksPerSecond();
+    for (std::size_t i = 0; i < slots_.size(); ++i) {
+        if (slots_[i].task) {
+            continue;
+        }
+
+        bool started = false;
+        for (std::size_t n = 0; n < requests_.size() && !started; ++n) {
+            auto &request = requests_[(next_request_ + n) % requests_.size()];
+            if (tps < request.task->getMinTicksPerSecond()) {
+                continue;
+            }
+            started = startBatch(i, request, current_tick);
+            if (started) {
+                next_request_ = (next_request_ + n + 1) % requests_.size();
+            }
+        }
+        if (!started) {
+            break;
+        }
+    }
+}
+
+std::size_t ChunkLoader::getQueuedTasks() const
+{
+    return requests_.size();
+}
+
+std::size_t ChunkLoader::getActiveBatches() const
+{
+    return std::count_if(slots_.begin(), slots_.end(), [](const auto &slot) { return slot.task != nullptr; });
+}
+
+std::size_t ChunkLoader::countLoadedChunks(const Slot &slot) const
+{
+    auto &block_source = slot.dimension->getHandle().getBlockSourceFromMainChunkSource();
+    const auto current_level_tick = block_source.getLevel().getCurrentTick();
+    std::size_t loaded = 0;
+    for (auto x = slot.batch.min_x; x <= slot.batch.max_x; ++x) {
+        for (auto z = slot.batch.min_z; z <= slot.batch.max_z; ++z) {
+            // a chunk only starts ticking once it has been fully loaded or generated
+            const auto *chunk = block_source.getChunk(x, z);
+            if (!chunk) {
+                continue;
+            }
+            const auto chunk_last_tick = chunk->getLastTick();
+            if (current_level_tick == chunk_last_tick || current_level_tick == chunk_last_tick + 1) {
+                loaded++;
+            }
+        }
+    }
+    return loaded;
+}
+
+bool ChunkLoader::startBatch(std::size_t index, Request &request, std::uint64_t current_tick)
+{
+    while (auto batch = request.task->nextBatch()) {
+        auto &slot = slots_[index];
+        slot = {request.task, request.dimension, batch.value(), current_tick};
+
+        // skip the batches that are already loaded, e.g. around the players
+        const auto loaded = countLoadedChunks(slot);
+        if (loaded == batch->size()) {
+            request.task->finishBatch(batch.value(), loaded);
+            slot = {};
+            continue;
+        }
+
+        const auto command =
+            fmt::format("tickingarea add {} 0 {} {} 0 {} {} true", batch->min_x << 4, batch->min_z << 4,
+                        (batch->max_x << 4) + 15, (batch->max_z << 4) + 15, getAreaName(index));
+        if (!runCommand(*request.dimension, command)) {
+            // most likely the limit of ticking areas has been reached, try again later
+            request.task->retryBatch(batch.value());
+            slot = {};
+            retry_tick_ = current_tick + RetryDelayTicks;
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void ChunkLoader::releaseSlot(std::size_t index)
+{
+    auto &slot = slots_[index];
+    runCommand(*slot.dimension, fmt::format("tickingarea remove {}", getAreaName(index)));
+    slot = {};
+}
+
+bool ChunkLoader::runCommand(const EndstoneDimension &dimension, const std::string &command) const
+{
+    const auto *name = getCommandName(dimension);
+    if (!name) {
+        return false;
+    }
+
+    // the output of the command is discarded, only whether it succeeded matters
+    CommandSenderWrapper sender(server_.getCommandSender());
+    return server_.dispatchCommand(sender, fmt::format("execute in {} run {}", name, command));
+}
+
+std::string ChunkLoader::getAreaName(std::size_t index)
+{
+    return fmt::format("endstone_pregen_{}", index);
+}
+
+}  // namespace endstone::core
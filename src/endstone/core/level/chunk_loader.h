@@ -0,0 +1,98 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "endstone/core/level/chunk_load_task.h"
+
+namespace endstone::core {
+
+class EndstoneDimension;
+class EndstoneServer;
+
+/**
+ * Loads the chunks requested with Dimension::loadChunksAsync, a few batches at a time.
+ *
+ * Each batch is loaded by a vanilla ticking area with preloading enabled, which makes the chunk source of the
+ * dimension load or generate the chunks. Once every chunk of the batch is ticking, the ticking area is removed and the
+ * chunks are left for the server to unload as usual. The ticking areas are named after the slot they occupy, so that
+ * areas left behind by a crash are replaced rather than leaked.
+ *
+ * The loader is driven by the server thread. Ticking areas are saved with the level, so the areas of every slot are
+ * removed when the level is loaded and again when the server stops.
+ */
+class ChunkLoader {
+public:
+    explicit ChunkLoader(EndstoneServer &server);
+
+    /**
+     * Removes the ticking areas left behind if the server stopped while loading chunks. Requires the level and the
+     * command map.
+     */
+    void start();
+
+    /**
+     * Cancels every task and removes the ticking areas of the batches in progress.
+     */
+    void stop();
+
+    std::shared_ptr<EndstoneChunkLoadTask> submit(EndstoneDimension &dimension, int min_x, int min_z, int max_x,
+                                                  int max_z);
+    void tick(std::uint64_t current_tick);
+    [[nodiscard]] std::size_t getQueuedTasks() const;
+    [[nodiscard]] std::size_t getActiveBatches() const;
+
+    // 64 chunks per batch, within the limit of 100 chunks per ticking area
+    static constexpr int BatchSize = 8;
+    // out of the 10 ticking areas allowed per dimension
+    static constexpr int MaxConcurrentBatches = 4;
+    // give up on chunks that fail to load within a minute
+    static constexpr int BatchTimeoutTicks = 1200;
+    // wait before retrying when no ticking area could be added
+    static constexpr int RetryDelayTicks = 100;
+
+private:
+    struct Request {
+        std::shared_ptr<EndstoneChunkLoadTask> task;
+        EndstoneDimension *dimension;
+    };
+
+    struct Slot {
+        std::shared_ptr<EndstoneChunkLoadTask> task;
+        EndstoneDimension *dimension;
+        ChunkLoadBatch batch;
+        std::uint64_t start_tick;
+    };
+
+    [[nodiscard]] std::size_t countLoadedChunks(const Slot &slot) const;
+    bool startBatch(std::size_t index, Request &request, std::uint64_t current_tick);
+    void releaseSlot(std::size_t index);
+    bool runCommand(const EndstoneDimension &dimension, const std::string &command) const;
+    static std::string getAreaName(std::size_t index);
+
+    EndstoneServer &server_;
+    std::vector<Request> requests_;
+    std::array<Slot, MaxConcurrentBatches> slots_{};
+    std::size_t next_request_{0};
+    std::uint64_t retry_tick_{0};
+};
+
+}  // namespace endstone::core
@@ -14,12 +14,202 @@
 
 #include "endstone/core/level/dimension.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "bedrock/nbt/compound_tag.h"
+#include "bedrock/world/actor/actor.h"
 #include "bedrock/world/level/dimension/vanilla_dimensions.h"
+#include "bedrock/world/level/level.h"
+#include "bedrock/world/phys/aabb.h"
+#include "endstone/core/actor/actor.h"
 #include "endstone/core/block/block.h"
+#include "endstone/core/block/block_data.h"
+#include "endstone/core/level/actor_query.h"
+#include "endstone/core/level/chunk_loader.h"
 #include "endstone/core/level/level.h"
+#include "endstone/core/level/ray_trace.h"
+#include "endstone/core/util/error.h"
 
 namespace endstone::core {
 
+namespace {
+constexpr int UpdateNeighbors = 1;
+constexpr int UpdateNetwork = 2;
+constexpr std::size_t MaxChunkLoadArea = 4096 * 4096;
+constexpr int NeighbourOffsets[6][3] = {{0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}, {-1, 0, 0}, {1, 0, 0}};
+
+// Checks that the cuboid is within the world boundaries and that every chunk it overlaps is loaded, and ticking
+// unless only reads are made
+Result<void> checkRegion(BlockSource &block_source, int x, int y, int z, int width, int height, int depth,
+                         bool require_ticking = true)
+{
+    if (width <= 0 || height <= 0 || depth <= 0) {
+        return nonstd::make_unexpected(make_error("Invalid region size ({}, {}, {}).", width, height, depth));
+    }
+
+    if (y < block_source.getMinHeight() || y + height - 1 > block_source.getMaxHeight()) {
+        return nonstd::make_unexpected(
+            make_error("Trying to access region from ({}, {}, {}) to ({}, {}, {}) which is outside of the world "
+                       "boundaries.",
+                       x, y, z, x + width - 1, y + height - 1, z + depth - 1));
+    }
+
+    const auto current_level_tick = block_source.getLevel().getCurrentTick();
+    for (auto chunk_x = x >> 4; chunk_x <= (x + width - 1) >> 4; ++chunk_x) {
+        for (auto chunk_z = z >> 4; chunk_z <= (z + depth - 1) >> 4; ++chunk_z) {
+            const auto *chunk = block_source.getChunk(chunk_x, chunk_z);
+            if (!chunk) {
+                return nonstd::make_unexpected(
+                    make_error("Trying to access chunk ({}, {}) which is not currently loaded.", chunk_x, chunk_z));
+            }
+            const auto chunk_last_tick = chunk->getLastTick();
+            if (require_ticking && current_level_tick != chunk_last_tick && current_level_tick != chunk_last_tick + 1) {
+                return nonstd::make_unexpected(
+                    make_error("Trying to access chunk ({}, {}) which is not currently ticking.", chunk_x, chunk_z));
+            }
+        }
+    }
+    return {};
+}
+
+// Visits every block of the cuboid one chunk column at a time, so that the chunk lookups of BlockSource stay cached
+template <typename Func>
+void forEachBlock(int x, int y, int z, int width, int height, int depth, Func &&func)
+{
+    const auto max_x = x + width - 1;
+    const auto max_z = z + depth - 1;
+    for (auto chunk_x = x >> 4; chunk_x <= max_x >> 4; ++chunk_x) {
+        const auto begin_x = std::max(x, chunk_x << 4);
+        const auto end_x = std::min(max_x, (chunk_x << 4) + 15);
+        for (auto chunk_z = z >> 4; chunk_z <= max_z >> 4; ++chunk_z) {
+            const auto begin_z = std::max(z, chunk_z << 4);
+            const auto end_z = std::min(max_z, (chunk_z << 4) + 15);
+            for (auto block_y = y; block_y < y + height; ++block_y) {
+                for (auto block_z = begin_z; block_z <= end_z; ++block_z) {
+                    for (auto block_x = begin_x; block_x <= end_x; ++block_x) {
+                        func(block_x, block_y, block_z);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Copies the blocks of the cuboid into a volume, the region must have been checked
+Result<BlockVolume> readBlocks(BlockSource &block_source, int x, int y, int z, int width, int height, int depth)
+{
+    BlockVolume volume{x, y, z, width, height, depth};
+    auto &block_data_cache = entt::locator<EndstoneServer>::value().getBlockDataCache();
+    auto &indices = volume.getIndices();
+    std::unordered_map<const ::Block *, BlockVolume::Index> palette;
+    const ::Block *last_block = nullptr;
+    BlockVolume::Index last_index = 0;
+    bool palette_full = false;
+    forEachBlock(x, y, z, width, height, depth, [&](int block_x, int block_y, int block_z) {
+        const auto &block = block_source.getBlock(block_x, block_y, block_z);
+        if (&block != last_block) {
+            // runs of the same block are common, only look up the palette when the block changes
+            auto [it, inserted] = palette.try_emplace(&block, 0);
+            if (inserted) {
+                if (volume.getPalette().size() >= BlockVolume::MaxPaletteSize) {
+                    palette_full = true;
+                    return;
+                }
+                it->second = volume.addToPalette(block_data_cache.intern(block));
+            }
+            last_block = &block;
+            last_index = it->second;
+        }
+        indices[volume.offsetOf(block_x, block_y, block_z)] = last_index;
+    });
+    if (palette_full) {
+        return nonstd::make_unexpected(
+            make_error("Region from ({}, {}, {}) to ({}, {}, {}) has more than {} distinct blocks.", x, y, z,
+                       x + width - 1, y + height - 1, z + depth - 1, BlockVolume::MaxPaletteSize));
+    }
+    return volume;
+}
+
+// Actor searches walk every chunk they overlap on the server thread, larger areas are rejected
+constexpr float MaxActorSearchRadius = 256.0F;
+
+bool isFinite(const Vector<float> &v)
+{
+    return std::isfinite(v.getX()) && std::isfinite(v.getY()) && std::isfinite(v.getZ());
+}
+
+// Gets the actors in the box from the spatial partition of the engine, which only looks at the chunks the box overlaps
+template <typename Predicate>
+std::vector<Actor *> fetchActors(BlockSource &block_source, const AABB &box, const std::optional<std::string> &type,
+                                 Predicate &&predicate)
+{
+    std::vector<Actor *> result;
+    // the span points to a buffer of the block source that is reused by the next fetch, copy it right away
+    for (const auto actor : block_source.fetchEntities(nullptr, box, true, false)) {
+        if (actor->isRemoved()) {
+            continue;
+        }
+        if (type.has_value() && actor->getActorIdentifier().getCanonicalName() != type.value()) {
+            continue;
+        }
+        if (!predicate(*actor)) {
+            continue;
+        }
+        result.push_back(&actor->getEndstoneActor());
+    }
+    return result;
+}
+
+// Checks the arguments of a ray trace and normalizes its direction
+// Rays are walked on the server thread, longer rays are clamped to keep a single call cheap
+constexpr float MaxRayTraceDistance = 1024.0F;
+// Length of the segments of a ray whose actors are fetched at once
+constexpr double RayTraceSegmentLength = 16.0;
+
+Result<Vector<double>> normalizeRay(const Vector<float> &direction, float max_distance)
+{
+    if (!std::isfinite(max_distance) || max_distance <= 0) {
+        return nonstd::make_unexpected(make_error("Invalid ray trace distance {}.", max_distance));
+    }
+    const Vector<double> result{direction.getX(), direction.getY(), direction.getZ()};
+    const auto length = result.length();
+    if (!std::isfinite(length) || length <= 0) {
+        return nonstd::make_unexpected(make_error("Invalid ray trace direction ({}, {}, {}).", direction.getX(),
+                                                  direction.getY(), direction.getZ()));
+    }
+    return result / length;
+}
+
+Vector<double> toVector(const Vec3 &v)
+{
+    return {v.x, v.y, v.z};
+}
+
+Vector<float> toVector(const Vector<double> &v)
+{
+    return {static_cast<float>(v.getX()), static_cast<float>(v.getY()), static_cast<float>(v.getZ())};
+}
+
+bool isLiquid(const ::Block &block, FluidCollisionMode mode)
+{
+    const auto &name = block.getLegacyBlock().getRawNameId();
+    if (name != "water" && name != "flowing_water" && name != "lava" && name != "flowing_lava") {
+        return false;
+    }
+    if (mode == FluidCollisionMode::Always) {
+        return true;
+    }
+
+    // source blocks have a liquid depth of 0
+    const auto *states = block.getSerializationId().getCompound("states");
+    const auto *depth = states ? states->get("liquid_depth") : nullptr;
+    return depth && depth->getId() == Tag::Type::Int && static_cast<const IntTag *>(depth)->data == 0;
+}
+}  // namespace
+
 EndstoneDimension::EndstoneDimension(::Dimension &dimension, EndstoneLevel &level)
     : dimension_(dimension), level_(level)
 {
@@ -59,6 +249,353 @@ Result<std::unique_ptr<Block>> EndstoneDimension::getBlockAt(Location location)
     return getBlockAt(location.getBlockX(), location.getBlockY(), location.getBlockZ());
 }
 
+Result<std::shared_ptr<BlockData>> EndstoneDimension::getBlockDataAt(int x, int y, int z)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    if (auto result = checkRegion(block_source, x, y, z, 1, 1, 1); !result) {
+        return nonstd::make_unexpected(result.error());
+    }
+    return entt::locator<EndstoneServer>::value().getBlockDataCache().intern(block_source.getBlock(x, y, z));
+}
+
+Result<void> EndstoneDimension::setBlockDataAt(int x, int y, int z, std::shared_ptr<BlockData> data,
+                                               bool apply_physics)
+{
+    if (!data) {
+        return nonstd::make_unexpected(make_error("Block data cannot be null"));
+    }
+
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    if (auto result = checkRegion(block_source, x, y, z, 1, 1, 1); !result) {
+        return nonstd::make_unexpected(result.error());
+    }
+
+    const auto &block = static_cast<EndstoneBlockData &>(*data).getHandle();
+    const auto flags = apply_physics ? UpdateNeighbors | UpdateNetwork : UpdateNetwork;
+    block_source.setBlock(BlockPos(x, y, z), block, flags, nullptr, nullptr);
+    return {};
+}
+
+Result<BlockVolume> EndstoneDimension::getBlocks(int x, int y, int z, int width, int height, int depth)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    if (auto result = checkRegion(block_source, x, y, z, width, height, depth); !result) {
+        return nonstd::make_unexpected(result.error());
+    }
+    return readBlocks(block_source, x, y, z, width, height, depth);
+}
+
+Result<std::size_t> EndstoneDimension::setBlocks(const BlockVolume &volume, bool apply_physics)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    if (auto result = checkRegion(block_source, volume.getX(), volume.getY(), volume.getZ(), volume.getWidth(),
+                                  volume.getHeight(), volume.getDepth());
+        !result) {
+        return nonstd::make_unexpected(result.error());
+    }
+
+    // resolve the palette once, and validate everything before modifying any block
+    std::vector<const ::Block *> palette;
+    for (const auto &data : volume.getPalette()) {
+        if (!data) {
+            return nonstd::make_unexpected(make_error("Block data cannot be null"));
+        }
+        palette.push_back(&static_cast<EndstoneBlockData &>(*data).getHandle());
+    }
+    const auto &indices = volume.getIndices();
+    if (const auto it = std::max_element(indices.begin(), indices.end());
+        it != indices.end() && *it >= palette.size()) {
+        return nonstd::make_unexpected(make_error("Palette index {} is out of range.", *it));
+    }
+
+    const auto flags = apply_physics ? UpdateNeighbors | UpdateNetwork : UpdateNetwork;
+    std::size_t changed = 0;
+    forEachBlock(volume.getX(), volume.getY(), volume.getZ(), volume.getWidth(), volume.getHeight(),
+                 volume.getDepth(), [&](int block_x, int block_y, int block_z) {
+                     const auto *block = palette[indices[volume.offsetOf(block_x, block_y, block_z)]];
+                     if (&block_source.getBlock(block_x, block_y, block_z) == block) {
+                         return;
+                     }
+                     block_source.setBlock(BlockPos(block_x, block_y, block_z), *block, flags, nullptr, nullptr);
+                     changed++;
+                 });
+    return changed;
+}
+
+Result<std::size_t> EndstoneDimension::fill(int x, int y, int z, int width, int height, int depth,
+                                            std::shared_ptr<BlockData> data, bool apply_physics)
+{
+    if (!data) {
+        return nonstd::make_unexpected(make_error("Block data cannot be null"));
+    }
+
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    if (auto result = checkRegion(block_source, x, y, z, width, height, depth); !result) {
+        return nonstd::make_unexpected(result.error());
+    }
+
+    const auto &block = static_cast<EndstoneBlockData &>(*data).getHandle();
+    const auto flags = apply_physics ? UpdateNeighbors | UpdateNetwork : UpdateNetwork;
+    std::size_t changed = 0;
+    forEachBlock(x, y, z, width, height, depth, [&](int block_x, int block_y, int block_z) {
+        if (&block_source.getBlock(block_x, block_y, block_z) == &block) {
+            return;
+        }
+        block_source.setBlock(BlockPos(block_x, block_y, block_z), block, flags, nullptr, nullptr);
+        changed++;
+    });
+    return changed;
+}
+
+Result<std::size_t> EndstoneDimension::applyTransaction(const BlockTransaction &transaction, bool apply_physics)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    const auto changes = transaction.getChangesInChunkOrder();
+    for (const auto *change : changes) {
+        if (!change->data) {
+            return nonstd::make_unexpected(make_error("Block data cannot be null"));
+        }
+        if (auto result = checkRegion(block_source, change->x, change->y, change->z, 1, 1, 1); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
+    }
+
+    std::size_t changed = 0;
+    const auto apply = [&](const BlockTransaction::Change &change, int flags) {
+        const auto &block = static_cast<EndstoneBlockData &>(*change.data).getHandle();
+        const BlockPos pos(change.x, change.y, change.z);
+        if (&block_source.getBlock(pos) == &block) {
+            return false;
+        }
+        block_source.setBlock(pos, block, flags, nullptr, nullptr);
+        changed++;
+        return true;
+    };
+
+    // All neighbours of an interior block are part of the edit, so it never needs to notify them
+    std::vector<const BlockTransaction::Change *> boundary;
+    for (const auto *change : changes) {
+        if (apply_physics && !transaction.isInterior(change->x, change->y, change->z)) {
+            boundary.push_back(change);
+            continue;
+        }
+        apply(*change, UpdateNetwork);
+    }
+
+    // Once every block has its final state, each boundary block is updated from its neighbours inside the edit and
+    // notifies its neighbours outside of it, even if the boundary block itself kept its state
+    const auto min_height = block_source.getMinHeight();
+    const auto max_height = block_source.getMaxHeight();
+    for (const auto *change : boundary) {
+        const BlockPos pos(change->x, change->y, change->z);
+        const auto notify_outside = !apply(*change, UpdateNeighbors | UpdateNetwork);
+        for (const auto &offset : NeighbourOffsets) {
+            const BlockPos neighbour(pos.x + offset[0], pos.y + offset[1], pos.z + offset[2]);
+            if (neighbour.y < min_height || neighbour.y >= max_height) {
+                continue;
+            }
+            if (transaction.contains(neighbour.x, neighbour.y, neighbour.z)) {
+                block_source.getBlock(pos).getLegacyBlock().neighborChanged(block_source, pos, neighbour);
+            }
+            else if (notify_outside && block_source.getChunk(neighbour.x >> 4, neighbour.z >> 4)) {
+                block_source.getBlock(neighbour).getLegacyBlock().neighborChanged(block_source, neighbour, pos);
+            }
+        }
+    }
+    return changed;
+}
+
+Result<ChunkSnapshot> EndstoneDimension::getChunkSnapshot(int x, int z)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    const auto min_height = block_source.getMinHeight();
+    const auto height = block_source.getMaxHeight() - min_height;
+    if (auto result = checkRegion(block_source, x << 4, min_height, z << 4, 16, height, 16, false); !result) {
+        return nonstd::make_unexpected(result.error());
+    }
+    auto volume = readBlocks(block_source, x << 4, min_height, z << 4, 16, height, 16);
+    if (!volume) {
+        return nonstd::make_unexpected(volume.error());
+    }
+    return ChunkSnapshot(x, z, volume.value());
+}
+
+Result<std::shared_ptr<ChunkLoadTask>> EndstoneDimension::loadChunksAsync(int min_x, int min_z, int max_x, int max_z)
+{
+    if (min_x > max_x || min_z > max_z) {
+        return nonstd::make_unexpected(
+            make_error("Invalid chunk area from ({}, {}) to ({}, {}).", min_x, min_z, max_x, max_z));
+    }
+    if (ChunkLoadBatch{min_x, min_z, max_x, max_z}.size() > MaxChunkLoadArea) {
+        return nonstd::make_unexpected(make_error("Cannot load more than {} chunks at once.", MaxChunkLoadArea));
+    }
+    if (getType() == Type::Custom) {
+        return nonstd::make_unexpected(make_error("Chunks cannot be loaded in custom dimension {}.", getName()));
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    return server.getChunkLoader().submit(*this, min_x, min_z, max_x, max_z);
+}
+
+Result<std::vector<Actor *>> EndstoneDimension::getNearbyActors(const Vector<float> &center, float radius,
+                                                                std::optional<std::string> type)
+{
+    if (!std::isfinite(radius) || radius < 0) {
+        return nonstd::make_unexpected(make_error("Invalid search radius {}.", radius));
+    }
+    if (radius > MaxActorSearchRadius) {
+        return nonstd::make_unexpected(
+            make_error("Cannot search actors further than {} blocks.", MaxActorSearchRadius));
+    }
+    if (!isFinite(center)) {
+        return nonstd::make_unexpected(
+            make_error("Invalid search center ({}, {}, {}).", center.getX(), center.getY(), center.getZ()));
+    }
+
+    const Vec3 point{center.getX(), center.getY(), center.getZ()};
+    const AABB box{point - Vec3{radius, radius, radius}, point + Vec3{radius, radius, radius}};
+    const auto radius_squared = radius * radius;
+    return fetchActors(getHandle().getBlockSourceFromMainChunkSource(), box, type, [&](const ::Actor &actor) {
+        const auto &aabb = actor.getAABB();
+        const Vector<float> min{aabb.min.x, aabb.min.y, aabb.min.z};
+        const Vector<float> max{aabb.max.x, aabb.max.y, aabb.max.z};
+        return distanceSquaredToBox(center, min, max) <= radius_squared;
+    });
+}
+
+Result<std::vector<Actor *>> EndstoneDimension::getActorsInBox(const Vector<float> &min, const Vector<float> &max,
+                                                               std::optional<std::string> type)
+{
+    if (!isFinite(min) || !isFinite(max)) {
+        return nonstd::make_unexpected(make_error("Invalid search box from ({}, {}, {}) to ({}, {}, {}).", min.getX(),
+                                                  min.getY(), min.getZ(), max.getX(), max.getY(), max.getZ()));
+    }
+    const AABB box{{std::min(min.getX(), max.getX()), std::min(min.getY(), max.getY()),
+                    std::min(min.getZ(), max.getZ())},
+                   {std::max(min.getX(), max.getX()), std::max(min.getY(), max.getY()),
+                    std::max(min.getZ(), max.getZ())}};
+    if (box.max.x - box.min.x > 2 * MaxActorSearchRadius || box.max.y - box.min.y > 2 * MaxActorSearchRadius ||
+        box.max.z - box.min.z > 2 * MaxActorSearchRadius) {
+        return nonstd::make_unexpected(
+            make_error("Cannot search actors in a box larger than {} blocks on a side.", 2 * MaxActorSearchRadius));
+    }
+    return fetchActors(getHandle().getBlockSourceFromMainChunkSource(), box, type,
+                       [](const ::Actor & /*actor*/) { return true; });
+}
+
+std::vector<Actor *> EndstoneDimension::getActorsInChunk(int x, int z)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    const AABB box{{static_cast<float>(x << 4), static_cast<float>(block_source.getMinHeight()),
+                    static_cast<float>(z << 4)},
+                   {static_cast<float>((x << 4) + 16), static_cast<float>(block_source.getMaxHeight()),
+                    static_cast<float>((z << 4) + 16)}};
+    return fetchActors(block_source, box, std::nullopt, [&](const ::Actor &actor) {
+        // only keep the actors whose position is in the chunk, the box also catches actors overlapping its border
+        const auto &position = actor.getPosition();
+        return static_cast<int>(std::floor(position.x)) >> 4 == x && static_cast<int>(std::floor(position.z)) >> 4 == z;
+    });
+}
+
+Result<std::optional<BlockRayTraceResult>> EndstoneDimension::rayTraceBlocks(const Vector<float> &origin,
+                                                                           const Vector<float> &direction,
+                                                                           float max_distance,
+                                                                           FluidCollisionMode fluid_mode)
+{
+    const auto ray = normalizeRay(direction, max_distance);
+    if (!ray) {
+        return nonstd::make_unexpected(ray.error());
+    }
+
+    const auto &dir = ray.value();
+    const Vector<double> start{origin.getX(), origin.getY(), origin.getZ()};
+    max_distance = std::min(max_distance, MaxRayTraceDistance);
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    const auto min_height = block_source.getMinHeight();
+    const auto max_height = block_source.getMaxHeight();
+    std::optional<BlockRayTraceResult> result;
+    traverseBlocks(start, dir, max_distance, [&](int x, int y, int z) {
+        if (y < min_height || y >= max_height) {
+            // keep walking only while the ray is heading back into the world
+            return y < min_height ? dir.getY() <= 0 : dir.getY() >= 0;
+        }
+        if (!block_source.getChunk(x >> 4, z >> 4)) {
+            return true;
+        }
+
+        const BlockPos pos{x, y, z};
+        std::optional<RayBoxHit> hit;
+        AABB shape;
+        if (block_source.getBlock(pos).getCollisionShape(shape, block_source, pos, nullptr)) {
+            hit = intersectRayBox(start, dir, toVector(shape.min), toVector(shape.max), max_distance);
+        }
+        if (fluid_mode != FluidCollisionMode::Never && isLiquid(block_source.getLiquidBlock(pos), fluid_mode)) {
+            const auto liquid_hit =
+                intersectRayBox(start, dir, Vector<double>(x, y, z), Vector<double>(x + 1, y + 1, z + 1), max_distance);
+            if (liquid_hit && (!hit || liquid_hit->distance < hit->distance)) {
+                hit = liquid_hit;
+            }
+        }
+        if (!hit) {
+            return false;
+        }
+
+        result = BlockRayTraceResult{toVector(start + dir * hit->distance), static_cast<float>(hit->distance), x, y,
+                                     z, hit->face};
+        return true;
+    });
+    return result;
+}
+
+Result<std::optional<ActorRayTraceResult>> EndstoneDimension::rayTraceActors(const Vector<float> &origin,
+                                                                           const Vector<float> &direction,
+                                                                           float max_distance, float ray_size,
+                                                                           const Actor *exclude)
+{
+    const auto ray = normalizeRay(direction, max_distance);
+    if (!ray) {
+        return nonstd::make_unexpected(ray.error());
+    }
+    if (!std::isfinite(ray_size) || ray_size < 0) {
+        return nonstd::make_unexpected(make_error("Invalid ray size {}.", ray_size));
+    }
+
+    const auto &dir = ray.value();
+    const Vector<double> start{origin.getX(), origin.getY(), origin.getZ()};
+    max_distance = std::min(max_distance, MaxRayTraceDistance);
+    const auto grow = static_cast<double>(ray_size);
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+
+    // Fetch the actors around one segment of the ray at a time, so a long diagonal ray does not query every chunk
+    // of its bounding box. An actor crossed by a segment is entered at the latest at the end of that segment.
+    std::optional<ActorRayTraceResult> result;
+    for (double from = 0; from < max_distance && !result; from += RayTraceSegmentLength) {
+        const auto to = std::min(from + RayTraceSegmentLength, static_cast<double>(max_distance));
+        const auto a = start + dir * from;
+        const auto b = start + dir * to;
+        const AABB box{{static_cast<float>(std::min(a.getX(), b.getX()) - grow),
+                        static_cast<float>(std::min(a.getY(), b.getY()) - grow),
+                        static_cast<float>(std::min(a.getZ(), b.getZ()) - grow)},
+                       {static_cast<float>(std::max(a.getX(), b.getX()) + grow),
+                        static_cast<float>(std::max(a.getY(), b.getY()) + grow),
+                        static_cast<float>(std::max(a.getZ(), b.getZ()) + grow)}};
+        for (const auto actor : block_source.fetchEntities(nullptr, box, true, false)) {
+            if (actor->isRemoved() || &actor->getEndstoneActor() == exclude) {
+                continue;
+            }
+            const auto &aabb = actor->getAABB();
+            const auto hit =
+                intersectRayBox(start, dir, toVector(aabb.min) - grow, toVector(aabb.max) + grow, max_distance);
+            if (!hit || (result && hit->distance >= result->distance)) {
+                continue;
+            }
+            result = ActorRayTraceResult{toVector(start + dir * hit->distance), static_cast<float>(hit->distance),
+                                         &actor->getEndstoneActor(), hit->face};
+        }
+    }
+    return result;
+}
+
 ::Dimension &EndstoneDimension::getHandle() const
 {
     return dimension_;
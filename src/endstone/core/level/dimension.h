@@ -30,6 +30,28 @@ public:
     [[nodiscard]] Level &getLevel() const override;
     Result<std::unique_ptr<Block>> getBlockAt(int x, int y, int z) override;
     Result<std::unique_ptr<Block>> getBlockAt(Location location) override;
+    [[nodiscard]] Result<std::shared_ptr<BlockData>> getBlockDataAt(int x, int y, int z) override;
+    Result<void> setBlockDataAt(int x, int y, int z, std::shared_ptr<BlockData> data, bool apply_physics) override;
+    Result<BlockVolume> getBlocks(int x, int y, int z, int width, int height, int depth) override;
+    Result<std::size_t> setBlocks(const BlockVolume &volume, bool apply_physics) override;
+    Result<std::size_t> fill(int x, int y, int z, int width, int height, int depth, std::shared_ptr<BlockData> data,
+                             bool apply_physics) override;
+    Result<std::size_t> applyTransaction(const BlockTransaction &transaction, bool apply_physics) override;
+    Result<ChunkSnapshot> getChunkSnapshot(int x, int z) override;
+    Result<std::shared_ptr<ChunkLoadTask>> loadChunksAsync(int min_x, int min_z, int max_x, int max_z) override;
+    [[nodiscard]] Result<std::vector<Actor *>> getNearbyActors(const Vector<float> &center, float radius,
+                                                               std::optional<std::string> type) override;
+    [[nodiscard]] Result<std::vector<Actor *>> getActorsInBox(const Vector<float> &min, const Vector<float> &max,
+                                                              std::optional<std::string> type) override;
+    [[nodiscard]] std::vector<Actor *> getActorsInChunk(int x, int z) override;
+    [[nodiscard]] Result<std::optional<BlockRayTraceResult>> rayTraceBlocks(const Vector<float> &origin,
+                                                                            const Vector<float> &direction,
+                                                                            float max_distance,
+                                                                            FluidCollisionMode fluid_mode) override;
+    [[nodiscard]] Result<std::optional<ActorRayTraceResult>> rayTraceActors(const Vector<float> &origin,
+                                                                            const Vector<float> &direction,
+                                                                            float max_distance, float ray_size,
+                                                                            const Actor *exclude) override;
 
     [[nodiscard]] ::Dimension &getHandle() const;
 
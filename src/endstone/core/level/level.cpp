@@ -40,16 +40,8 @@ EndstoneLevel::EndstoneLevel(::Level &level) : server_(entt::locator<EndstoneSer
     }
 
     loadResourcePacks();
-}
-
-std::string EndstoneLevel::getName() const
-{
-    return level_.getLevelId();
-}
 
-std::vector<Actor *> EndstoneLevel::getActors() const
-{
-    std::vector<Actor *> result;
+    // Actors added from now on are tracked by the hooks, pick up the ones that are already in the level
     for (const auto &e : level_.getEntities()) {
         if (!e.hasValue()) {
             continue;
@@ -57,17 +49,37 @@ std::vector<Actor *> EndstoneLevel::getActors() const
 
         // TODO(check): is this the correct usage of OwnerPtr<EntityContext> ?
         const auto *actor = ::Actor::tryGetFromEntity(e.getStackRef(), false);
-        if (!actor) {
+        if (!actor || actor->isRemoved() || &actor->getLevel() != &level_) {
             continue;
         }
 
-        if (&actor->getLevel() != &level_) {
-            continue;
-        }
-
-        result.push_back(&actor->getEndstoneActor());
+        addActor(actor->getEndstoneActor());
     }
-    return result;
+}
+
+std::string EndstoneLevel::getName() const
+{
+    return level_.getLevelId();
+}
+
+std::vector<Actor *> EndstoneLevel::getActors() const
+{
+    return actors_.values();
+}
+
+std::uint64_t EndstoneLevel::getActorsVersion() const
+{
+    return actors_.getVersion();
+}
+
+void EndstoneLevel::addActor(Actor &actor)
+{
+    actors_.add(&actor);
+}
+
+void EndstoneLevel::removeActor(Actor &actor)
+{
+    actors_.remove(&actor);
 }
 
 int EndstoneLevel::getTime() const
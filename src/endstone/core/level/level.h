@@ -19,6 +19,7 @@
 #include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/actor/actor.h"
+#include "endstone/core/util/tracked_list.h"
 #include "endstone/level/dimension.h"
 #include "endstone/level/level.h"
 
@@ -33,12 +34,15 @@ public:
 
     [[nodiscard]] std::string getName() const override;
     [[nodiscard]] std::vector<Actor *> getActors() const override;
+    [[nodiscard]] std::uint64_t getActorsVersion() const override;
     [[nodiscard]] int getTime() const override;
     void setTime(int time) override;
     [[nodiscard]] std::vector<Dimension *> getDimensions() const override;
     [[nodiscard]] Dimension *getDimension(std::string name) const override;
     void addDimension(std::unique_ptr<Dimension> dimension);
     void loadResourcePacks();
+    void addActor(Actor &actor);
+    void removeActor(Actor &actor);
 
     [[nodiscard]] EndstoneServer &getServer() const;
     [[nodiscard]] ::Level &getHandle() const;
@@ -47,6 +51,7 @@ private:
     EndstoneServer &server_;
     ::Level &level_;
     std::unordered_map<std::string, std::unique_ptr<Dimension>> dimensions_;
+    TrackedList<Actor> actors_;
 };
 
 }  // namespace endstone::core
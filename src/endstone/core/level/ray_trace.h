@@ -0,0 +1,160 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include "endstone/block/block_face.h"
+#include "endstone/util/vector.h"
+
+namespace endstone::core {
+
+/**
+ * Where a ray enters a box.
+ */
+struct RayBoxHit {
+    double distance;
+    BlockFace face;
+};
+
+namespace detail {
+constexpr double get(const Vector<double> &v, int axis)
+{
+    return axis == 0 ? v.getX() : (axis == 1 ? v.getY() : v.getZ());
+}
+
+// The face of a box facing against the given axis of the direction of a ray
+constexpr BlockFace getFace(int axis, double direction)
+{
+    switch (axis) {
+    case 0:
+        return direction > 0 ? BlockFace::West : BlockFace::East;
+    case 1:
+        return direction > 0 ? BlockFace::Down : BlockFace::Up;
+    default:
+        return direction > 0 ? BlockFace::North : BlockFace::South;
+    }
+}
+}  // namespace detail
+
+/**
+ * Intersects a ray with a box using the slab method. The direction must be normalized.
+ *
+ * A ray starting inside the box hits it at distance 0, on the face opposite to the main axis of the direction.
+ */
+inline std::optional<RayBoxHit> intersectRayBox(const Vector<double> &origin, const Vector<double> &direction,
+                                                const Vector<double> &min, const Vector<double> &max,
+                                                double max_distance)
+{
+    auto t_near = -std::numeric_limits<double>::infinity();
+    auto t_far = std::numeric_limits<double>::infinity();
+    auto near_axis = -1;
+    for (auto axis = 0; axis < 3; ++axis) {
+        const auto o = detail::get(origin, axis);
+        const auto d = detail::get(direction, axis);
+        const auto lo = detail::get(min, axis);
+        const auto hi = detail::get(max, axis);
+        if (d == 0) {
+            if (o < lo || o > hi) {
+                return std::nullopt;
+            }
+            continue;
+        }
+        auto t1 = (lo - o) / d;
+        auto t2 = (hi - o) / d;
+        if (t1 > t2) {
+            std::swap(t1, t2);
+        }
+        if (t1 > t_near) {
+            t_near = t1;
+            near_axis = axis;
+        }
+        t_far = std::min(t_far, t2);
+        if (t_near > t_far) {
+            return std::nullopt;
+        }
+    }
+
+    if (near_axis < 0 || t_far < 0 || t_near > max_distance) {
+        return std::nullopt;
+    }
+    if (t_near < 0) {
+        near_axis = 0;
+        for (auto axis = 1; axis < 3; ++axis) {
+            if (std::abs(detail::get(direction, axis)) > std::abs(detail::get(direction, near_axis))) {
+                near_axis = axis;
+            }
+        }
+        t_near = 0;
+    }
+    return RayBoxHit{t_near, detail::getFace(near_axis, detail::get(direction, near_axis))};
+}
+
+/**
+ * Visits the blocks crossed by a ray in order, starting with the block containing the origin (Amanatides and Woo).
+ * The direction must be normalized. The visitor is called with the coordinates of each block and returns true to stop.
+ */
+template <typename Visitor>
+void traverseBlocks(const Vector<double> &origin, const Vector<double> &direction, double max_distance,
+                    Visitor &&visitor)
+{
+    int block[3];
+    int step[3];
+    double t_max[3];
+    double t_delta[3];
+    for (auto axis = 0; axis < 3; ++axis) {
+        const auto o = detail::get(origin, axis);
+        const auto d = detail::get(direction, axis);
+        block[axis] = static_cast<int>(std::floor(o));
+        if (d > 0) {
+            step[axis] = 1;
+            t_delta[axis] = 1 / d;
+            t_max[axis] = (block[axis] + 1 - o) / d;
+        }
+        else if (d < 0) {
+            step[axis] = -1;
+            t_delta[axis] = -1 / d;
+            t_max[axis] = (block[axis] - o) / d;
+        }
+        else {
+            step[axis] = 0;
+            t_delta[axis] = std::numeric_limits<double>::infinity();
+            t_max[axis] = std::numeric_limits<double>::infinity();
+        }
+    }
+
+    double t = 0;
+    while (t <= max_distance) {
+        if (visitor(block[0], block[1], block[2])) {
+            return;
+        }
+        auto axis = 0;
+        if (t_max[1] < t_max[axis]) {
+            axis = 1;
+        }
+        if (t_max[2] < t_max[axis]) {
+            axis = 2;
+        }
+        block[axis] += step[axis];
+        t = t_max[axis];
+        t_max[axis] += t_delta[axis];
+    }
+}
+
+}  // namespace endstone::core
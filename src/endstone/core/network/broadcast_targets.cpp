@@ -0,0 +1,78 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/broadcast_targets.h"
+
+#include <functional>
+
+#include "endstone/detail/hash.h"
+
+namespace endstone::core {
+
+BroadcastTargets::BroadcastTargets(std::size_t capacity)
+{
+    targets_.reserve(capacity);
+    seen_.reserve(capacity);
+}
+
+bool BroadcastTargets::add(const NetworkIdentifier &network_id, SubClientId sub_id)
+{
+    NetworkIdentifierWithSubId target{network_id, sub_id};
+    if (!seen_.insert(target).second) {
+        return false;
+    }
+    targets_.push_back(std::move(target));
+    return true;
+}
+
+bool BroadcastTargets::empty() const
+{
+    return targets_.empty();
+}
+
+const std::vector<NetworkIdentifierWithSubId> &BroadcastTargets::get() const
+{
+    return targets_;
+}
+
+std::size_t BroadcastTargets::Hash::operator()(const NetworkIdentifierWithSubId &target) const
+{
+    // only hash the fields NetworkIdentifier::operator== compares for the type, the others may hold garbage
+    const auto &id = target.network_identifier;
+    std::size_t hash = 0;
+    switch (id.getType()) {
+    case NetworkIdentifier::Type::RakNet:
+        hash = std::hash<std::uint64_t>{}(id.guid.g);
+        break;
+    case NetworkIdentifier::Type::NetherNet:
+        hash = std::hash<std::uint64_t>{}(id.nether_net_id);
+        break;
+    case NetworkIdentifier::Type::Address:
+    case NetworkIdentifier::Type::Address6:
+        hash = std::hash<std::uint16_t>{}(id.getPort());
+        break;
+    default:
+        break;
+    }
+    endstone::detail::hash_combine(hash, static_cast<std::size_t>(target.sub_id));
+    return hash;
+}
+
+bool BroadcastTargets::Equal::operator()(const NetworkIdentifierWithSubId &lhs,
+                                         const NetworkIdentifierWithSubId &rhs) const
+{
+    return lhs.sub_id == rhs.sub_id && lhs.network_identifier == rhs.network_identifier;
+}
+
+}  // namespace endstone::core
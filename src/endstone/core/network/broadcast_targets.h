@@ -0,0 +1,55 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "bedrock/network/network_identifier.h"
+
+namespace endstone::core {
+
+/**
+ * The clients a broadcast packet is sent to. A client listed more than once only receives the packet once.
+ */
+class BroadcastTargets {
+public:
+    explicit BroadcastTargets(std::size_t capacity = 0);
+
+    /**
+     * Adds a client to the broadcast.
+     *
+     * @return false if the client was already added
+     */
+    bool add(const NetworkIdentifier &network_id, SubClientId sub_id);
+
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] const std::vector<NetworkIdentifierWithSubId> &get() const;
+
+private:
+    struct Hash {
+        std::size_t operator()(const NetworkIdentifierWithSubId &target) const;
+    };
+
+    struct Equal {
+        bool operator()(const NetworkIdentifierWithSubId &lhs, const NetworkIdentifierWithSubId &rhs) const;
+    };
+
+    std::vector<NetworkIdentifierWithSubId> targets_;
+    std::unordered_set<NetworkIdentifierWithSubId, Hash, Equal> seen_;
+};
+
+}  // namespace endstone::core
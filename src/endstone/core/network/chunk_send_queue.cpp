@@ -0,0 +1,153 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/chunk_send_queue.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <iterator>
+#include <numbers>
+#include <utility>
+
+#include "endstone/core/network/packet_codec.h"
+
+namespace endstone::core {
+
+namespace {
+// Requests further away come later, the ones behind the player count up to three times as far as the ones in front
+float get_priority(const Vector<float> &center, const Vector<float> &position, float yaw)
+{
+    const auto offset = center - position;
+    const auto distance = offset.length();
+    const auto horizontal = std::hypot(offset.getX(), offset.getZ());
+    if (horizontal < ChunkSendQueue::SubChunkSize) {
+        // the sub-chunks around the player are needed whatever the direction
+        return distance;
+    }
+    const auto radians = yaw * std::numbers::pi_v<float> / 180.0F;
+    const auto facing = (-std::sin(radians) * offset.getX() + std::cos(radians) * offset.getZ()) / horizontal;
+    return distance * (2.0F - facing);
+}
+}  // namespace
+
+std::optional<ChunkSendQueue::Area> ChunkSendQueue::parseRequest(std::span<const std::byte> body)
+{
+    // dimension, the position of the base sub-chunk, then the offsets of the requested sub-chunks from it
+    try {
+        PacketCodec::BufferReader reader(body);
+        reader.readVarInt();
+        const auto x = reader.readVarInt();
+        const auto y = reader.readVarInt();
+        const auto z = reader.readVarInt();
+
+        std::uint32_t count;
+        reader.readBytes(&count, sizeof(count));
+        if (count == 0 || count > reader.getRemaining() / 3) {
+            return std::nullopt;
+        }
+
+        Vector<float> sum;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const auto dx = static_cast<std::int8_t>(reader.readByte());
+            const auto dy = static_cast<std::int8_t>(reader.readByte());
+            const auto dz = static_cast<std::int8_t>(reader.readByte());
+            sum += Vector<float>(static_cast<float>(x + dx), static_cast<float>(y + dy), static_cast<float>(z + dz));
+        }
+        const auto center = (sum / static_cast<float>(count) + 0.5F) * static_cast<float>(SubChunkSize);
+        return Area{center, count};
+    }
+    catch (const std::exception &) {
+        return std::nullopt;
+    }
+}
+
+void ChunkSendQueue::setRate(int chunks_per_tick, int bytes_per_tick)
+{
+    chunks_per_tick_ = std::max(chunks_per_tick, 0);
+    bytes_per_tick_ = std::max(bytes_per_tick, 0);
+    chunk_allowance_ = std::min<std::int64_t>(chunk_allowance_, chunks_per_tick_);
+    byte_allowance_ = std::min<std::int64_t>(byte_allowance_, bytes_per_tick_);
+}
+
+int ChunkSendQueue::getChunksPerTick() const
+{
+    return chunks_per_tick_;
+}
+
+int ChunkSendQueue::getBytesPerTick() const
+{
+    return bytes_per_tick_;
+}
+
+bool ChunkSendQueue::isLimited() const
+{
+    return chunks_per_tick_ > 0 || bytes_per_tick_ > 0;
+}
+
+void ChunkSendQueue::push(Request request)
+{
+    requests_.push_back(std::move(request));
+}
+
+void ChunkSendQueue::recordBytes(std::size_t bytes)
+{
+    if (bytes_per_tick_ > 0) {
+        byte_allowance_ -= static_cast<std::int64_t>(bytes);
+    }
+}
+
+std::size_t ChunkSendQueue::tick(const Vector<float> &position, float yaw)
+{
+    // what was used beyond the budget is paid back first, what was left unused is not carried over
+    chunk_allowance_ = std::min<std::int64_t>(chunk_allowance_ + chunks_per_tick_, chunks_per_tick_);
+    byte_allowance_ = std::min<std::int64_t>(byte_allowance_ + bytes_per_tick_, bytes_per_tick_);
+    if (requests_.empty() || !hasBudget()) {
+        return 0;
+    }
+
+    std::ranges::stable_sort(requests_, {},
+                             [&](const Request &request) { return get_priority(request.area.center, position, yaw); });
+
+    // requests pushed while handling wait for the next tick, behind the ones left over
+    auto requests = std::move(requests_);
+    requests_.clear();
+    auto it = requests.begin();
+    for (; it != requests.end() && hasBudget(); ++it) {
+        if (chunks_per_tick_ > 0) {
+            chunk_allowance_ -= static_cast<std::int64_t>(it->area.count);
+        }
+        it->handle();
+    }
+    const auto handled = static_cast<std::size_t>(it - requests.begin());
+    requests_.insert(requests_.begin(), std::make_move_iterator(it), std::make_move_iterator(requests.end()));
+    return handled;
+}
+
+std::size_t ChunkSendQueue::size() const
+{
+    return requests_.size();
+}
+
+void ChunkSendQueue::clear()
+{
+    requests_.clear();
+}
+
+bool ChunkSendQueue::hasBudget() const
+{
+    return (chunks_per_tick_ == 0 || chunk_allowance_ > 0) && (bytes_per_tick_ == 0 || byte_allowance_ > 0);
+}
+
+}  // namespace endstone::core
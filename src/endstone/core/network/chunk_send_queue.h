@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "endstone/util/vector.h"
+
+namespace endstone::core {
+
+/**
+ * Sub-chunk requests of a player waiting to be handled, released within a budget of chunks and bytes per tick.
+ *
+ * The client asks for the blocks of the chunks around it with sub-chunk requests, and the server answers each of them
+ * right away with every sub-chunk it asks for. Holding the requests back spreads the chunk traffic of joining or
+ * fast-moving players over several ticks. Within the budget, the requests closest to the player and in front of them
+ * are handled first.
+ *
+ * A request is handled as a whole while some budget is left, what it uses beyond the budget is taken from the next
+ * ticks. The budget is unlimited by default, requests are then handled as soon as they arrive.
+ */
+class ChunkSendQueue {
+public:
+    // sub-chunks are 16 blocks in each direction
+    static constexpr int SubChunkSize = 16;
+
+    /**
+     * The sub-chunks asked for by a request.
+     */
+    struct Area {
+        Vector<float> center;  // block position of the middle of the requested sub-chunks
+        std::size_t count;     // number of requested sub-chunks
+    };
+
+    struct Request {
+        Area area;
+        std::function<void()> handle;
+    };
+
+    /**
+     * Reads the requested sub-chunks from the encoded body of a sub-chunk request packet, or returns std::nullopt if
+     * the body is malformed.
+     */
+    static std::optional<Area> parseRequest(std::span<const std::byte> body);
+
+    /**
+     * Sets the budget per tick, 0 means unlimited.
+     */
+    void setRate(int chunks_per_tick, int bytes_per_tick);
+    [[nodiscard]] int getChunksPerTick() const;
+    [[nodiscard]] int getBytesPerTick() const;
+    [[nodiscard]] bool isLimited() const;
+
+    void push(Request request);
+
+    /**
+     * Accounts for chunk data sent to the player, taken from the byte budget.
+     */
+    void recordBytes(std::size_t bytes);
+
+    /**
+     * Refills the budget and handles the queued requests by priority until it is spent.
+     *
+     * @param position the position of the player
+     * @param yaw the yaw of the player in degrees, 0 facing south (+z)
+     * @return the number of requests handled
+     */
+    std::size_t tick(const Vector<float> &position, float yaw);
+
+    [[nodiscard]] std::size_t size() const;
+    void clear();
+
+private:
+    [[nodiscard]] bool hasBudget() const;
+
+    int chunks_per_tick_{0};
+    int bytes_per_tick_{0};
+    std::int64_t chunk_allowance_{0};
+    std::int64_t byte_allowance_{0};
+    std::vector<Request> requests_;
+};
+
+}  // namespace endstone::core
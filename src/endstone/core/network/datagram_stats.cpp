@@ -0,0 +1,112 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/datagram_stats.h"
+
+#include <mutex>
+
+namespace endstone::core {
+
+void DatagramStats::record(Direction direction, std::uint8_t id, std::size_t bytes, const PeerAddress &address)
+{
+    record(direction, id, bytes);
+
+    std::shared_lock lock(peers_mutex_);
+    if (peers_.empty()) {
+        return;
+    }
+    if (const auto it = peers_.find(address); it != peers_.end()) {
+        auto &counters = (*it->second)[static_cast<std::size_t>(direction)];
+        counters.datagrams.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+DatagramStats::Counter DatagramStats::get(Direction direction, std::uint8_t id) const
+{
+    const auto &counters = counters_[static_cast<std::size_t>(direction)][id];
+    return {counters.datagrams.load(std::memory_order_relaxed), counters.bytes.load(std::memory_order_relaxed)};
+}
+
+DatagramStats::Counter DatagramStats::getTotal(Direction direction) const
+{
+    Counter total{0, 0};
+    for (const auto &counters : counters_[static_cast<std::size_t>(direction)]) {
+        total.datagrams += counters.datagrams.load(std::memory_order_relaxed);
+        total.bytes += counters.bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void DatagramStats::addPeer(const PeerAddress &address)
+{
+    std::unique_lock lock(peers_mutex_);
+    peers_[address] = std::make_unique<std::array<AtomicCounter, 2>>();
+}
+
+void DatagramStats::removePeer(const PeerAddress &address)
+{
+    std::unique_lock lock(peers_mutex_);
+    peers_.erase(address);
+}
+
+std::optional<DatagramStats::Counter> DatagramStats::getPeer(const PeerAddress &address, Direction direction) const
+{
+    std::shared_lock lock(peers_mutex_);
+    const auto it = peers_.find(address);
+    if (it == peers_.end()) {
+        return std::nullopt;
+    }
+    const auto &counters = (*it->second)[static_cast<std::size_t>(direction)];
+    return Counter{counters.datagrams.load(std::memory_order_relaxed), counters.bytes.load(std::memory_order_relaxed)};
+}
+
+const char *DatagramStats::getName(std::uint8_t id)
+{
+    // https://github.com/facebookarchive/RakNet/blob/master/Source/MessageIdentifiers.h
+    switch (id) {
+    case 0x00:
+        return "ConnectedPing";
+    case 0x01:
+        return "UnconnectedPing";
+    case 0x03:
+        return "ConnectedPong";
+    case 0x05:
+        return "OpenConnectionRequest1";
+    case 0x06:
+        return "OpenConnectionReply1";
+    case 0x07:
+        return "OpenConnectionRequest2";
+    case 0x08:
+        return "OpenConnectionReply2";
+    case 0x1c:
+        return "UnconnectedPong";
+    default:
+        break;
+    }
+
+    // https://github.com/facebookarchive/RakNet/blob/master/Source/ReliabilityLayer.cpp (DatagramHeaderFormat)
+    if ((id & 0x80) != 0) {
+        if ((id & 0x40) != 0) {
+            return "Ack";
+        }
+        if ((id & 0x20) != 0) {
+            return "Nak";
+        }
+        return "Datagram";
+    }
+    return "Unknown";
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,94 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "endstone/core/network/peer_address.h"
+
+namespace endstone::core {
+
+/**
+ * Datagrams and bytes sent and received on the RakNet socket, per RakNet message ID (the first byte of a datagram).
+ *
+ * Game packets are compressed and encrypted inside connected datagrams (0x80-0x8f), so they cannot be told apart at
+ * this level. Counters are updated on the network threads without locking.
+ *
+ * Datagrams are also counted per peer for the peers that have been added with addPeer, which are the connected
+ * players. The peer table is only changed on the server thread and is looked up under a shared lock.
+ */
+class DatagramStats {
+public:
+    enum class Direction : std::uint8_t {
+        Inbound,
+        Outbound,
+    };
+
+    struct Counter {
+        std::uint64_t datagrams;
+        std::uint64_t bytes;
+    };
+
+    void record(Direction direction, std::uint8_t id, std::size_t bytes)
+    {
+        auto &counters = counters_[static_cast<std::size_t>(direction)][id];
+        counters.datagrams.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * Accounts for a datagram exchanged with a peer. The peer counters are only updated if the peer has been added.
+     */
+    void record(Direction direction, std::uint8_t id, std::size_t bytes, const PeerAddress &address);
+
+    [[nodiscard]] Counter get(Direction direction, std::uint8_t id) const;
+
+    /**
+     * Gets the datagrams and bytes exchanged in one direction since startup, whatever the message ID.
+     */
+    [[nodiscard]] Counter getTotal(Direction direction) const;
+
+    void addPeer(const PeerAddress &address);
+    void removePeer(const PeerAddress &address);
+
+    /**
+     * Gets the datagrams and bytes exchanged with a peer in one direction since it was added.
+     */
+    [[nodiscard]] std::optional<Counter> getPeer(const PeerAddress &address, Direction direction) const;
+
+    /**
+     * Gets a readable name of a RakNet message ID, e.g. "Datagram" or "UnconnectedPing".
+     */
+    [[nodiscard]] static const char *getName(std::uint8_t id);
+
+private:
+    struct AtomicCounter {
+        std::atomic<std::uint64_t> datagrams{0};
+        std::atomic<std::uint64_t> bytes{0};
+    };
+
+    std::array<std::array<AtomicCounter, 256>, 2> counters_;
+    mutable std::shared_mutex peers_mutex_;
+    std::unordered_map<PeerAddress, std::unique_ptr<std::array<AtomicCounter, 2>>, PeerAddressHash> peers_;
+};
+
+}  // namespace endstone::core
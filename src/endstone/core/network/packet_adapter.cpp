@@ -14,6 +14,9 @@
 
 #include "endstone/core/network/packet_adapter.h"
 
+#include <exception>
+#include <system_error>
+
 #include <magic_enum/magic_enum.hpp>
 
 #include "endstone/core/network/packet_codec.h"
@@ -62,9 +65,17 @@ bool PacketAdapter::isValid() const
     return true;
 }
 
-Bedrock::Result<void> PacketAdapter::_read(ReadOnlyBinaryStream &)
+Bedrock::Result<void> PacketAdapter::_read(ReadOnlyBinaryStream &stream)
 {
-    throw std::runtime_error("Not implemented");
+    try {
+        PacketCodec::decode(stream, packet_);
+    }
+    catch (const std::exception &) {
+        Bedrock::ErrorInfo error_info;
+        error_info.error = std::make_error_code(std::errc::bad_message);
+        return nonstd::make_unexpected(error_info);
+    }
+    return {};
 }
 
 }  // namespace endstone::core
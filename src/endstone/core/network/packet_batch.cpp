@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/packet_batch.h"
+
+#include "bedrock/entity/components/user_entity_identifier_component.h"
+#include "bedrock/network/packet_sender.h"
+#include "bedrock/world/actor/player/player.h"
+#include "bedrock/world/level/level.h"
+
+namespace endstone::core {
+
+void PacketBatch::add(std::shared_ptr<::Packet> packet)
+{
+    packets_.emplace_back(std::move(packet));
+}
+
+bool PacketBatch::empty() const
+{
+    return packets_.empty();
+}
+
+std::size_t PacketBatch::send(const Sender &sender, ::Packet *packet)
+{
+    // packets queued while sending go into the next batch
+    auto packets = std::move(packets_);
+    packets_.clear();
+
+    for (const auto &queued : packets) {
+        sender(*queued);
+    }
+    if (packet) {
+        sender(*packet);
+    }
+    return packets.size() + (packet ? 1 : 0);
+}
+
+std::size_t PacketBatch::flush(::Player &player, ::Packet *packet)
+{
+    if (packets_.empty()) {
+        // a packet on its own is batched by the connection as usual
+        if (packet) {
+            player.sendNetworkPacket(*packet);
+        }
+        return 0;
+    }
+
+    const auto count = send([&player](::Packet &queued) { player.sendNetworkPacket(queued); }, packet);
+    const auto *component = player.getPersistentComponent<UserEntityIdentifierComponent>();
+    if (auto *sender = player.getLevel().getPacketSender(); sender) {
+        sender->flush(component->network_id, [] {});
+    }
+    return count;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,90 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "bedrock/network/packet.h"
+
+class Player;
+
+namespace endstone::core {
+
+/**
+ * Outgoing packets of a player, collected during a tick and sent together at the end of it.
+ *
+ * The packets are sent back to back and the connection is flushed right after, so that they end up in a single
+ * compressed batch instead of being spread over several. A packet sent right away while the batch is not empty is sent
+ * last in the same batch, behind the packets queued before it.
+ */
+class PacketBatch {
+public:
+    using Sender = std::function<void(::Packet &)>;
+
+    struct Stats {
+        std::uint64_t flushes{0};
+        std::uint64_t packets{0};
+        std::uint64_t bytes{0};
+        std::size_t max_packets{0};
+        std::size_t max_bytes{0};
+
+        void record(std::size_t count, std::size_t size)
+        {
+            flushes++;
+            packets += count;
+            bytes += size;
+            max_packets = std::max(max_packets, count);
+            max_bytes = std::max(max_bytes, size);
+        }
+
+        [[nodiscard]] float getAveragePackets() const
+        {
+            return flushes == 0 ? 0.0F : static_cast<float>(packets) / static_cast<float>(flushes);
+        }
+
+        [[nodiscard]] float getAverageBytes() const
+        {
+            return flushes == 0 ? 0.0F : static_cast<float>(bytes) / static_cast<float>(flushes);
+        }
+    };
+
+    void add(std::shared_ptr<::Packet> packet);
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * Sends all packets in the batch with the sender, followed by the given packet if any.
+     *
+     * @return the number of packets sent
+     */
+    std::size_t send(const Sender &sender, ::Packet *packet = nullptr);
+
+    /**
+     * Sends all packets in the batch to the player, followed by the given packet if any, and flushes the connection.
+     * When the batch is empty, the given packet is sent on its own and the connection is left alone.
+     *
+     * @return the number of packets sent in the batch, 0 if the batch was empty
+     */
+    std::size_t flush(::Player &player, ::Packet *packet = nullptr);
+
+private:
+    std::vector<std::shared_ptr<::Packet>> packets_;
+};
+
+}  // namespace endstone::core
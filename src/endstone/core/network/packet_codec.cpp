@@ -18,18 +18,55 @@
 
 #include <fmt/format.h>
 
-#include "endstone/network/spawn_particle_effect_packet.h"
-
 namespace endstone::core {
 
-void PacketCodec::encode(BinaryStream &stream, Packet &packet)
+namespace {
+template <typename From, typename To>
+using CopyConst = std::conditional_t<std::is_const_v<From>, const To, To>;
+
+/**
+ * Invokes the callback with the packet cast to its concrete type.
+ */
+template <typename P, typename Func>
+decltype(auto) visit(P &packet, Func &&func)
 {
     switch (packet.getType()) {
+    case PacketType::PlaySound:
+        return func(static_cast<CopyConst<P, PlaySoundPacket> &>(packet));
+    case PacketType::SetTitle:
+        return func(static_cast<CopyConst<P, SetTitlePacket> &>(packet));
     case PacketType::SpawnParticleEffect:
-        encode(stream, static_cast<SpawnParticleEffectPacket &>(packet));
-        break;
+        return func(static_cast<CopyConst<P, SpawnParticleEffectPacket> &>(packet));
     default:
         throw std::runtime_error(fmt::format("Packet type {} is not supported.", static_cast<int>(packet.getType())));
     }
 }
+}  // namespace
+
+void PacketCodec::encode(BinaryStream &stream, const Packet &packet)
+{
+    visit(packet, [&](const auto &p) { encode(stream, p); });
+}
+
+void PacketCodec::decode(ReadOnlyBinaryStream &stream, Packet &packet)
+{
+    StreamReader reader(stream);
+    visit(packet, [&](auto &p) { decode(reader, p); });
+}
+
+std::size_t PacketCodec::getSize(const Packet &packet)
+{
+    return visit(packet, [](const auto &p) { return getSize(p); });
+}
+
+std::vector<std::byte> PacketCodec::encode(const Packet &packet)
+{
+    return visit(packet, [](const auto &p) {
+        std::vector<std::byte> buffer(getSize(p));
+        BufferWriter writer(buffer);
+        encode(writer, p);
+        return buffer;
+    });
+}
+
 }  // namespace endstone::core
@@ -14,19 +14,567 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 #include "bedrock/core/utility/binary_stream.h"
 #include "endstone/network/packet.h"
+#include "endstone/network/play_sound_packet.h"
+#include "endstone/network/set_title_packet.h"
+#include "endstone/network/spawn_particle_effect_packet.h"
+#include "endstone/util/vector.h"
 
 namespace endstone::core {
 
 namespace PacketCodec {
 
-void encode(BinaryStream &stream, Packet &packet);
+/**
+ * Base of the writers used by the codec. Derived classes only need to provide writeBytes, the encoding of primitive
+ * types is the same as BinaryStream so packets can be written to either of them.
+ */
+template <typename Derived>
+class BasicWriter {
+public:
+    void writeBool(bool value)
+    {
+        writeByte(value ? 1 : 0);
+    }
 
-template <typename T, typename = std::enable_if_t<std::is_base_of_v<Packet, T> && !std::is_same_v<Packet, T>>>
-void encode(BinaryStream &stream, T &packet);
+    void writeByte(std::uint8_t value)
+    {
+        self().writeBytes(&value, sizeof(value));
+    }
+
+    void writeUnsignedVarInt(std::uint32_t value)
+    {
+        writeUnsignedVarInt64(value);
+    }
+
+    void writeUnsignedVarInt64(std::uint64_t value)
+    {
+        do {
+            std::uint8_t byte = value & 0x7F;
+            value >>= 7;
+            writeByte(value ? (byte | 0x80) : byte);
+        } while (value);
+    }
+
+    void writeVarInt(std::int32_t value)
+    {
+        writeUnsignedVarInt((static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31));
+    }
+
+    void writeVarInt64(std::int64_t value)
+    {
+        writeUnsignedVarInt64((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+    void writeFloat(float value)
+    {
+        self().writeBytes(&value, sizeof(value));
+    }
+
+    void writeString(std::string_view value)
+    {
+        writeUnsignedVarInt(static_cast<std::uint32_t>(value.size()));
+        self().writeBytes(value.data(), value.size());
+    }
+
+private:
+    Derived &self()
+    {
+        return static_cast<Derived &>(*this);
+    }
+};
+
+/**
+ * Counts the number of bytes a packet is encoded to, without writing anything.
+ */
+class SizeCounter : public BasicWriter<SizeCounter> {
+public:
+    void writeBytes(const void *, std::size_t size)
+    {
+        size_ += size;
+    }
+
+    [[nodiscard]] std::size_t getSize() const
+    {
+        return size_;
+    }
+
+private:
+    std::size_t size_{0};
+};
+
+/**
+ * Writes into a pre-sized buffer. Throws std::out_of_range if the buffer is too small.
+ */
+class BufferWriter : public BasicWriter<BufferWriter> {
+public:
+    explicit BufferWriter(std::span<std::byte> buffer) : buffer_(buffer) {}
+
+    void writeBytes(const void *data, std::size_t size)
+    {
+        if (size > buffer_.size() - position_) {
+            throw std::out_of_range("Buffer is too small for the packet.");
+        }
+        if (size > 0) {
+            std::memcpy(buffer_.data() + position_, data, size);
+            position_ += size;
+        }
+    }
+
+    [[nodiscard]] std::size_t getPosition() const
+    {
+        return position_;
+    }
+
+private:
+    std::span<std::byte> buffer_;
+    std::size_t position_{0};
+};
+
+/**
+ * Base of the readers used by the codec. Derived classes only need to provide readBytes, which throws
+ * std::out_of_range if there is not enough data left, and getRemaining.
+ */
+template <typename Derived>
+class BasicReader {
+public:
+    bool readBool()
+    {
+        return readByte() != 0;
+    }
+
+    std::uint8_t readByte()
+    {
+        std::uint8_t value;
+        self().readBytes(&value, sizeof(value));
+        return value;
+    }
+
+    std::uint32_t readUnsignedVarInt()
+    {
+        return static_cast<std::uint32_t>(readUnsignedVarInt64(5));
+    }
+
+    std::uint64_t readUnsignedVarInt64(int max_bytes = 10)
+    {
+        std::uint64_t value = 0;
+        for (int i = 0; i < max_bytes; i++) {
+            const auto byte = readByte();
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << (7 * i);
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        throw std::runtime_error("VarInt is too big.");
+    }
+
+    std::int32_t readVarInt()
+    {
+        const auto value = readUnsignedVarInt();
+        return static_cast<std::int32_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    std::int64_t readVarInt64()
+    {
+        const auto value = readUnsignedVarInt64();
+        return static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    float readFloat()
+    {
+        float value;
+        self().readBytes(&value, sizeof(value));
+        return value;
+    }
+
+    std::string readString()
+    {
+        // check the length before allocating, it comes from the client
+        const auto size = readUnsignedVarInt();
+        if (size > self().getRemaining()) {
+            throw std::out_of_range("Unexpected end of packet.");
+        }
+        std::string value(size, '\0');
+        self().readBytes(value.data(), value.size());
+        return value;
+    }
+
+private:
+    Derived &self()
+    {
+        return static_cast<Derived &>(*this);
+    }
+};
+
+class BufferReader : public BasicReader<BufferReader> {
+public:
+    explicit BufferReader(std::span<const std::byte> buffer) : buffer_(buffer) {}
+
+    void readBytes(void *data, std::size_t size)
+    {
+        if (size > buffer_.size() - position_) {
+            throw std::out_of_range("Unexpected end of packet.");
+        }
+        if (size > 0) {
+            std::memcpy(data, buffer_.data() + position_, size);
+            position_ += size;
+        }
+    }
+
+    [[nodiscard]] std::size_t getRemaining() const
+    {
+        return buffer_.size() - position_;
+    }
+
+private:
+    std::span<const std::byte> buffer_;
+    std::size_t position_{0};
+};
+
+class StreamReader : public BasicReader<StreamReader> {
+public:
+    explicit StreamReader(ReadOnlyBinaryStream &stream) : stream_(stream) {}
+
+    void readBytes(void *data, std::size_t size)
+    {
+        if (size > 0 && !stream_.read(data, size)) {
+            throw std::out_of_range("Unexpected end of packet.");
+        }
+    }
+
+    [[nodiscard]] std::size_t getRemaining() const
+    {
+        return stream_.getUnreadLength();
+    }
+
+private:
+    ReadOnlyBinaryStream &stream_;
+};
+
+/**
+ * Wire types, describing how a field is encoded on the wire.
+ */
+namespace Wire {
+
+struct Bool {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const T &value)
+    {
+        writer.writeBool(value);
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, T &value)
+    {
+        value = reader.readBool();
+    }
+};
+
+struct Byte {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const T &value)
+    {
+        writer.writeByte(static_cast<std::uint8_t>(value));
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, T &value)
+    {
+        value = static_cast<T>(reader.readByte());
+    }
+};
+
+struct VarInt {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const T &value)
+    {
+        writer.writeVarInt(static_cast<std::int32_t>(value));
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, T &value)
+    {
+        value = static_cast<T>(reader.readVarInt());
+    }
+};
+
+struct VarInt64 {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const T &value)
+    {
+        writer.writeVarInt64(static_cast<std::int64_t>(value));
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, T &value)
+    {
+        value = static_cast<T>(reader.readVarInt64());
+    }
+};
+
+struct UnsignedVarInt {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const T &value)
+    {
+        writer.writeUnsignedVarInt(static_cast<std::uint32_t>(value));
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, T &value)
+    {
+        value = static_cast<T>(reader.readUnsignedVarInt());
+    }
+};
+
+struct Float {
+    template <typename Writer>
+    static void write(Writer &writer, float value)
+    {
+        writer.writeFloat(value);
+    }
+
+    template <typename Reader>
+    static void read(Reader &reader, float &value)
+    {
+        value = reader.readFloat();
+    }
+};
+
+struct String {
+    template <typename Writer>
+    static void write(Writer &writer, std::string_view value)
+    {
+        writer.writeString(value);
+    }
+
+    template <typename Reader>
+    static void read(Reader &reader, std::string &value)
+    {
+        value = reader.readString();
+    }
+};
+
+struct Vec3 {
+    template <typename Writer>
+    static void write(Writer &writer, const Vector<float> &value)
+    {
+        writer.writeFloat(value.getX());
+        writer.writeFloat(value.getY());
+        writer.writeFloat(value.getZ());
+    }
+
+    template <typename Reader>
+    static void read(Reader &reader, Vector<float> &value)
+    {
+        const auto x = reader.readFloat();
+        const auto y = reader.readFloat();
+        const auto z = reader.readFloat();
+        value = {x, y, z};
+    }
+};
+
+/**
+ * A position encoded as a block position in 1/8th of a block, as used by sound packets. Coordinates are floored like
+ * block positions. The Y coordinate is written as an unsigned varint holding the two's complement of its value.
+ */
+struct SoundPosition {
+    template <typename Writer>
+    static void write(Writer &writer, const Vector<float> &value)
+    {
+        writer.writeVarInt(static_cast<std::int32_t>(std::floor(value.getX() * 8)));
+        writer.writeUnsignedVarInt(static_cast<std::uint32_t>(static_cast<std::int32_t>(std::floor(value.getY() * 8))));
+        writer.writeVarInt(static_cast<std::int32_t>(std::floor(value.getZ() * 8)));
+    }
+
+    template <typename Reader>
+    static void read(Reader &reader, Vector<float> &value)
+    {
+        const auto x = static_cast<float>(reader.readVarInt()) / 8.0F;
+        const auto y = static_cast<float>(static_cast<std::int32_t>(reader.readUnsignedVarInt())) / 8.0F;
+        const auto z = static_cast<float>(reader.readVarInt()) / 8.0F;
+        value = {x, y, z};
+    }
+};
+
+/**
+ * An optional value, prefixed with a bool indicating its presence.
+ */
+template <typename Element>
+struct Optional {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const std::optional<T> &value)
+    {
+        writer.writeBool(value.has_value());
+        if (value.has_value()) {
+            Element::write(writer, value.value());
+        }
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, std::optional<T> &value)
+    {
+        if (reader.readBool()) {
+            Element::read(reader, value.emplace());
+        }
+        else {
+            value.reset();
+        }
+    }
+};
+
+/**
+ * A list of values, prefixed with its length as an unsigned varint.
+ */
+template <typename Element>
+struct List {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const std::vector<T> &value)
+    {
+        writer.writeUnsignedVarInt(static_cast<std::uint32_t>(value.size()));
+        for (const auto &element : value) {
+            Element::write(writer, element);
+        }
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, std::vector<T> &value)
+    {
+        value.clear();
+        const auto size = reader.readUnsignedVarInt();
+        for (std::uint32_t i = 0; i < size; ++i) {
+            Element::read(reader, value.emplace_back());
+        }
+    }
+};
+
+}  // namespace Wire
+
+/**
+ * Describes a field of a packet: the member it is stored in and how it is encoded on the wire.
+ */
+template <auto Member, typename WireType>
+struct Field {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const T &packet)
+    {
+        WireType::write(writer, packet.*Member);
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, T &packet)
+    {
+        WireType::read(reader, packet.*Member);
+    }
+};
+
+/**
+ * The fields of a packet, in the order they are encoded on the wire.
+ */
+template <typename... Fields>
+struct FieldList {
+    template <typename Writer, typename T>
+    static void write(Writer &writer, const T &packet)
+    {
+        (Fields::write(writer, packet), ...);
+    }
+
+    template <typename Reader, typename T>
+    static void read(Reader &reader, T &packet)
+    {
+        (Fields::read(reader, packet), ...);
+    }
+};
+
+/**
+ * Describes the wire layout of a packet. Specialised for each supported packet with a FieldList alias named `type`.
+ */
+template <typename T>
+struct PacketFields;
+
+template <>
+struct PacketFields<SpawnParticleEffectPacket> {
+    using type = FieldList<Field<&SpawnParticleEffectPacket::dimension_id, Wire::Byte>,
+                           Field<&SpawnParticleEffectPacket::actor_id, Wire::VarInt64>,
+                           Field<&SpawnParticleEffectPacket::position, Wire::Vec3>,
+                           Field<&SpawnParticleEffectPacket::effect_name, Wire::String>,
+                           Field<&SpawnParticleEffectPacket::molang_variables_json, Wire::Optional<Wire::String>>>;
+};
+
+template <>
+struct PacketFields<SetTitlePacket> {
+    using type = FieldList<Field<&SetTitlePacket::type, Wire::VarInt>,
+                           Field<&SetTitlePacket::text, Wire::String>,
+                           Field<&SetTitlePacket::fade_in_time, Wire::VarInt>,
+                           Field<&SetTitlePacket::stay_time, Wire::VarInt>,
+                           Field<&SetTitlePacket::fade_out_time, Wire::VarInt>,
+                           Field<&SetTitlePacket::xuid, Wire::String>,
+                           Field<&SetTitlePacket::platform_online_id, Wire::String>,
+                           Field<&SetTitlePacket::filtered_text, Wire::String>>;
+};
+
+template <>
+struct PacketFields<PlaySoundPacket> {
+    using type = FieldList<Field<&PlaySoundPacket::sound_name, Wire::String>,
+                           Field<&PlaySoundPacket::position, Wire::SoundPosition>,
+                           Field<&PlaySoundPacket::volume, Wire::Float>,
+                           Field<&PlaySoundPacket::pitch, Wire::Float>>;
+};
+
+template <typename T>
+constexpr bool IsConcretePacket = std::is_base_of_v<Packet, T> && !std::is_same_v<Packet, T>;
+
+template <typename Writer, typename T, typename = std::enable_if_t<IsConcretePacket<T>>>
+void encode(Writer &writer, const T &packet)
+{
+    PacketFields<T>::type::write(writer, packet);
+}
+
+template <typename Reader, typename T, typename = std::enable_if_t<IsConcretePacket<T>>>
+void decode(Reader &reader, T &packet)
+{
+    PacketFields<T>::type::read(reader, packet);
+}
+
+template <typename T, typename = std::enable_if_t<IsConcretePacket<T>>>
+std::size_t getSize(const T &packet)
+{
+    SizeCounter counter;
+    encode(counter, packet);
+    return counter.getSize();
+}
+
+/**
+ * Encodes a packet of any supported type. Throws std::runtime_error if the packet type is not supported.
+ */
+void encode(BinaryStream &stream, const Packet &packet);
+
+/**
+ * Decodes a packet of any supported type. Throws std::runtime_error if the packet type is not supported or the
+ * payload is malformed.
+ */
+void decode(ReadOnlyBinaryStream &stream, Packet &packet);
+
+/**
+ * Gets the exact number of bytes a packet is encoded to.
+ */
+std::size_t getSize(const Packet &packet);
+
+/**
+ * Encodes a packet into a buffer sized up front, without any intermediate reallocation.
+ */
+std::vector<std::byte> encode(const Packet &packet);
 
 };  // namespace PacketCodec
 
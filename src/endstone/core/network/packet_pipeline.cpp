@@ -0,0 +1,114 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/packet_pipeline.h"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+namespace endstone::core {
+
+namespace {
+template <typename Listeners, typename Listened>
+void remove_owned(Listeners &listeners, Listened &listened, const Plugin &owner)
+{
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        std::erase_if(listeners[i], [&](const auto &entry) { return entry.owner == &owner; });
+        listened[i].store(!listeners[i].empty(), std::memory_order_relaxed);
+    }
+}
+}  // namespace
+
+PacketPipeline::PacketPipeline(Logger &logger) : logger_(logger) {}
+
+void PacketPipeline::addPacketListener(int packet_id, PacketListener listener, const Plugin *owner)
+{
+    if (packet_id < 0 || static_cast<std::size_t>(packet_id) >= MaxPacketId) {
+        return;
+    }
+    std::unique_lock lock(mutex_);
+    packet_listeners_[packet_id].push_back({owner, std::move(listener)});
+    packet_listened_[packet_id].store(true, std::memory_order_relaxed);
+}
+
+void PacketPipeline::addMessageListener(std::uint8_t message_id, MessageListener listener, const Plugin *owner)
+{
+    if (message_id >= MaxMessageId) {
+        return;
+    }
+    std::unique_lock lock(mutex_);
+    message_listeners_[message_id].push_back({owner, std::move(listener)});
+    message_listened_[message_id].store(true, std::memory_order_relaxed);
+}
+
+void PacketPipeline::removeListeners(const Plugin &owner)
+{
+    std::unique_lock lock(mutex_);
+    remove_owned(packet_listeners_, packet_listened_, owner);
+    remove_owned(message_listeners_, message_listened_, owner);
+}
+
+void PacketPipeline::process(const OutboundPacket &packet)
+{
+    const auto packet_id = packet.getId();
+    if (!hasPacketListeners(packet_id)) {
+        return;
+    }
+
+    dispatched_.fetch_add(1, std::memory_order_relaxed);
+    std::shared_lock lock(mutex_);
+    for (const auto &[owner, listener] : packet_listeners_[packet_id]) {
+        try {
+            listener(packet);
+        }
+        catch (const std::exception &e) {
+            logger_.error("Error occurred when handling outbound packet {}: {}", packet_id, e.what());
+        }
+    }
+}
+
+bool PacketPipeline::process(UnconnectedMessage &message)
+{
+    const auto message_id = message.getId();
+    if (!hasMessageListeners(message_id)) {
+        return false;
+    }
+
+    dispatched_.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::shared_lock lock(mutex_);
+        for (const auto &[owner, listener] : message_listeners_[message_id]) {
+            try {
+                listener(message);
+            }
+            catch (const std::exception &e) {
+                logger_.error("Error occurred when handling unconnected message {}: {}", message_id, e.what());
+            }
+        }
+    }
+
+    if (!message.isModified()) {
+        return false;
+    }
+    modified_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+PacketPipeline::Stats PacketPipeline::getStats() const
+{
+    return {dispatched_.load(std::memory_order_relaxed), modified_.load(std::memory_order_relaxed)};
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,112 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <shared_mutex>
+#include <vector>
+
+#include "endstone/logger.h"
+#include "endstone/network/outbound_packet.h"
+#include "endstone/network/unconnected_message.h"
+#include "endstone/plugin/plugin.h"
+
+namespace endstone::core {
+
+/**
+ * Dispatches outbound packets to the listeners registered for their ID.
+ *
+ * Game packets are dispatched by Minecraft packet ID when the packet sender encodes them, listeners get a read-only
+ * view of the body. Unconnected RakNet messages (e.g. unconnected pongs) are dispatched by RakNet message ID at the
+ * socket send hook, listeners may replace their payload. Connected datagrams never go through the pipeline.
+ *
+ * Listeners are stored per ID, so packets without any listener are skipped after a single atomic load. Dispatching
+ * happens on the sending threads, listeners must be thread-safe.
+ */
+class PacketPipeline {
+public:
+    using PacketListener = std::function<void(const OutboundPacket &)>;
+    using MessageListener = std::function<void(UnconnectedMessage &)>;
+
+    static constexpr std::size_t MaxPacketId = 512;
+    // RakNet message IDs with the high bit set are the headers of connected datagrams
+    static constexpr std::size_t MaxMessageId = 0x80;
+
+    struct Stats {
+        std::uint64_t dispatched;
+        std::uint64_t modified;
+    };
+
+    explicit PacketPipeline(Logger &logger);
+
+    /**
+     * Registers a listener for a Minecraft packet ID. Listeners registered without an owner are never removed.
+     */
+    void addPacketListener(int packet_id, PacketListener listener, const Plugin *owner = nullptr);
+
+    /**
+     * Registers a listener for an unconnected RakNet message ID. Listeners registered without an owner are never
+     * removed.
+     */
+    void addMessageListener(std::uint8_t message_id, MessageListener listener, const Plugin *owner = nullptr);
+
+    void removeListeners(const Plugin &owner);
+
+    [[nodiscard]] bool hasPacketListeners(int packet_id) const
+    {
+        return packet_id >= 0 && static_cast<std::size_t>(packet_id) < MaxPacketId &&
+               packet_listened_[packet_id].load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool hasMessageListeners(std::uint8_t message_id) const
+    {
+        return message_id < MaxMessageId && message_listened_[message_id].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Calls the listeners registered for the packet ID in registration order.
+     */
+    void process(const OutboundPacket &packet);
+
+    /**
+     * Calls the listeners registered for the message ID in registration order. Returns true if the payload was
+     * replaced by any of the listeners.
+     */
+    bool process(UnconnectedMessage &message);
+
+    [[nodiscard]] Stats getStats() const;
+
+private:
+    template <typename Listener>
+    struct Entry {
+        const Plugin *owner;
+        Listener listener;
+    };
+
+    Logger &logger_;
+    mutable std::shared_mutex mutex_;
+    std::array<std::vector<Entry<PacketListener>>, MaxPacketId> packet_listeners_;
+    std::array<std::atomic<bool>, MaxPacketId> packet_listened_{};
+    std::array<std::vector<Entry<MessageListener>>, MaxMessageId> message_listeners_;
+    std::array<std::atomic<bool>, MaxMessageId> message_listened_{};
+    std::atomic<std::uint64_t> dispatched_{0};
+    std::atomic<std::uint64_t> modified_{0};
+};
+
+}  // namespace endstone::core
@@ -0,0 +1,255 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/packet_rate_limiter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "endstone/core/util/error.h"
+
+namespace endstone::core {
+
+PacketRateLimiter::PacketRateLimiter() : PacketRateLimiter(Config{}) {}
+
+PacketRateLimiter::PacketRateLimiter(const Config &config) : config_(config)
+{
+    ping_total_ = {config_.ping_total.burst, Clock::now()};
+}
+
+PacketRateLimiter::Verdict PacketRateLimiter::check(const Address &address, std::uint8_t packet_id,
+                                                    Clock::time_point now)
+{
+    const auto kind = classify(packet_id);
+    const auto packet_class = static_cast<std::size_t>(kind);
+
+    std::lock_guard lock(mutex_);
+    if (!config_.enabled) {
+        accepted_[packet_class]++;
+        return Verdict::Accept;
+    }
+
+    if (now >= next_cleanup_) {
+        removeIdlePeers(now);
+        next_cleanup_ = now + config_.idle_timeout;
+    }
+
+    auto *peer_ptr = getPeer(address, now);
+    if (!peer_ptr) {
+        dropped_[packet_class]++;
+        return Verdict::Drop;
+    }
+
+    auto &peer = *peer_ptr;
+    peer.last_seen = now;
+    if (now < peer.blocked_until) {
+        dropped_[packet_class]++;
+        return Verdict::Drop;
+    }
+
+    if (consume(peer.buckets[packet_class], getLimit(config_, kind), now) &&
+        (kind != PacketClass::Ping || consumePing(address, now))) {
+        accepted_[packet_class]++;
+        return Verdict::Accept;
+    }
+
+    dropped_[packet_class]++;
+    if (now - peer.window_start >= std::chrono::seconds(1)) {
+        peer.window_start = now;
+        peer.drops = 0;
+    }
+    peer.drops++;
+
+    if (peer.drops >= config_.block_threshold) {
+        peer.blocked_until = now + config_.block_duration;
+        peer.drops = 0;
+        blocked_++;
+        return Verdict::Block;
+    }
+    return Verdict::Drop;
+}
+
+Result<void> PacketRateLimiter::setConfig(const Config &config)
+{
+    const std::pair<const char *, const Limit *> limits[] = {
+        {"ping", &config.ping},
+        {"connection", &config.connection},
+        {"datagram", &config.datagram},
+        {"acknowledgement", &config.acknowledgement},
+        {"other", &config.other},
+        {"ping_per_host", &config.ping_per_host},
+        {"ping_total", &config.ping_total},
+        {"new_peers_per_prefix", &config.new_peers_per_prefix},
+    };
+    for (const auto &[name, limit] : limits) {
+        if (!std::isfinite(limit->rate) || limit->rate < 0 || !std::isfinite(limit->burst) || limit->burst < 1) {
+            return nonstd::make_unexpected(
+                make_error("Invalid {} limit: rate {}, burst {}.", name, limit->rate, limit->burst));
+        }
+    }
+    if (config.block_threshold == 0 || config.max_peers == 0) {
+        return nonstd::make_unexpected(make_error("Block threshold and maximum number of peers must be positive."));
+    }
+    if (config.block_duration.count() < 0 || config.idle_timeout.count() <= 0) {
+        return nonstd::make_unexpected(make_error("Invalid block duration or idle timeout."));
+    }
+
+    std::lock_guard lock(mutex_);
+    config_ = config;
+    return {};
+}
+
+PacketRateLimiter::Config PacketRateLimiter::getConfig() const
+{
+    std::lock_guard lock(mutex_);
+    return config_;
+}
+
+PacketRateLimiter::Stats PacketRateLimiter::getStats() const
+{
+    std::lock_guard lock(mutex_);
+    return {accepted_, dropped_, blocked_, peers_.size()};
+}
+
+PacketRateLimiter::PacketClass PacketRateLimiter::classify(std::uint8_t packet_id)
+{
+    // https://github.com/facebookarchive/RakNet/blob/master/Source/MessageIdentifiers.h
+    switch (packet_id) {
+    case 0x01:  // ID_UNCONNECTED_PING
+    case 0x02:  // ID_UNCONNECTED_PING_OPEN_CONNECTIONS
+        return PacketClass::Ping;
+    case 0x05:  // ID_OPEN_CONNECTION_REQUEST_1
+    case 0x07:  // ID_OPEN_CONNECTION_REQUEST_2
+        return PacketClass::Connection;
+    default:
+        break;
+    }
+
+    // https://github.com/facebookarchive/RakNet/blob/master/Source/ReliabilityLayer.cpp (DatagramHeaderFormat)
+    if ((packet_id & 0x80) != 0) {
+        return (packet_id & 0x40) != 0 || (packet_id & 0x20) != 0 ? PacketClass::Acknowledgement
+                                                                   : PacketClass::Datagram;
+    }
+    return PacketClass::Other;
+}
+
+const PacketRateLimiter::Limit &PacketRateLimiter::getLimit(const Config &config, PacketClass packet_class)
+{
+    switch (packet_class) {
+    case PacketClass::Ping:
+        return config.ping;
+    case PacketClass::Connection:
+        return config.connection;
+    case PacketClass::Datagram:
+        return config.datagram;
+    case PacketClass::Acknowledgement:
+        return config.acknowledgement;
+    default:
+        return config.other;
+    }
+}
+
+bool PacketRateLimiter::consume(Bucket &bucket, const Limit &limit, Clock::time_point now)
+{
+    const std::chrono::duration<double> elapsed = now - bucket.updated;
+    if (elapsed.count() > 0) {
+        bucket.tokens = std::min(limit.burst, bucket.tokens + elapsed.count() * limit.rate);
+        bucket.updated = now;
+    }
+    if (bucket.tokens >= 1.0) {
+        bucket.tokens -= 1.0;
+        return true;
+    }
+    return false;
+}
+
+bool PacketRateLimiter::consumePing(const Address &address, Clock::time_point now)
+{
+    // scrapers and reflection attacks rotate source ports, so pings are also limited per IP address
+    const Address host{address.ip, 0};
+    auto it = ping_hosts_.find(host);
+    if (it == ping_hosts_.end() && ping_hosts_.size() < config_.max_peers) {
+        it = ping_hosts_.emplace(host, Bucket{config_.ping_per_host.burst, now}).first;
+    }
+    // untracked hosts are still limited by the shared buckets
+    if (it != ping_hosts_.end() && !consume(it->second, config_.ping_per_host, now)) {
+        return false;
+    }
+    return consume(ping_total_, config_.ping_total, now);
+}
+
+bool PacketRateLimiter::consumeNewPeer(const Address &address, Clock::time_point now)
+{
+    // spoofed floods usually come from a few prefixes, limiting them keeps the other prefixes in the table
+    Address prefix{};
+    const auto is_ipv4 = std::all_of(address.ip.begin(), address.ip.begin() + 10, [](auto b) { return b == 0; }) &&
+                         address.ip[10] == 0xff && address.ip[11] == 0xff;
+    std::copy_n(address.ip.begin(), is_ipv4 ? 15 : 8, prefix.ip.begin());
+
+    auto it = prefixes_.find(prefix);
+    if (it == prefixes_.end() && prefixes_.size() < config_.max_peers) {
+        it = prefixes_.emplace(prefix, Bucket{config_.new_peers_per_prefix.burst, now}).first;
+    }
+    // untracked prefixes are still bounded by max_peers
+    return it == prefixes_.end() || consume(it->second, config_.new_peers_per_prefix, now);
+}
+
+PacketRateLimiter::Peer *PacketRateLimiter::getPeer(const Address &address, Clock::time_point now)
+{
+    if (auto it = peers_.find(address); it != peers_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+        return &it->second;
+    }
+    if (!consumeNewPeer(address, now)) {
+        return nullptr;
+    }
+    if (peers_.size() >= config_.max_peers && !lru_.empty()) {
+        peers_.erase(lru_.back());
+        lru_.pop_back();
+    }
+
+    auto &peer = peers_.emplace(address, createPeer(now)).first->second;
+    peer.lru_position = lru_.insert(lru_.begin(), address);
+    return &peer;
+}
+
+PacketRateLimiter::Peer PacketRateLimiter::createPeer(Clock::time_point now) const
+{
+    Peer peer;
+    for (std::size_t i = 0; i < PacketClassCount; ++i) {
+        peer.buckets[i] = {getLimit(config_, static_cast<PacketClass>(i)).burst, now};
+    }
+    peer.window_start = now;
+    peer.last_seen = now;
+    return peer;
+}
+
+void PacketRateLimiter::removeIdlePeers(Clock::time_point now)
+{
+    for (auto it = peers_.begin(); it != peers_.end();) {
+        const auto &peer = it->second;
+        if (now - peer.last_seen > config_.idle_timeout && now >= peer.blocked_until) {
+            lru_.erase(peer.lru_position);
+            it = peers_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    std::erase_if(ping_hosts_, [&](const auto &item) { return now - item.second.updated > config_.idle_timeout; });
+    std::erase_if(prefixes_, [&](const auto &item) { return now - item.second.updated > config_.idle_timeout; });
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,127 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "endstone/core/network/peer_address.h"
+#include "endstone/network/packet_rate_limit_config.h"
+#include "endstone/util/result.h"
+
+namespace endstone::core {
+
+/**
+ * Per-connection token-bucket rate limiter for incoming RakNet datagrams.
+ *
+ * Each remote address (IP and port) has one bucket per packet class. Datagrams are dropped when the bucket is empty,
+ * and peers that keep exceeding their limit are blocked for a while. The limiter runs on
+ * the network receive thread before any packet is deserialized.
+ *
+ * Once the peer table is full, the least recently seen peer is forgotten to make room for a new one. To keep a spoofed
+ * flood from churning the table, each /24 (IPv4) or /64 (IPv6) prefix may only add new peers at a limited rate.
+ */
+class PacketRateLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class PacketClass : std::uint8_t {
+        Ping,             // unconnected pings
+        Connection,       // offline connection handshake
+        Datagram,         // connected datagrams carrying game packets
+        Acknowledgement,  // ACK and NAK
+        Other,
+    };
+    static constexpr std::size_t PacketClassCount = 5;
+
+    enum class Verdict {
+        Accept,
+        Drop,
+        Block,  // the peer has just been blocked, the connection should be closed
+    };
+
+    using Limit = PacketRateLimitConfig::Limit;
+    using Config = PacketRateLimitConfig;
+
+    struct Stats {
+        std::array<std::uint64_t, PacketClassCount> accepted;
+        std::array<std::uint64_t, PacketClassCount> dropped;
+        std::uint64_t blocked;
+        std::size_t peers;
+    };
+
+    using Address = PeerAddress;
+
+    PacketRateLimiter();
+    explicit PacketRateLimiter(const Config &config);
+
+    /**
+     * Accounts for a datagram received from a peer, identified by the first byte of the datagram.
+     */
+    [[nodiscard]] Verdict check(const Address &address, std::uint8_t packet_id, Clock::time_point now = Clock::now());
+
+    /**
+     * Replaces the limits, the state of the peers already tracked is kept. Returns an error if a limit is invalid.
+     */
+    Result<void> setConfig(const Config &config);
+    [[nodiscard]] Config getConfig() const;
+    [[nodiscard]] Stats getStats() const;
+
+    [[nodiscard]] static PacketClass classify(std::uint8_t packet_id);
+    [[nodiscard]] static const Limit &getLimit(const Config &config, PacketClass packet_class);
+
+private:
+    struct Bucket {
+        double tokens;
+        Clock::time_point updated;
+    };
+
+    struct Peer {
+        std::array<Bucket, PacketClassCount> buckets;
+        std::uint32_t drops{0};  // drops since window_start
+        Clock::time_point window_start;
+        Clock::time_point blocked_until;
+        Clock::time_point last_seen;
+        std::list<Address>::iterator lru_position;
+    };
+
+    static bool consume(Bucket &bucket, const Limit &limit, Clock::time_point now);
+    bool consumePing(const Address &address, Clock::time_point now);
+    bool consumeNewPeer(const Address &address, Clock::time_point now);
+    Peer *getPeer(const Address &address, Clock::time_point now);
+    [[nodiscard]] Peer createPeer(Clock::time_point now) const;
+    void removeIdlePeers(Clock::time_point now);
+
+    mutable std::mutex mutex_;
+    Config config_;
+    std::unordered_map<Address, Peer, PeerAddressHash> peers_;
+    std::list<Address> lru_;  // tracked peers, most recently seen first
+    // keyed by IP address only, the port is always 0
+    std::unordered_map<Address, Bucket, PeerAddressHash> ping_hosts_;
+    // keyed by /24 or /64 prefix, the port is always 0
+    std::unordered_map<Address, Bucket, PeerAddressHash> prefixes_;
+    Bucket ping_total_;
+    Clock::time_point next_cleanup_;
+    std::array<std::uint64_t, PacketClassCount> accepted_{};
+    std::array<std::uint64_t, PacketClassCount> dropped_{};
+    std::uint64_t blocked_{0};
+};
+
+}  // namespace endstone::core
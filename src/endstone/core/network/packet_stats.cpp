@@ -0,0 +1,65 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/packet_stats.h"
+
+#include <string>
+
+#include <magic_enum/magic_enum.hpp>
+
+#include "bedrock/network/packet.h"
+
+template <>
+struct magic_enum::customize::enum_range<MinecraftPacketIds> {
+    static constexpr int min = 0;
+    static constexpr int max = static_cast<int>(MinecraftPacketIds::EndId);
+};
+
+namespace endstone::core {
+
+PacketStats::Counter PacketStats::get(Direction direction, int id) const
+{
+    if (id < 0 || static_cast<std::size_t>(id) >= MaxPacketId) {
+        return {0, 0};
+    }
+    const auto &counters = counters_[static_cast<std::size_t>(direction)][static_cast<std::size_t>(id)];
+    return {counters.packets.load(std::memory_order_relaxed), counters.bytes.load(std::memory_order_relaxed)};
+}
+
+PacketStats::Counter PacketStats::getTotal(Direction direction) const
+{
+    const auto &total = totals_[static_cast<std::size_t>(direction)];
+    return {total.packets.load(std::memory_order_relaxed), total.bytes.load(std::memory_order_relaxed)};
+}
+
+std::vector<PacketTypeStats> PacketStats::getPacketTypeStats() const
+{
+    std::vector<PacketTypeStats> result;
+    for (int id = 0; id < static_cast<int>(MaxPacketId); ++id) {
+        const auto sent = get(Direction::Outbound, id);
+        const auto received = get(Direction::Inbound, id);
+        if (sent.packets == 0 && received.packets == 0) {
+            continue;
+        }
+        result.emplace_back(id, std::string(getName(id)), sent.packets, sent.bytes, received.packets, received.bytes);
+    }
+    return result;
+}
+
+std::string_view PacketStats::getName(int id)
+{
+    return magic_enum::enum_name(static_cast<MinecraftPacketIds>(id));
+}
+
+}  // namespace endstone::core
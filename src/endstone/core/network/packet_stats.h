@@ -0,0 +1,93 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "endstone/network/packet_type_stats.h"
+
+namespace endstone::core {
+
+/**
+ * Game packets and their encoded size, per Minecraft packet ID and direction.
+ *
+ * Outbound packets are counted once per recipient when they are encoded for the packet sender, inbound packets when
+ * they are decoded. Sizes are those of the packet body before batching and compression. Counters are updated without
+ * locking.
+ */
+class PacketStats {
+public:
+    static constexpr std::size_t MaxPacketId = 512;
+
+    enum class Direction : std::uint8_t {
+        Inbound,
+        Outbound,
+    };
+
+    struct Counter {
+        std::uint64_t packets;
+        std::uint64_t bytes;
+    };
+
+    /**
+     * Accounts for a packet of the given encoded size sent to or received from count connections.
+     */
+    void record(Direction direction, int id, std::size_t bytes, std::uint64_t count = 1)
+    {
+        if (id < 0 || static_cast<std::size_t>(id) >= MaxPacketId) {
+            return;
+        }
+        auto &counters = counters_[static_cast<std::size_t>(direction)][static_cast<std::size_t>(id)];
+        counters.packets.fetch_add(count, std::memory_order_relaxed);
+        counters.bytes.fetch_add(bytes * count, std::memory_order_relaxed);
+        auto &total = totals_[static_cast<std::size_t>(direction)];
+        total.packets.fetch_add(count, std::memory_order_relaxed);
+        total.bytes.fetch_add(bytes * count, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] Counter get(Direction direction, int id) const;
+
+    /**
+     * Gets the packets and bytes in one direction, whatever the packet ID.
+     */
+    [[nodiscard]] Counter getTotal(Direction direction) const;
+
+    /**
+     * Gets the counters of the packet IDs that have been sent or received at least once.
+     */
+    [[nodiscard]] std::vector<PacketTypeStats> getPacketTypeStats() const;
+
+    /**
+     * Gets the name of a Minecraft packet ID, e.g. "MovePlayer", or an empty string if the ID is unknown.
+     */
+    [[nodiscard]] static std::string_view getName(int id);
+
+private:
+    struct AtomicCounter {
+        std::atomic<std::uint64_t> packets{0};
+        std::atomic<std::uint64_t> bytes{0};
+    };
+
+    std::array<std::array<AtomicCounter, MaxPacketId>, 2> counters_;
+    // kept apart so that the totals are read without summing every packet ID, e.g. around each packet batch
+    std::array<AtomicCounter, 2> totals_;
+};
+
+}  // namespace endstone::core
@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/peer_address.h"
+
+#include <cstring>
+#include <functional>
+
+#include "bedrock/deps/raknet/raknet_types.h"
+#include "bedrock/deps/raknet/socket_includes.h"
+#include "endstone/detail/hash.h"
+
+namespace endstone::core {
+
+PeerAddress PeerAddress::fromSystemAddress(const RakNet::SystemAddress &address)
+{
+    PeerAddress result;
+    if (address.address.addr4.sin_family == AF_INET) {
+        // IPv4-mapped IPv6 address (::ffff:a.b.c.d)
+        result.ip[10] = 0xff;
+        result.ip[11] = 0xff;
+        std::memcpy(result.ip.data() + 12, &address.address.addr4.sin_addr, 4);
+    }
+    else {
+        std::memcpy(result.ip.data(), &address.address.addr6.sin6_addr, result.ip.size());
+    }
+    result.port = address.GetPort();
+    return result;
+}
+
+std::size_t PeerAddressHash::operator()(const PeerAddress &address) const
+{
+    std::uint64_t high;
+    std::uint64_t low;
+    std::memcpy(&high, address.ip.data(), sizeof(high));
+    std::memcpy(&low, address.ip.data() + sizeof(high), sizeof(low));
+    auto seed = std::hash<std::uint64_t>{}(high);
+    endstone::detail::hash_combine(seed, std::hash<std::uint64_t>{}(low));
+    endstone::detail::hash_combine(seed, static_cast<std::size_t>(address.port));
+    return seed;
+}
+
+}  // namespace endstone::core
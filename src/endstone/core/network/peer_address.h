@@ -0,0 +1,43 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace RakNet {
+struct SystemAddress;
+}  // namespace RakNet
+
+namespace endstone::core {
+
+/**
+ * Identifies a remote peer by IP address and port. IPv4 addresses are stored as IPv4-mapped IPv6 addresses.
+ */
+struct PeerAddress {
+    std::array<std::uint8_t, 16> ip{};
+    std::uint16_t port{0};
+
+    bool operator==(const PeerAddress &other) const = default;
+
+    static PeerAddress fromSystemAddress(const RakNet::SystemAddress &address);
+};
+
+struct PeerAddressHash {
+    std::size_t operator()(const PeerAddress &address) const;
+};
+
+}  // namespace endstone::core
@@ -0,0 +1,179 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/server_list_ping.h"
+
+#include <algorithm>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include <entt/entt.hpp>
+
+#include "bedrock/deps/raknet/message_identifiers.h"
+#include "endstone/core/server.h"
+#include "endstone/event/server/server_list_ping_event.h"
+#include "endstone/plugin/plugin_manager.h"
+
+namespace endstone::core {
+
+namespace {
+std::vector<std::byte> makePong(std::span<const std::byte> payload, const std::vector<std::byte> &server_info)
+{
+    constexpr auto head_size = ServerListPing::PongHeadSize;
+    std::vector<std::byte> result(head_size + server_info.size());
+    std::copy_n(payload.begin(), head_size, result.begin());
+    std::copy(server_info.begin(), server_info.end(), result.begin() + head_size);
+    return result;
+}
+}  // namespace
+
+ServerListPing::ServerListPing(Renderer renderer, Clock::duration ttl) : renderer_(std::move(renderer)), ttl_(ttl) {}
+
+void ServerListPing::attach(PacketPipeline &pipeline)
+{
+    pipeline.addMessageListener(UnconnectedPong, [this](UnconnectedMessage &message) { onUnconnectedPong(message); });
+}
+
+void ServerListPing::onUnconnectedPong(UnconnectedMessage &message, Clock::time_point now)
+{
+    const auto payload = message.getPayload();
+    if (payload.size() < PongHeadSize + 2) {
+        return;
+    }
+
+    const auto *data = reinterpret_cast<const char *>(payload.data());
+    const std::size_t length =
+        static_cast<std::uint8_t>(data[PongHeadSize]) << 8 | static_cast<std::uint8_t>(data[PongHeadSize + 1]);
+    if (length != payload.size() - (PongHeadSize + 2)) {
+        return;
+    }
+
+    const std::string_view server_info{data + PongHeadSize + 2, length};
+    {
+        std::lock_guard lock(mutex_);
+        if (expiry_.has_value() && now < expiry_.value() && server_info == server_info_) {
+            hits_++;
+            message.setPayload(makePong(payload, rendered_));
+            return;
+        }
+    }
+
+    // render outside the lock, plugins handling the event should not stall pongs sent by other threads
+    auto response = renderer_(std::string(server_info), message.getAddress());
+
+    std::lock_guard lock(mutex_);
+    misses_++;
+    if (!response.has_value()) {
+        return;
+    }
+
+    const auto response_length = std::min<std::size_t>(response->length(), 0xFFFF);
+    const auto *begin = reinterpret_cast<const std::byte *>(response->data());
+    rendered_.clear();
+    rendered_.push_back(static_cast<std::byte>((response_length >> 8) & 0xFF));
+    rendered_.push_back(static_cast<std::byte>(response_length & 0xFF));
+    rendered_.insert(rendered_.end(), begin, begin + response_length);
+    server_info_ = server_info;
+    std::copy_n(payload.begin(), PongHeadSize, head_.begin());
+    if (ttl_ > Clock::duration::zero()) {
+        expiry_ = now + ttl_;
+    }
+    else {
+        expiry_.reset();
+    }
+    message.setPayload(makePong(payload, rendered_));
+}
+
+std::size_t ServerListPing::respond(std::span<const std::byte> ping, std::span<std::byte> buffer,
+                                    Clock::time_point now)
+{
+    // https://github.com/facebookarchive/RakNet/blob/master/Source/RakPeer.cpp (ID_UNCONNECTED_PING)
+    constexpr std::size_t time_size = sizeof(std::uint64_t);
+    constexpr std::size_t magic_size = 16;
+    if (ping.size() < PingSize || static_cast<std::uint8_t>(ping[0]) != UnconnectedPing) {
+        return 0;
+    }
+
+    std::lock_guard lock(mutex_);
+    if (!reply_enabled_ || !expiry_.has_value() || now >= expiry_.value()) {
+        return 0;
+    }
+
+    const auto size = PongHeadSize + rendered_.size();
+    const auto ping_magic = ping.subspan(1 + time_size, magic_size);
+    const auto pong_magic = std::span(head_).subspan(PongHeadSize - magic_size);
+    if (size > buffer.size() || !std::equal(ping_magic.begin(), ping_magic.end(), pong_magic.begin())) {
+        return 0;
+    }
+
+    // the pong echoes the time sent in the ping
+    std::copy(head_.begin(), head_.end(), buffer.begin());
+    std::copy_n(ping.begin() + 1, time_size, buffer.begin() + 1);
+    std::copy(rendered_.begin(), rendered_.end(), buffer.begin() + PongHeadSize);
+    replies_++;
+    return size;
+}
+
+void ServerListPing::invalidate()
+{
+    std::lock_guard lock(mutex_);
+    expiry_.reset();
+}
+
+void ServerListPing::setReplyEnabled(bool enabled)
+{
+    std::lock_guard lock(mutex_);
+    reply_enabled_ = enabled;
+}
+
+bool ServerListPing::isReplyEnabled() const
+{
+    std::lock_guard lock(mutex_);
+    return reply_enabled_;
+}
+
+void ServerListPing::setTtl(Clock::duration ttl)
+{
+    std::lock_guard lock(mutex_);
+    ttl_ = ttl;
+    expiry_.reset();
+}
+
+ServerListPing::Clock::duration ServerListPing::getTtl() const
+{
+    std::lock_guard lock(mutex_);
+    return ttl_;
+}
+
+ServerListPing::Stats ServerListPing::getStats() const
+{
+    std::lock_guard lock(mutex_);
+    return {hits_, misses_, replies_};
+}
+
+std::optional<std::string> ServerListPing::fireEvent(const std::string &server_info, const SocketAddress &address)
+{
+    auto &server = entt::locator<EndstoneServer>::value();
+    ServerListPingEvent event(address.getHostname(), static_cast<int>(address.getPort()), server_info);
+    if (!event.deserialize()) {
+        server.getLogger().error("Unable to parse ping response: {}", server_info);
+        return std::nullopt;
+    }
+
+    server.getPluginManager().callEvent(event);
+    return event.serialize();
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,113 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "endstone/core/network/packet_pipeline.h"
+#include "endstone/network/unconnected_message.h"
+#include "endstone/util/socket_address.h"
+
+namespace endstone::core {
+
+/**
+ * Rewrites the server info in outgoing RakNet unconnected pongs.
+ *
+ * Rendering the server info fires ServerListPingEvent, which is far too expensive to do for every pong when the
+ * server is scraped or used as a reflector. The rendered server info is cached together with the server info it was
+ * rendered from, and is only rendered again when the server info reported by the game changes (e.g. the number of
+ * players), when the cache is invalidated, or when it is older than the TTL. While cached, every remote address gets
+ * the server info rendered for the first one, so plugins that answer differently per address would leak one address's
+ * answer to the others. The TTL therefore defaults to zero, which disables the cache and fires the event for every
+ * pong.
+ *
+ * While the cache is fresh, unconnected pings can also be answered straight from the network receive thread with
+ * respond, so that RakNet and the server never see them. This can be turned off with setReplyEnabled.
+ */
+class ServerListPing {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Renders the server info sent to a remote address, or returns std::nullopt to leave the pong untouched.
+     */
+    using Renderer = std::function<std::optional<std::string>(const std::string &, const SocketAddress &)>;
+
+    struct Stats {
+        std::uint64_t hits;
+        std::uint64_t misses;
+        std::uint64_t replies;  // pings answered by respond
+    };
+
+    // ID, time, server GUID and the offline message data ID, followed by the length-prefixed server info
+    static constexpr std::size_t PongHeadSize = sizeof(char) + sizeof(std::uint64_t) + sizeof(std::uint64_t) + 16;
+    // ID, time and the offline message data ID, followed by the client GUID
+    static constexpr std::size_t PingSize = sizeof(char) + sizeof(std::uint64_t) + 16 + sizeof(std::uint64_t);
+
+    explicit ServerListPing(Renderer renderer = &fireEvent, Clock::duration ttl = Clock::duration::zero());
+
+    /**
+     * Registers onUnconnectedPong as the listener of the outgoing unconnected pongs sent through the pipeline.
+     */
+    void attach(PacketPipeline &pipeline);
+
+    void onUnconnectedPong(UnconnectedMessage &message, Clock::time_point now = Clock::now());
+
+    /**
+     * Writes the pong answering an unconnected ping into the buffer from the cache, without any heap allocation.
+     *
+     * Returns the size of the pong, or 0 if replies are disabled, the ping is malformed, nothing is cached, the cache
+     * has expired or the pong does not fit into the buffer. The ping should then be left to RakNet, which refreshes the
+     * cache when it answers.
+     */
+    [[nodiscard]] std::size_t respond(std::span<const std::byte> ping, std::span<std::byte> buffer,
+                                      Clock::time_point now = Clock::now());
+
+    void invalidate();
+    void setReplyEnabled(bool enabled);
+    [[nodiscard]] bool isReplyEnabled() const;
+    void setTtl(Clock::duration ttl);
+    [[nodiscard]] Clock::duration getTtl() const;
+    [[nodiscard]] Stats getStats() const;
+
+    /**
+     * Fires ServerListPingEvent for the server info and returns the server info modified by the plugins.
+     */
+    static std::optional<std::string> fireEvent(const std::string &server_info, const SocketAddress &address);
+
+private:
+    Renderer renderer_;
+    mutable std::mutex mutex_;
+    Clock::duration ttl_;
+    bool reply_enabled_{true};
+    std::string server_info_;                   // the server info reported by the game
+    std::array<std::byte, PongHeadSize> head_;  // the head of the last pong, used by respond
+    std::vector<std::byte> rendered_;           // the length-prefixed server info sent instead
+    std::optional<Clock::time_point> expiry_;   // std::nullopt if nothing is cached
+    std::uint64_t hits_{0};
+    std::uint64_t misses_{0};
+    std::uint64_t replies_{0};
+};
+
+}  // namespace endstone::core
@@ -60,8 +60,12 @@ void DefaultPermissions::registerCommandPermissions(Permission *parent)
     registerPermission(root->getName() + ".unbanip", root, "Allows the user to unban IP addresses.",
                        PermissionDefault::Operator);
 
+    registerPermission(root->getName() + ".netstats", root, "Allows the user to view the network statistics",
+                       PermissionDefault::Operator);
     registerPermission(root->getName() + ".plugins", root,
                        "Allows the user to view the list of plugins running on this server", PermissionDefault::True);
+    registerPermission(root->getName() + ".pregen", root, "Allows the user to load or generate chunks in advance",
+                       PermissionDefault::Operator);
     registerPermission(root->getName() + ".reload", root,
                        "Allows the user to reload the configuration and plugins of the server",
                        PermissionDefault::Operator);
@@ -18,6 +18,7 @@
 
 #include "bedrock/certificates/extended_certificate.h"
 #include "bedrock/deps/raknet/rak_peer_interface.h"
+#include "bedrock/deps/raknet/raknet_statistics.h"
 #include "bedrock/entity/components/user_entity_identifier_component.h"
 #include "bedrock/network/packet.h"
 #include "bedrock/network/packet/modal_form_request_packet.h"
@@ -61,6 +62,8 @@ EndstonePlayer::EndstonePlayer(EndstoneServer &server, ::Player &player)
         auto *peer = entt::locator<RakNet::RakPeerInterface *>::value();
         auto addr = peer->GetSystemAddressFromGuid(component->network_id.guid);
         component->network_id.sock.sa_stor = addr.address.sa_stor;
+        peer_address_ = PeerAddress::fromSystemAddress(addr);
+        server_.datagram_stats_.addPeer(*peer_address_);
     }
     case NetworkIdentifier::Type::Address:
     case NetworkIdentifier::Type::Address6: {
@@ -73,12 +76,19 @@ EndstonePlayer::EndstonePlayer(EndstoneServer &server, ::Player &player)
         break;
     }
     server_.players_.emplace(uuid_, this);
+    server_.online_players_.add(this);
+    server_.player_index_.add(this, getName(), xuid_, component->network_id, component->client_sub_id);
 }
 
 EndstonePlayer::~EndstonePlayer()
 {
     server_.players_.erase(uuid_);
+    server_.online_players_.remove(this);
+    server_.player_index_.remove(this);
     server_.removePlayerBoard(*this);
+    if (peer_address_) {
+        server_.datagram_stats_.removePeer(*peer_address_);
+    }
 }
 
 Player *EndstonePlayer::asPlayer() const
@@ -88,20 +98,7 @@ Player *EndstonePlayer::asPlayer() const
 
 void EndstonePlayer::sendMessage(const Message &message) const
 {
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
-    auto pk = std::static_pointer_cast<TextPacket>(packet);
-    std::visit(overloaded{[&pk](const std::string &msg) {
-                              pk->type = TextPacketType::Raw;
-                              pk->message = msg;
-                          },
-                          [&pk](const Translatable &msg) {
-                              pk->type = TextPacketType::Translate;
-                              pk->message = msg.getText();
-                              pk->params = msg.getParameters();
-                              pk->localize = true;
-                          }},
-               message);
-    getHandle().sendNetworkPacket(*packet);
+    sendNetworkPacket(*createTextPacket(message));
 }
 
 void EndstonePlayer::sendErrorMessage(const Message &message) const
@@ -349,7 +346,7 @@ void EndstonePlayer::sendPopup(std::string message) const
     auto pk = std::static_pointer_cast<TextPacket>(packet);
     pk->type = TextPacketType::Popup;
     pk->message = std::move(message);
-    getHandle().sendNetworkPacket(*packet);
+    queuePacket(packet);
 }
 
 void EndstonePlayer::sendTip(std::string message) const
@@ -358,7 +355,7 @@ void EndstonePlayer::sendTip(std::string message) const
     auto pk = std::static_pointer_cast<TextPacket>(packet);
     pk->type = TextPacketType::Tip;
     pk->message = std::move(message);
-    getHandle().sendNetworkPacket(*packet);
+    queuePacket(packet);
 }
 
 void EndstonePlayer::sendToast(std::string title, std::string content) const
@@ -367,11 +364,12 @@ void EndstonePlayer::sendToast(std::string title, std::string content) const
     auto pk = std::static_pointer_cast<ToastRequestPacket>(packet);
     pk->title = std::move(title);
     pk->content = std::move(content);
-    getHandle().sendNetworkPacket(*packet);
+    queuePacket(packet);
 }
 
 void EndstonePlayer::kick(std::string message) const
 {
+    flushPackets();
     auto *component = getHandle().tryGetComponent<UserEntityIdentifierComponent>();
     server_.getServerNetworkHandler().disconnectClient(component->network_id, component->client_sub_id,
                                                        Connection::DisconnectFailReason::Kicked, message, std::nullopt,
@@ -502,7 +500,7 @@ void EndstonePlayer::sendTitle(std::string title, std::string subtitle, int fade
         pk->fade_in_time = fade_in;
         pk->stay_time = stay;
         pk->fade_out_time = fade_out;
-        getHandle().sendNetworkPacket(*packet);
+        queuePacket(packet);
     }
     {
         auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetTitle);
@@ -512,7 +510,7 @@ void EndstonePlayer::sendTitle(std::string title, std::string subtitle, int fade
         pk->fade_in_time = fade_in;
         pk->stay_time = stay;
         pk->fade_out_time = fade_out;
-        getHandle().sendNetworkPacket(*packet);
+        queuePacket(packet);
     }
 }
 
@@ -521,7 +519,7 @@ void EndstonePlayer::resetTitle() const
     auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetTitle);
     auto pk = std::static_pointer_cast<SetTitlePacket>(packet);
     pk->type = SetTitlePacket::TitleType::Reset;
-    getHandle().sendNetworkPacket(*packet);
+    queuePacket(packet);
 }
 
 void EndstonePlayer::spawnParticle(std::string name, Location location) const
@@ -559,24 +557,98 @@ std::chrono::milliseconds EndstonePlayer::getPing() const
     return std::chrono::milliseconds(peer->GetAveragePing(guid));
 }
 
+NetworkStats EndstonePlayer::getNetworkStats() const
+{
+    auto *peer = entt::locator<RakNet::RakPeerInterface *>::value();
+    auto *component = getHandle().tryGetComponent<UserEntityIdentifierComponent>();
+    RakNet::RakNetStatistics stats;
+    if (!peer->GetStatistics(peer->GetSystemAddressFromGuid(component->network_id.guid), &stats)) {
+        return {};
+    }
+    DatagramStats::Counter sent{0, 0};
+    DatagramStats::Counter received{0, 0};
+    if (peer_address_) {
+        const auto &datagram_stats = server_.datagram_stats_;
+        sent = datagram_stats.getPeer(*peer_address_, DatagramStats::Direction::Outbound).value_or(sent);
+        received = datagram_stats.getPeer(*peer_address_, DatagramStats::Direction::Inbound).value_or(received);
+    }
+    return {stats.running_total[RakNet::ACTUAL_BYTES_SENT],
+            stats.running_total[RakNet::ACTUAL_BYTES_RECEIVED],
+            stats.running_total[RakNet::USER_MESSAGE_BYTES_RESENT],
+            sent.datagrams,
+            received.datagrams,
+            stats.value_over_last_second[RakNet::ACTUAL_BYTES_SENT],
+            stats.value_over_last_second[RakNet::ACTUAL_BYTES_RECEIVED],
+            stats.packetloss_last_second};
+}
+
+std::vector<PacketTypeStats> EndstonePlayer::getPacketTypeStats() const
+{
+    return packet_stats_.getPacketTypeStats();
+}
+
+Result<void> EndstonePlayer::setChunkSendRate(int chunks_per_tick, int bytes_per_tick)
+{
+    if (chunks_per_tick < 0 || bytes_per_tick < 0) {
+        return nonstd::make_unexpected(
+            make_error("Chunk send rate must not be negative ({} chunks, {} bytes)", chunks_per_tick, bytes_per_tick));
+    }
+    chunk_send_queue_.setRate(chunks_per_tick, bytes_per_tick);
+    return {};
+}
+
+int EndstonePlayer::getChunksPerTick() const
+{
+    return chunk_send_queue_.getChunksPerTick();
+}
+
+int EndstonePlayer::getChunkBytesPerTick() const
+{
+    return chunk_send_queue_.getBytesPerTick();
+}
+
 void EndstonePlayer::updateCommands() const
 {
-    auto &registry = server_.getMinecraftCommands().getRegistry();
-    AvailableCommandsPacket packet = registry.serializeAvailableCommands();
+    AvailableCommandsPacket packet = server_.getMinecraftCommands().getRegistry().serializeAvailableCommands();
+    const auto commands = std::move(packet.commands);
+    sendCommands(packet, commands);
+}
+
+void EndstonePlayer::queueCommandUpdate() const
+{
+    server_.getCommandUpdateQueue().push(uuid_);
+}
 
+PacketStats &EndstonePlayer::getPacketStats() const
+{
+    return packet_stats_;
+}
+
+ChunkSendQueue &EndstonePlayer::getChunkSendQueue() const
+{
+    return chunk_send_queue_;
+}
+
+void EndstonePlayer::sendQueuedChunks() const
+{
+    const auto location = getLocation();
+    chunk_send_queue_.tick(location, location.getYaw());
+}
+
+void EndstonePlayer::sendCommands(AvailableCommandsPacket &packet,
+                                  const std::vector<AvailableCommandsPacket::CommandData> &commands) const
+{
     auto &command_map = server_.getCommandMap();
-    for (auto it = packet.commands.begin(); it != packet.commands.end();) {
-        auto &name = it->name;
-        auto *command = command_map.getCommand(name);
+    packet.commands.clear();
+    for (const auto &data : commands) {
+        auto *command = command_map.getCommand(data.name);
         if (command && command->isRegistered() && command->testPermissionSilently(*static_cast<const Player *>(this)) &&
-            it->permission_level <= player_.getCommandPermissionLevel()) {
-            ++it;
-            continue;
+            data.permission_level <= player_.getCommandPermissionLevel()) {
+            packet.commands.push_back(data);
         }
-        it = packet.commands.erase(it);
     }
 
-    getHandle().sendNetworkPacket(packet);
+    sendNetworkPacket(packet);
 }
 
 bool EndstonePlayer::performCommand(std::string command) const
@@ -654,7 +726,7 @@ void EndstonePlayer::transfer(std::string host, int port) const
     auto pk = std::static_pointer_cast<TransferPacket>(packet);
     pk->address = std::move(host);
     pk->port = port;
-    getHandle().sendNetworkPacket(*packet);
+    sendNetworkPacket(*packet);
 }
 
 void EndstonePlayer::sendForm(FormVariant form)
@@ -671,20 +743,20 @@ void EndstonePlayer::sendForm(FormVariant form)
                                form)
                         .dump();
     forms_.emplace(pk->form_id, std::move(form));
-    getHandle().sendNetworkPacket(*packet);
+    sendNetworkPacket(*packet);
 }
 
 void EndstonePlayer::closeForm()
 {
     auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::ClientboundCloseScreen);
-    getHandle().sendNetworkPacket(*packet);
+    sendNetworkPacket(*packet);
     forms_.clear();
 }
 
 void EndstonePlayer::sendPacket(Packet &packet) const
 {
     PacketAdapter pk{packet};
-    getHandle().sendNetworkPacket(pk);
+    sendNetworkPacket(pk);
 }
 
 void EndstonePlayer::onFormClose(int form_id, PlayerFormCloseReason /*reason*/)
@@ -831,14 +903,21 @@ void EndstonePlayer::initFromConnectionRequest(
         request);
 }
 
-void EndstonePlayer::disconnect() {}
+void EndstonePlayer::disconnect()
+{
+    flushPackets();
+    // the held back requests would be answered to a connection that is gone
+    chunk_send_queue_.clear();
+    // keep the resends of this connection in the server total once it is gone
+    server_.departed_bytes_resent_ += getNetworkStats().getBytesResent();
+}
 
 void EndstonePlayer::updateAbilities() const
 {
     auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::UpdateAbilitiesPacket);
     std::shared_ptr<UpdateAbilitiesPacket> pk = std::static_pointer_cast<UpdateAbilitiesPacket>(packet);
     pk->data = {getHandle().getOrCreateUniqueID(), getHandle().getAbilities()};
-    getHandle().sendNetworkPacket(*packet);
+    sendNetworkPacket(*packet);
 }
 
 ::Player &EndstonePlayer::getHandle() const
@@ -851,4 +930,42 @@ std::shared_ptr<EndstonePlayer> EndstonePlayer::create(EndstoneServer &server, :
     return PermissibleFactory::create<EndstonePlayer>(server, player);
 }
 
+void EndstonePlayer::queuePacket(std::shared_ptr<::Packet> packet) const
+{
+    packet_batch_.add(std::move(packet));
+}
+
+void EndstonePlayer::flushPackets(::Packet *packet) const
+{
+    // the packet sender hooks account for every packet sent, the batch is what was added during the flush
+    const auto bytes = packet_stats_.getTotal(PacketStats::Direction::Outbound).bytes;
+    if (const auto count = packet_batch_.flush(getHandle(), packet); count > 0) {
+        const auto size = packet_stats_.getTotal(PacketStats::Direction::Outbound).bytes - bytes;
+        server_.packet_batch_stats_.record(count, static_cast<std::size_t>(size));
+    }
+}
+
+void EndstonePlayer::sendNetworkPacket(::Packet &packet) const
+{
+    flushPackets(&packet);
+}
+
+std::shared_ptr<::Packet> EndstonePlayer::createTextPacket(const Message &message)
+{
+    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
+    auto pk = std::static_pointer_cast<TextPacket>(packet);
+    std::visit(overloaded{[&pk](const std::string &msg) {
+                              pk->type = TextPacketType::Raw;
+                              pk->message = msg;
+                          },
+                          [&pk](const Translatable &msg) {
+                              pk->type = TextPacketType::Translate;
+                              pk->message = msg.getText();
+                              pk->params = msg.getParameters();
+                              pk->localize = true;
+                          }},
+               message);
+    return packet;
+}
+
 }  // namespace endstone::core
@@ -15,16 +15,24 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
 #include "bedrock/network/connection_request.h"
+#include "bedrock/network/packet/available_commands_packet.h"
 #include "bedrock/network/sub_client_connection_request.h"
 #include "bedrock/world/events/player_events.h"
 #include "endstone/core/actor/mob.h"
 #include "endstone/core/inventory/player_inventory.h"
+#include "endstone/core/network/chunk_send_queue.h"
+#include "endstone/core/network/packet_batch.h"
+#include "endstone/core/network/packet_stats.h"
+#include "endstone/core/network/peer_address.h"
 #include "endstone/player.h"
 
+class Packet;
 class Player;
 class ServerNetworkHandler;
 
@@ -125,6 +133,11 @@ public:
     void spawnParticle(std::string name, float x, float y, float z,
                        std::optional<std::string> molang_variables_json) const override;
     [[nodiscard]] std::chrono::milliseconds getPing() const override;
+    [[nodiscard]] NetworkStats getNetworkStats() const override;
+    [[nodiscard]] std::vector<PacketTypeStats> getPacketTypeStats() const override;
+    Result<void> setChunkSendRate(int chunks_per_tick, int bytes_per_tick) override;
+    [[nodiscard]] int getChunksPerTick() const override;
+    [[nodiscard]] int getChunkBytesPerTick() const override;
     void updateCommands() const override;
     bool performCommand(std::string command) const override;  // NOLINT(*-use-nodiscard)
     [[nodiscard]] GameMode getGameMode() const override;
@@ -149,7 +162,53 @@ public:
     bool checkRightClickSpam(Vector<int> block_pos, Vector<float> click_pos);
     [[nodiscard]] ::Player &getHandle() const;
 
+    /**
+     * Queues a packet to be sent at the end of the current tick, together with the other packets queued for this
+     * player in the same tick.
+     */
+    void queuePacket(std::shared_ptr<::Packet> packet) const;
+
+    /**
+     * Sends the packets queued for this player in a single batch, followed by the given packet if any.
+     */
+    void flushPackets(::Packet *packet = nullptr) const;
+
+    /**
+     * Sends a packet right away. The packets queued for this player are sent first, in the same batch, so that they
+     * keep their order.
+     */
+    void sendNetworkPacket(::Packet &packet) const;
+
+    /**
+     * Queues an update of the command list, sent by the server at the end of the tick together with the updates of
+     * the other players. Used when many players need an update at once, e.g. on join and on reload.
+     */
+    void queueCommandUpdate() const;
+
+    /**
+     * Gets the game packets exchanged with this player, updated by the packet sender and the packet handlers.
+     */
+    [[nodiscard]] PacketStats &getPacketStats() const;
+
+    /**
+     * Gets the sub-chunk requests of this player held back by the chunk send rate, filled by the packet handlers.
+     */
+    [[nodiscard]] ChunkSendQueue &getChunkSendQueue() const;
+
+    /**
+     * Handles the sub-chunk requests that fit in the chunk budget of this tick, nearest and in front first.
+     */
+    void sendQueuedChunks() const;
+
+    /**
+     * Sends the commands this player is allowed to use, using a packet serialized from the command registry. The
+     * commands of the packet are replaced, the full list is passed separately so the packet can be reused.
+     */
+    void sendCommands(AvailableCommandsPacket &packet,
+                      const std::vector<AvailableCommandsPacket::CommandData> &commands) const;
+
     static std::shared_ptr<EndstonePlayer> create(EndstoneServer &server, ::Player &player);
+    static std::shared_ptr<::Packet> createTextPacket(const Message &message);
 
 private:
     friend class ::ServerNetworkHandler;
@@ -158,6 +217,7 @@ private:
     UUID uuid_;
     std::string xuid_;
     SocketAddress address_;
+    std::optional<PeerAddress> peer_address_;  // RakNet connections only
     std::shared_ptr<PermissibleBase> perm_;
     std::unique_ptr<EndstonePlayerInventory> inventory_;
     std::string locale_ = "en_US";
@@ -167,6 +227,9 @@ private:
     Skin skin_;
     int form_ids_ = 0xffff;  // Set to a large value to avoid collision with forms created by script api
     std::unordered_map<int, FormVariant> forms_;
+    mutable PacketBatch packet_batch_;
+    mutable PacketStats packet_stats_;
+    mutable ChunkSendQueue chunk_send_queue_;
 };
 
 }  // namespace endstone::core
@@ -0,0 +1,132 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/player_index.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "endstone/detail/hash.h"
+
+namespace endstone::core {
+
+namespace {
+template <typename Map, typename Key>
+void eraseIfOwned(Map &map, const Key &key, const Player *player)
+{
+    if (auto it = map.find(key); it != map.end() && it->second == player) {
+        map.erase(it);
+    }
+}
+}  // namespace
+
+void PlayerIndex::add(Player *player, std::string_view name, std::string_view xuid,
+                      const NetworkIdentifier &network_id, SubClientId sub_id)
+{
+    remove(player);
+
+    Keys keys{foldCase(name), std::string(xuid), {network_id, sub_id}};
+    by_name_[keys.name] = player;
+    if (!keys.xuid.empty()) {
+        by_xuid_[keys.xuid] = player;
+    }
+    by_network_id_[keys.network_key] = player;
+    keys_.emplace(player, std::move(keys));
+}
+
+void PlayerIndex::remove(Player *player)
+{
+    auto it = keys_.find(player);
+    if (it == keys_.end()) {
+        return;
+    }
+
+    // Only drop the entries that still point to this player, a newer one may have taken over the keys
+    const auto &keys = it->second;
+    eraseIfOwned(by_name_, keys.name, player);
+    eraseIfOwned(by_xuid_, keys.xuid, player);
+    eraseIfOwned(by_network_id_, keys.network_key, player);
+    keys_.erase(it);
+}
+
+Player *PlayerIndex::getByName(std::string_view name) const
+{
+    if (auto it = by_name_.find(foldCase(name)); it != by_name_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+Player *PlayerIndex::getByXuid(std::string_view xuid) const
+{
+    if (auto it = by_xuid_.find(std::string(xuid)); it != by_xuid_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+Player *PlayerIndex::getByNetworkId(const NetworkIdentifier &network_id, SubClientId sub_id) const
+{
+    if (auto it = by_network_id_.find({network_id, sub_id}); it != by_network_id_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+bool PlayerIndex::NetworkKey::operator==(const NetworkKey &other) const
+{
+    return sub_id == other.sub_id && network_id == other.network_id;
+}
+
+std::size_t PlayerIndex::NetworkKeyHash::operator()(const NetworkKey &key) const
+{
+    const auto &id = key.network_id;
+    auto seed = std::hash<std::uint32_t>{}(static_cast<std::uint32_t>(id.type));
+    // Only hash the fields that NetworkIdentifier::equalsTypeData compares for each type
+    switch (id.type) {
+    case NetworkIdentifier::Type::RakNet:
+        endstone::detail::hash_combine(seed, std::hash<std::uint64_t>{}(id.guid.g));
+        break;
+    case NetworkIdentifier::Type::Address:
+        endstone::detail::hash_combine(seed, std::hash<std::uint32_t>{}(id.sock.addr4.sin_addr.s_addr));
+        endstone::detail::hash_combine(seed, std::hash<std::uint16_t>{}(id.sock.addr4.sin_port));
+        break;
+    case NetworkIdentifier::Type::Address6: {
+        const auto *bytes = reinterpret_cast<const char *>(id.sock.addr6.sin6_addr.s6_addr);
+        const std::string_view address{bytes, sizeof(id.sock.addr6.sin6_addr.s6_addr)};
+        endstone::detail::hash_combine(seed, std::hash<std::string_view>{}(address));
+        endstone::detail::hash_combine(seed, std::hash<std::uint16_t>{}(id.sock.addr6.sin6_port));
+        break;
+    }
+    case NetworkIdentifier::Type::NetherNet:
+        endstone::detail::hash_combine(seed, std::hash<std::uint64_t>{}(id.nether_net_id));
+        break;
+    default:
+        break;
+    }
+    endstone::detail::hash_combine(seed, std::hash<std::uint8_t>{}(static_cast<std::uint8_t>(key.sub_id)));
+    return seed;
+}
+
+std::string PlayerIndex::foldCase(std::string_view name)
+{
+    std::string result(name);
+    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return std::tolower(c); });
+    return result;
+}
+
+}  // namespace endstone::core
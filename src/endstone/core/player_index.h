@@ -0,0 +1,68 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "bedrock/common_types.h"
+#include "bedrock/network/network_identifier.h"
+#include "endstone/player.h"
+
+namespace endstone::core {
+
+/**
+ * Indexes the online players by name, XUID and network identifier so that they can be looked up in constant time.
+ *
+ * Names are matched case-insensitively.
+ */
+class PlayerIndex {
+public:
+    void add(Player *player, std::string_view name, std::string_view xuid, const NetworkIdentifier &network_id,
+             SubClientId sub_id);
+    void remove(Player *player);
+
+    [[nodiscard]] Player *getByName(std::string_view name) const;
+    [[nodiscard]] Player *getByXuid(std::string_view xuid) const;
+    [[nodiscard]] Player *getByNetworkId(const NetworkIdentifier &network_id, SubClientId sub_id) const;
+
+private:
+    struct NetworkKey {
+        NetworkIdentifier network_id;
+        SubClientId sub_id;
+        bool operator==(const NetworkKey &other) const;
+    };
+
+    struct NetworkKeyHash {
+        std::size_t operator()(const NetworkKey &key) const;
+    };
+
+    struct Keys {
+        std::string name;
+        std::string xuid;
+        NetworkKey network_key;
+    };
+
+    static std::string foldCase(std::string_view name);
+
+    std::unordered_map<std::string, Player *> by_name_;
+    std::unordered_map<std::string, Player *> by_xuid_;
+    std::unordered_map<NetworkKey, Player *, NetworkKeyHash> by_network_id_;
+    std::unordered_map<const Player *, Keys> keys_;
+};
+
+}  // namespace endstone::core
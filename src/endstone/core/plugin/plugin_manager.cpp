@@ -27,6 +27,7 @@
 #include "endstone/event/event.h"
 #include "endstone/event/event_handler.h"
 #include "endstone/event/handler_list.h"
+#include "endstone/event/server/server_list_ping_event.h"
 #include "endstone/plugin/plugin.h"
 #include "endstone/plugin/plugin_loader.h"
 #include "endstone/scheduler/scheduler.h"
@@ -164,9 +165,12 @@ void EndstonePluginManager::disablePlugin(Plugin &plugin)
     if (plugin.isEnabled()) {
         plugin.getPluginLoader().disablePlugin(plugin);
         server_.getScheduler().cancelTasks(plugin);
+        server_.unregisterPacketListeners(plugin);
         for (auto &[name, handler] : event_handlers_) {
             handler.unregister(plugin);
         }
+        // the server info cached for server list pings may have been rendered by the plugin
+        server_.invalidateServerListPing();
     }
 }
 
@@ -236,6 +240,10 @@ Result<void> EndstonePluginManager::registerEvent(std::string event, std::functi
             make_error("Plugin {} failed to register listener for event {}: Handler type mismatch",
                        plugin.getDescription().getFullName(), event));
     }
+    if (event == ServerListPingEvent::NAME) {
+        // render the server info again so that pings already cached see the new handler
+        server_.invalidateServerListPing();
+    }
     return {};
 }
 
@@ -0,0 +1,50 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/scheduler/serial_executor.h"
+
+namespace endstone::core {
+
+SerialExecutor::SerialExecutor() : thread_(&SerialExecutor::worker, this) {}
+
+SerialExecutor::~SerialExecutor()
+{
+    {
+        std::lock_guard lock(mutex_);
+        done_ = true;
+    }
+    condition_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void SerialExecutor::worker()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(mutex_);
+            condition_.wait(lock, [this]() { return done_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;  // done and fully drained
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,66 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace endstone::core {
+
+/**
+ * Runs tasks one at a time on a single background thread, strictly in the order they were submitted, regardless of
+ * which thread submitted them. Tasks still queued when the executor is destroyed are run before it returns.
+ */
+class SerialExecutor {
+public:
+    SerialExecutor();
+    ~SerialExecutor();
+
+    SerialExecutor(const SerialExecutor &) = delete;
+    SerialExecutor &operator=(const SerialExecutor &) = delete;
+
+    template <typename Func, typename... Args>
+    auto submit(Func &&func, Args &&...args) -> std::future<std::invoke_result_t<Func, Args...>>
+    {
+        using ReturnType = std::invoke_result_t<Func, Args...>;
+
+        auto task = std::make_shared<std::packaged_task<ReturnType()>>(
+            std::bind(std::forward<Func>(func), std::forward<Args>(args)...));
+
+        auto result = task->get_future();
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.emplace_back([task]() { (*task)(); });
+        }
+        condition_.notify_one();
+        return result;
+    }
+
+private:
+    void worker();
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::function<void()>> tasks_;
+    bool done_{false};
+    std::thread thread_;
+};
+
+}  // namespace endstone::core
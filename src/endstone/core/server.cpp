@@ -14,6 +14,7 @@
 
 #include "endstone/core/server.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 
@@ -21,8 +22,9 @@
 
 namespace fs = std::filesystem;
 
-#include <boost/algorithm/string.hpp>
-
+#include "bedrock/entity/components/user_entity_identifier_component.h"
+#include "bedrock/network/packet/available_commands_packet.h"
+#include "bedrock/network/packet_sender.h"
 #include "bedrock/network/server_network_handler.h"
 #include "bedrock/platform/threading/assigned_thread.h"
 #include "bedrock/shared_constants.h"
@@ -38,6 +40,9 @@ namespace fs = std::filesystem;
 #include "endstone/core/level/level.h"
 #include "endstone/core/logger_factory.h"
 #include "endstone/core/message.h"
+#include "endstone/core/network/broadcast_targets.h"
+#include "endstone/core/network/packet_adapter.h"
+#include "endstone/core/network/server_list_ping.h"
 #include "endstone/core/permissions/default_permissions.h"
 #include "endstone/core/plugin/cpp_plugin_loader.h"
 #include "endstone/core/plugin/python_plugin_loader.h"
@@ -53,16 +58,20 @@ namespace fs = std::filesystem;
 
 namespace endstone::core {
 
-EndstoneServer::EndstoneServer() : logger_(LoggerFactory::getLogger("Server"))
+EndstoneServer::EndstoneServer()
+    : logger_(LoggerFactory::getLogger("Server")), chunk_loader_(*this), packet_pipeline_(logger_)
 {
     crash_handler_ = std::make_unique<CrashHandler>();
     signal_handler_ = std::make_unique<SignalHandler>();
-    player_ban_list_ = std::make_unique<EndstonePlayerBanList>("banned-players.json");
-    ip_ban_list_ = std::make_unique<EndstoneIpBanList>("banned-ips.json");
+    // both ban lists share a single writer thread
+    auto ban_list_writer = std::make_shared<SerialExecutor>();
+    player_ban_list_ = std::make_unique<EndstonePlayerBanList>("banned-players.json", ban_list_writer);
+    ip_ban_list_ = std::make_unique<EndstoneIpBanList>("banned-ips.json", ban_list_writer);
     language_ = std::make_unique<EndstoneLanguage>();
     plugin_manager_ = std::make_unique<EndstonePluginManager>(*this);
     command_sender_ = EndstoneConsoleCommandSender::create();
     scheduler_ = std::make_unique<EndstoneScheduler>(*this);
+    server_list_ping_.attach(packet_pipeline_);
     start_time_ = std::chrono::system_clock::now();
 }
 
@@ -143,6 +152,11 @@ MinecraftCommands &EndstoneServer::getMinecraftCommands() const
     return server_instance_->getMinecraft().getCommands();
 }
 
+CommandUpdateQueue &EndstoneServer::getCommandUpdateQueue()
+{
+    return command_update_queue_;
+}
+
 PluginManager &EndstoneServer::getPluginManager() const
 {
     return *plugin_manager_;
@@ -166,6 +180,12 @@ bool EndstoneServer::dispatchCommand(CommandSender &sender, std::string command_
     return command_map_->dispatch(sender, std::move(command_line));
 }
 
+std::vector<bool> EndstoneServer::dispatchCommands(CommandSender &sender,
+                                                   std::span<const std::string> command_lines) const
+{
+    return command_map_->dispatch(sender, command_lines);
+}
+
 void EndstoneServer::loadPlugins()
 {
     plugin_manager_->registerLoader(std::make_unique<CppPluginLoader>(*this));
@@ -237,14 +257,19 @@ void EndstoneServer::setLevel(std::unique_ptr<EndstoneLevel> level)
     hijackEventHandlers(level_->getHandle());
 }
 
+ChunkLoader &EndstoneServer::getChunkLoader()
+{
+    return chunk_loader_;
+}
+
 std::vector<Player *> EndstoneServer::getOnlinePlayers() const
 {
-    std::vector<Player *> result;
-    result.reserve(players_.size());
-    for (const auto &[id, player] : players_) {
-        result.push_back(player);
-    }
-    return result;
+    return online_players_.values();
+}
+
+std::uint64_t EndstoneServer::getOnlinePlayersVersion() const
+{
+    return online_players_.getVersion();
 }
 
 int EndstoneServer::getMaxPlayers() const
@@ -277,23 +302,17 @@ Player *EndstoneServer::getPlayer(UUID id) const
 
 Player *EndstoneServer::getPlayer(std::string name) const
 {
-    for (const auto &[_, player] : players_) {
-        if (boost::iequals(player->getName(), name)) {
-            return player;
-        }
-    }
-    return nullptr;
+    return player_index_.getByName(name);
+}
+
+Player *EndstoneServer::getPlayerByXuid(std::string xuid) const
+{
+    return player_index_.getByXuid(xuid);
 }
 
 Player *EndstoneServer::getPlayer(const NetworkIdentifier &network_id, SubClientId sub_id) const
 {
-    for (const auto &[uuid, player] : players_) {
-        if (const auto component = player->getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
-            component->network_id == network_id && component->client_sub_id == sub_id) {
-            return player;
-        }
-    }
-    return nullptr;
+    return player_index_.getByNetworkId(network_id, sub_id);
 }
 
 bool EndstoneServer::getOnlineMode() const
@@ -323,7 +342,7 @@ void EndstoneServer::reload()
 
     // sync commands
     for (const auto &[uuid, player] : players_) {
-        player->updateCommands();
+        player->queueCommandUpdate();
     }
 }
 
@@ -349,8 +368,18 @@ void EndstoneServer::broadcast(const Message &message, const std::string &permis
         return;
     }
 
+    std::vector<Player *> players;
     for (const auto &recipient : recipients) {
-        recipient->sendMessage(event.getMessage());
+        if (auto *player = recipient->asPlayer(); player) {
+            players.push_back(player);
+        }
+        else {
+            recipient->sendMessage(event.getMessage());
+        }
+    }
+
+    if (!players.empty()) {
+        broadcastPacket(*EndstonePlayer::createTextPacket(event.getMessage()), players);
     }
 }
 
@@ -359,6 +388,161 @@ void EndstoneServer::broadcastMessage(const Message &message) const
     broadcast(message, BroadcastChannelUser);
 }
 
+void EndstoneServer::broadcastPacket(Packet &packet, const std::vector<Player *> &recipients) const
+{
+    PacketAdapter pk{packet};
+    broadcastPacket(pk, recipients);
+}
+
+void EndstoneServer::broadcastPacket(const ::Packet &packet, const std::vector<Player *> &recipients) const
+{
+    BroadcastTargets targets{recipients.size()};
+    for (const auto *recipient : recipients) {
+        if (!recipient) {
+            continue;
+        }
+        const auto &player = static_cast<const EndstonePlayer &>(*recipient);
+        const auto *component = player.getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
+        if (!component || !targets.add(component->network_id, component->client_sub_id)) {
+            continue;
+        }
+        // the packets queued for the player were created before this one, they must reach the client first
+        player.flushPackets();
+    }
+
+    if (targets.empty()) {
+        return;
+    }
+
+    // The packet sender serializes the packet once and sends the same payload to every target
+    level_->getHandle().getPacketSender()->sendToClients(targets.get(), packet);
+}
+
+Result<void> EndstoneServer::registerPacketListener(Plugin &plugin, int packet_id,
+                                                    std::function<void(const OutboundPacket &)> listener)
+{
+    if (!plugin.isEnabled()) {
+        return nonstd::make_unexpected(make_error("Plugin {} attempted to register packet listener while not enabled.",
+                                                  plugin.getDescription().getFullName()));
+    }
+    if (packet_id < 0 || static_cast<std::size_t>(packet_id) >= PacketPipeline::MaxPacketId) {
+        return nonstd::make_unexpected(make_error("Packet ID {} is out of range.", packet_id));
+    }
+    packet_pipeline_.addPacketListener(packet_id, std::move(listener), &plugin);
+    return {};
+}
+
+Result<void> EndstoneServer::registerUnconnectedMessageListener(Plugin &plugin, std::uint8_t message_id,
+                                                                std::function<void(UnconnectedMessage &)> listener)
+{
+    if (!plugin.isEnabled()) {
+        return nonstd::make_unexpected(
+            make_error("Plugin {} attempted to register unconnected message listener while not enabled.",
+                       plugin.getDescription().getFullName()));
+    }
+    if (message_id >= PacketPipeline::MaxMessageId) {
+        return nonstd::make_unexpected(make_error("Message ID {:#04x} is not an unconnected message.", message_id));
+    }
+    packet_pipeline_.addMessageListener(message_id, std::move(listener), &plugin);
+    return {};
+}
+
+void EndstoneServer::unregisterPacketListeners(Plugin &plugin)
+{
+    packet_pipeline_.removeListeners(plugin);
+}
+
+NetworkStats EndstoneServer::getNetworkStats() const
+{
+    // bytes and datagrams are counted on the socket since startup, resends are only known per connection
+    const auto sent = datagram_stats_.getTotal(DatagramStats::Direction::Outbound);
+    const auto received = datagram_stats_.getTotal(DatagramStats::Direction::Inbound);
+    std::uint64_t bytes_resent = departed_bytes_resent_;
+    std::uint64_t send_rate = 0;
+    std::uint64_t receive_rate = 0;
+    double packets_lost = 0;  // packet loss weighted by the send rate of each player
+    for (const auto &[uuid, player] : players_) {
+        const auto stats = player->getNetworkStats();
+        bytes_resent += stats.getBytesResent();
+        send_rate += stats.getSendRate();
+        receive_rate += stats.getReceiveRate();
+        packets_lost += static_cast<double>(stats.getPacketLoss()) * static_cast<double>(stats.getSendRate());
+    }
+    const auto packet_loss = send_rate == 0 ? 0.0F : static_cast<float>(packets_lost / static_cast<double>(send_rate));
+    return {sent.bytes, received.bytes, bytes_resent, sent.datagrams, received.datagrams, send_rate, receive_rate,
+            packet_loss};
+}
+
+std::vector<PacketTypeStats> EndstoneServer::getPacketTypeStats() const
+{
+    return packet_stats_.getPacketTypeStats();
+}
+
+PacketRateLimitConfig EndstoneServer::getPacketRateLimit() const
+{
+    return packet_rate_limiter_.getConfig();
+}
+
+Result<void> EndstoneServer::setPacketRateLimit(const PacketRateLimitConfig &config)
+{
+    return packet_rate_limiter_.setConfig(config);
+}
+
+std::chrono::milliseconds EndstoneServer::getServerListPingCacheTtl() const
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(server_list_ping_.getTtl());
+}
+
+Result<void> EndstoneServer::setServerListPingCacheTtl(std::chrono::milliseconds ttl)
+{
+    if (ttl < std::chrono::milliseconds::zero()) {
+        return nonstd::make_unexpected(
+            make_error("Server list ping cache TTL must not be negative ({}ms)", ttl.count()));
+    }
+    server_list_ping_.setTtl(ttl);
+    return {};
+}
+
+void EndstoneServer::invalidateServerListPing()
+{
+    server_list_ping_.invalidate();
+}
+
+bool EndstoneServer::isServerListPingReplyEnabled() const
+{
+    return server_list_ping_.isReplyEnabled();
+}
+
+void EndstoneServer::setServerListPingReplyEnabled(bool enabled)
+{
+    server_list_ping_.setReplyEnabled(enabled);
+}
+
+DatagramStats &EndstoneServer::getDatagramStats()
+{
+    return datagram_stats_;
+}
+
+PacketPipeline &EndstoneServer::getPacketPipeline()
+{
+    return packet_pipeline_;
+}
+
+PacketRateLimiter &EndstoneServer::getPacketRateLimiter()
+{
+    return packet_rate_limiter_;
+}
+
+PacketStats &EndstoneServer::getPacketStats()
+{
+    return packet_stats_;
+}
+
+ServerListPing &EndstoneServer::getServerListPing()
+{
+    return server_list_ping_;
+}
+
 bool EndstoneServer::isPrimaryThread() const
 {
     return Bedrock::Threading::getServerThread().isOnThread();
@@ -437,6 +621,11 @@ Result<std::shared_ptr<BlockData>> EndstoneServer::createBlockData(std::string t
 
 Result<std::shared_ptr<BlockData>> EndstoneServer::createBlockData(std::string type, BlockStates block_states) const
 {
+    auto key = BlockDataCache::makeKey(type, block_states);
+    if (auto data = block_data_cache_.get(key)) {
+        return data;
+    }
+
     std::unordered_map<std::string, std::variant<int, std::string, bool>> states;
     for (const auto &state : block_states) {
         std::visit(overloaded{[&](auto &&arg) {
@@ -451,7 +640,14 @@ Result<std::shared_ptr<BlockData>> EndstoneServer::createBlockData(std::string t
         return nonstd::make_unexpected(make_error("Block type {} cannot be found in the registry.", type));
     }
 
-    return std::make_shared<EndstoneBlockData>(const_cast<::Block &>(*block));
+    auto data = block_data_cache_.intern(*block);
+    block_data_cache_.put(std::move(key), data);
+    return data;
+}
+
+BlockDataCache &EndstoneServer::getBlockDataCache() const
+{
+    return block_data_cache_;
 }
 
 PlayerBanList &EndstoneServer::getBanList() const
@@ -507,6 +703,27 @@ void EndstoneServer::removePlayerBoard(EndstonePlayer &player)
     return *server_instance_->getMinecraft().getServerNetworkHandler();
 }
 
+const PacketBatch::Stats &EndstoneServer::getPacketBatchStats() const
+{
+    return packet_batch_stats_;
+}
+
+void EndstoneServer::sendCommandUpdates()
+{
+    if (command_update_queue_.empty()) {
+        return;
+    }
+
+    // serialize the registry once, each player is sent the subset of the commands they are allowed to use
+    AvailableCommandsPacket packet = getMinecraftCommands().getRegistry().serializeAvailableCommands();
+    const auto commands = std::move(packet.commands);
+    for (const auto &player_id : command_update_queue_.pop()) {
+        if (auto it = players_.find(player_id); it != players_.end()) {
+            it->second->sendCommands(packet, commands);
+        }
+    }
+}
+
 void EndstoneServer::tick(std::uint64_t current_tick, const std::function<void()> &tick_function)
 {
     using namespace std::chrono;
@@ -515,6 +732,13 @@ void EndstoneServer::tick(std::uint64_t current_tick, const std::function<void()
 
     scheduler_->mainThreadHeartbeat(current_tick);
     tick_function();
+    chunk_loader_.tick(current_tick);
+    sendCommandUpdates();
+
+    for (const auto &[uuid, player] : players_) {
+        player->sendQueuedChunks();
+        player->flushPackets();
+    }
 
     current_mspt_ = static_cast<float>(duration_cast<milliseconds>(steady_clock::now() - tick_time).count());
     current_tps_ = std::min(static_cast<float>(TargetTicksPerSecond), 1000.0F / std::max(1.0F, current_mspt_));
@@ -22,17 +22,27 @@
 #include "bedrock/server/server_instance.h"
 #include "endstone/core/ban/ip_ban_list.h"
 #include "endstone/core/ban/player_ban_list.h"
+#include "endstone/core/block/block_data_cache.h"
 #include "endstone/core/command/command_map.h"
+#include "endstone/core/command/command_update_queue.h"
 #include "endstone/core/command/console_command_sender.h"
 #include "endstone/core/crash_handler.h"
 #include "endstone/core/lang/language.h"
+#include "endstone/core/level/chunk_loader.h"
 #include "endstone/core/level/level.h"
+#include "endstone/core/network/datagram_stats.h"
+#include "endstone/core/network/packet_pipeline.h"
+#include "endstone/core/network/packet_rate_limiter.h"
+#include "endstone/core/network/packet_stats.h"
+#include "endstone/core/network/server_list_ping.h"
 #include "endstone/core/packs/endstone_pack_source.h"
 #include "endstone/core/player.h"
+#include "endstone/core/player_index.h"
 #include "endstone/core/plugin/plugin_manager.h"
 #include "endstone/core/scheduler/scheduler.h"
 #include "endstone/core/scoreboard/scoreboard.h"
 #include "endstone/core/signal_handler.h"
+#include "endstone/core/util/tracked_list.h"
 #include "endstone/plugin/plugin_manager.h"
 #include "endstone/server.h"
 
@@ -59,10 +69,13 @@ public:
     [[nodiscard]] EndstoneCommandMap &getCommandMap() const;
     void setCommandMap(std::unique_ptr<EndstoneCommandMap> command_map);
     [[nodiscard]] MinecraftCommands &getMinecraftCommands() const;
+    [[nodiscard]] CommandUpdateQueue &getCommandUpdateQueue();
     [[nodiscard]] PluginManager &getPluginManager() const override;
     [[nodiscard]] PluginCommand *getPluginCommand(std::string name) const override;
     [[nodiscard]] ConsoleCommandSender &getCommandSender() const override;
     [[nodiscard]] bool dispatchCommand(CommandSender &sender, std::string command_line) const override;
+    [[nodiscard]] std::vector<bool> dispatchCommands(CommandSender &sender,
+                                                     std::span<const std::string> command_lines) const override;
 
     void loadPlugins();
     void enablePlugins(PluginLoadOrder type);
@@ -72,12 +85,15 @@ public:
 
     [[nodiscard]] Level *getLevel() const override;
     void setLevel(std::unique_ptr<EndstoneLevel> level);
+    [[nodiscard]] ChunkLoader &getChunkLoader();
 
     [[nodiscard]] std::vector<Player *> getOnlinePlayers() const override;
+    [[nodiscard]] std::uint64_t getOnlinePlayersVersion() const override;
     [[nodiscard]] int getMaxPlayers() const override;
     Result<void> setMaxPlayers(int max_players) override;
     [[nodiscard]] Player *getPlayer(endstone::UUID id) const override;
     [[nodiscard]] Player *getPlayer(std::string name) const override;
+    [[nodiscard]] Player *getPlayerByXuid(std::string xuid) const override;
     [[nodiscard]] Player *getPlayer(const ::NetworkIdentifier &network_id, SubClientId sub_id) const;
 
     [[nodiscard]] bool getOnlineMode() const override;
@@ -87,6 +103,27 @@ public:
 
     void broadcast(const Message &message, const std::string &permission) const override;
     void broadcastMessage(const Message &message) const override;
+    void broadcastPacket(Packet &packet, const std::vector<Player *> &recipients) const override;
+    void broadcastPacket(const ::Packet &packet, const std::vector<Player *> &recipients) const;
+    Result<void> registerPacketListener(Plugin &plugin, int packet_id,
+                                        std::function<void(const OutboundPacket &)> listener) override;
+    Result<void> registerUnconnectedMessageListener(Plugin &plugin, std::uint8_t message_id,
+                                                    std::function<void(UnconnectedMessage &)> listener) override;
+    void unregisterPacketListeners(Plugin &plugin) override;
+    [[nodiscard]] NetworkStats getNetworkStats() const override;
+    [[nodiscard]] std::vector<PacketTypeStats> getPacketTypeStats() const override;
+    [[nodiscard]] PacketRateLimitConfig getPacketRateLimit() const override;
+    Result<void> setPacketRateLimit(const PacketRateLimitConfig &config) override;
+    [[nodiscard]] std::chrono::milliseconds getServerListPingCacheTtl() const override;
+    Result<void> setServerListPingCacheTtl(std::chrono::milliseconds ttl) override;
+    void invalidateServerListPing() override;
+    [[nodiscard]] bool isServerListPingReplyEnabled() const override;
+    void setServerListPingReplyEnabled(bool enabled) override;
+    [[nodiscard]] DatagramStats &getDatagramStats();
+    [[nodiscard]] PacketPipeline &getPacketPipeline();
+    [[nodiscard]] PacketRateLimiter &getPacketRateLimiter();
+    [[nodiscard]] PacketStats &getPacketStats();
+    [[nodiscard]] ServerListPing &getServerListPing();
 
     [[nodiscard]] bool isPrimaryThread() const override;
 
@@ -107,6 +144,7 @@ public:
     [[nodiscard]] Result<std::shared_ptr<BlockData>> createBlockData(std::string type) const override;
     [[nodiscard]] Result<std::shared_ptr<BlockData>> createBlockData(std::string type,
                                                                      BlockStates block_states) const override;
+    [[nodiscard]] BlockDataCache &getBlockDataCache() const;
     [[nodiscard]] PlayerBanList &getBanList() const override;
     [[nodiscard]] IpBanList &getIpBanList() const override;
 
@@ -115,6 +153,7 @@ public:
     void removePlayerBoard(EndstonePlayer &player);
     [[nodiscard]] ::ServerNetworkHandler &getServerNetworkHandler() const;
     void tick(std::uint64_t current_tick, const std::function<void()> &tick_function);
+    [[nodiscard]] const PacketBatch::Stats &getPacketBatchStats() const;
 
     static constexpr int MaxPlayers = 200;
     static constexpr int TargetTicksPerSecond = 20;
@@ -125,6 +164,7 @@ private:
 
     void enablePlugin(Plugin &plugin);
     void hijackEventHandlers(::Level &level);
+    void sendCommandUpdates();
 
     ServerInstance *server_instance_;
     Logger &logger_;
@@ -137,8 +177,20 @@ private:
     std::shared_ptr<EndstoneConsoleCommandSender> command_sender_;
     std::unique_ptr<EndstoneScheduler> scheduler_;
     std::unique_ptr<EndstoneCommandMap> command_map_;
+    CommandUpdateQueue command_update_queue_;
     std::unique_ptr<EndstoneLevel> level_;
+    ChunkLoader chunk_loader_;
     std::unordered_map<UUID, EndstonePlayer *> players_;
+    TrackedList<Player> online_players_;
+    PlayerIndex player_index_;
+    mutable BlockDataCache block_data_cache_;
+    PacketBatch::Stats packet_batch_stats_;
+    PacketPipeline packet_pipeline_;
+    DatagramStats datagram_stats_;
+    std::uint64_t departed_bytes_resent_ = 0;  // bytes resent to players that have left
+    PacketRateLimiter packet_rate_limiter_;
+    PacketStats packet_stats_;
+    ServerListPing server_list_ping_;
     std::shared_ptr<EndstoneScoreboard> scoreboard_;
     std::vector<std::weak_ptr<EndstoneScoreboard>> scoreboards_;
     std::unordered_map<const EndstonePlayer *, std::shared_ptr<EndstoneScoreboard>> player_boards_;
@@ -0,0 +1,169 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/util/durable_file.h"
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fmt/std.h>
+
+#include "endstone/core/util/error.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace endstone::core {
+
+namespace {
+std::string last_error()
+{
+    return std::system_category().message(errno);
+}
+}  // namespace
+
+DurableFile::DurableFile(int fd, std::filesystem::path path) : fd_(fd), path_(std::move(path)) {}
+
+DurableFile::~DurableFile()
+{
+    close();
+}
+
+DurableFile::DurableFile(DurableFile &&other) noexcept
+    : fd_(std::exchange(other.fd_, -1)), path_(std::move(other.path_))
+{
+}
+
+DurableFile &DurableFile::operator=(DurableFile &&other) noexcept
+{
+    if (this != &other) {
+        close();
+        fd_ = std::exchange(other.fd_, -1);
+        path_ = std::move(other.path_);
+    }
+    return *this;
+}
+
+Result<DurableFile> DurableFile::open(const std::filesystem::path &path, Mode mode)
+{
+#ifdef _WIN32
+    int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (mode == Mode::Append ? _O_APPEND : _O_TRUNC);
+    int fd = _wopen(path.c_str(), flags, _S_IREAD | _S_IWRITE);
+#else
+    int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (mode == Mode::Append ? O_APPEND : O_TRUNC);
+    int fd = ::open(path.c_str(), flags, 0644);
+#endif
+    if (fd < 0) {
+        return nonstd::make_unexpected(make_error("Unable to open file '{}': {}", path, last_error()));
+    }
+    return DurableFile{fd, path};
+}
+
+bool DurableFile::isOpen() const
+{
+    return fd_ >= 0;
+}
+
+Result<void> DurableFile::write(std::string_view data)
+{
+    while (!data.empty()) {
+#ifdef _WIN32
+        auto written = _write(fd_, data.data(), static_cast<unsigned int>(data.size()));
+#else
+        auto written = ::write(fd_, data.data(), data.size());
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+#endif
+        if (written < 0) {
+            return nonstd::make_unexpected(make_error("Unable to write file '{}': {}", path_, last_error()));
+        }
+        data.remove_prefix(static_cast<std::size_t>(written));
+    }
+    return {};
+}
+
+Result<void> DurableFile::sync()
+{
+#ifdef _WIN32
+    auto result = _commit(fd_);
+#else
+    auto result = ::fsync(fd_);
+#endif
+    if (result != 0) {
+        return nonstd::make_unexpected(make_error("Unable to write file '{}': {}", path_, last_error()));
+    }
+    return {};
+}
+
+Result<void> DurableFile::close()
+{
+    if (fd_ < 0) {
+        return {};
+    }
+#ifdef _WIN32
+    auto result = _close(std::exchange(fd_, -1));
+#else
+    auto result = ::close(std::exchange(fd_, -1));
+#endif
+    if (result != 0) {
+        return nonstd::make_unexpected(make_error("Unable to write file '{}': {}", path_, last_error()));
+    }
+    return {};
+}
+
+Result<void> rename_durably(const std::filesystem::path &from, const std::filesystem::path &to)
+{
+#ifdef _WIN32
+    // MOVEFILE_WRITE_THROUGH does not return until the move has been flushed to disk
+    if (!MoveFileExW(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        return nonstd::make_unexpected(make_error("Unable to write file '{}': {}", to,
+                                                  std::system_category().message(static_cast<int>(GetLastError()))));
+    }
+#else
+    std::error_code ec;
+    std::filesystem::rename(from, to, ec);
+    if (ec) {
+        return nonstd::make_unexpected(make_error("Unable to write file '{}': {}", to, ec.message()));
+    }
+
+    // The rename is only durable once the directory holding the new entry has been synced as well
+    auto dir = to.parent_path();
+    if (dir.empty()) {
+        dir = ".";
+    }
+    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return nonstd::make_unexpected(make_error("Unable to open directory '{}': {}", dir, last_error()));
+    }
+    auto result = ::fsync(fd);
+    auto error = errno;
+    ::close(fd);
+    if (result != 0) {
+        return nonstd::make_unexpected(
+            make_error("Unable to write file '{}': {}", to, std::system_category().message(error)));
+    }
+#endif
+    return {};
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,64 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+
+#include "endstone/util/result.h"
+
+namespace endstone::core {
+
+/**
+ * A file opened for writing whose contents can be forced onto the storage device with sync().
+ *
+ * Unlike std::ofstream::flush, which only hands the data to the operating system, sync() returns once the data would
+ * survive a power loss.
+ */
+class DurableFile {
+public:
+    enum class Mode {
+        Truncate,
+        Append,
+    };
+
+    DurableFile() = default;
+    ~DurableFile();
+
+    DurableFile(const DurableFile &) = delete;
+    DurableFile &operator=(const DurableFile &) = delete;
+    DurableFile(DurableFile &&other) noexcept;
+    DurableFile &operator=(DurableFile &&other) noexcept;
+
+    [[nodiscard]] static Result<DurableFile> open(const std::filesystem::path &path, Mode mode);
+
+    [[nodiscard]] bool isOpen() const;
+    Result<void> write(std::string_view data);
+    Result<void> sync();
+    Result<void> close();
+
+private:
+    explicit DurableFile(int fd, std::filesystem::path path);
+
+    int fd_{-1};
+    std::filesystem::path path_;
+};
+
+/**
+ * Renames a file over another one and waits until the new directory entry is on the storage device.
+ */
+Result<void> rename_durably(const std::filesystem::path &from, const std::filesystem::path &to);
+
+}  // namespace endstone::core
@@ -0,0 +1,64 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/util/latency_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace endstone::core {
+
+LatencyTracker::LatencyTracker(std::size_t capacity) : capacity_(std::max<std::size_t>(capacity, 1))
+{
+    samples_.reserve(capacity_);
+}
+
+void LatencyTracker::record(Duration latency)
+{
+    std::lock_guard lock(mutex_);
+    if (samples_.size() < capacity_) {
+        samples_.push_back(latency.count());
+    }
+    else {
+        samples_[next_] = latency.count();
+    }
+    next_ = (next_ + 1) % capacity_;
+    count_++;
+}
+
+LatencyTracker::Duration LatencyTracker::getPercentile(double percentile) const
+{
+    std::vector<double> samples;
+    {
+        std::lock_guard lock(mutex_);
+        samples = samples_;
+    }
+    if (samples.empty()) {
+        return Duration::zero();
+    }
+
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(samples.size())));
+    rank = std::max<std::size_t>(rank, 1) - 1;
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(rank), samples.end());
+    return Duration(samples[rank]);
+}
+
+std::uint64_t LatencyTracker::getCount() const
+{
+    std::lock_guard lock(mutex_);
+    return count_;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace endstone::core {
+
+/**
+ * Keeps a rolling window of the most recent latency samples and computes percentiles over it.
+ *
+ * This class is thread-safe.
+ */
+class LatencyTracker {
+public:
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    static constexpr std::size_t DefaultCapacity = 256;
+
+    explicit LatencyTracker(std::size_t capacity = DefaultCapacity);
+
+    void record(Duration latency);
+
+    /**
+     * Gets the given percentile (between 0 and 100) of the recorded samples using the nearest-rank method.
+     *
+     * @param percentile the percentile to compute
+     * @return the latency at the given percentile, or zero if nothing has been recorded
+     */
+    [[nodiscard]] Duration getPercentile(double percentile) const;
+    [[nodiscard]] std::uint64_t getCount() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::size_t capacity_;
+    std::vector<double> samples_;
+    std::size_t next_{0};
+    std::uint64_t count_{0};
+};
+
+}  // namespace endstone::core
@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace endstone::core {
+
+/**
+ * An unordered list of pointers that supports constant time insertion and removal and keeps its elements contiguous,
+ * so that snapshots of it can be taken with a single copy.
+ *
+ * Every successful insertion or removal bumps the version, which lets callers detect changes cheaply.
+ */
+template <typename T>
+class TrackedList {
+public:
+    /**
+     * Adds a value to the list.
+     *
+     * @param value the value to add
+     * @return true if the value was added, false if it was already present
+     */
+    bool add(T *value)
+    {
+        if (!value || index_.contains(value)) {
+            return false;
+        }
+        index_.emplace(value, values_.size());
+        values_.push_back(value);
+        version_++;
+        return true;
+    }
+
+    /**
+     * Removes a value from the list. The last element takes the place of the removed one.
+     *
+     * @param value the value to remove
+     * @return true if the value was removed, false if it was not present
+     */
+    bool remove(T *value)
+    {
+        auto it = index_.find(value);
+        if (it == index_.end()) {
+            return false;
+        }
+
+        const auto pos = it->second;
+        index_.erase(it);
+        if (pos != values_.size() - 1) {
+            values_[pos] = values_.back();
+            index_[values_[pos]] = pos;
+        }
+        values_.pop_back();
+        version_++;
+        return true;
+    }
+
+    [[nodiscard]] bool contains(T *value) const
+    {
+        return index_.contains(value);
+    }
+
+    [[nodiscard]] const std::vector<T *> &values() const
+    {
+        return values_;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return values_.size();
+    }
+
+    [[nodiscard]] std::uint64_t getVersion() const
+    {
+        return version_;
+    }
+
+private:
+    std::vector<T *> values_;
+    std::unordered_map<T *, std::size_t> index_;
+    std::uint64_t version_{0};
+};
+
+}  // namespace endstone::core
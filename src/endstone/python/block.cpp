@@ -17,6 +17,7 @@
 #include <string>
 
 #include <fmt/format.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -42,6 +43,79 @@ void init_block(py::module_ &m, py::class_<Block> &block)
         .def_property_readonly("block_states", &BlockData::getBlockStates, "Gets the block states for this block.")
         .def("__str__", [](const BlockData &self) { return fmt::format("{}", self); });
 
+    py::class_<BlockVolume>(m, "BlockVolume",
+                            "Represents a cuboid of blocks, stored as a palette of distinct block data and one palette "
+                            "index per block.")
+        .def(py::init<int, int, int, int, int, int>(), py::arg("x"), py::arg("y"), py::arg("z"), py::arg("width"),
+             py::arg("height"), py::arg("depth"))
+        .def_property_readonly("x", &BlockVolume::getX, "Gets the x-coordinate of the minimum corner.")
+        .def_property_readonly("y", &BlockVolume::getY, "Gets the y-coordinate of the minimum corner.")
+        .def_property_readonly("z", &BlockVolume::getZ, "Gets the z-coordinate of the minimum corner.")
+        .def_property_readonly("width", &BlockVolume::getWidth, "Gets the size of this volume along the X axis.")
+        .def_property_readonly("height", &BlockVolume::getHeight, "Gets the size of this volume along the Y axis.")
+        .def_property_readonly("depth", &BlockVolume::getDepth, "Gets the size of this volume along the Z axis.")
+        .def_property_readonly("palette", &BlockVolume::getPalette, "Gets the distinct block data in this volume.")
+        .def("add_to_palette", &BlockVolume::addToPalette, py::arg("data"),
+             "Adds block data to the palette and returns its index.")
+        .def_property_readonly(
+            "indices",
+            [](py::object self) {
+                auto &volume = self.cast<BlockVolume &>();
+                const auto width = static_cast<py::ssize_t>(volume.getWidth());
+                const auto depth = static_cast<py::ssize_t>(volume.getDepth());
+                constexpr auto size = static_cast<py::ssize_t>(sizeof(BlockVolume::Index));
+                // a writable view of the indices, which keeps the volume alive
+                return py::array_t<BlockVolume::Index>({volume.getHeight(), volume.getDepth(), volume.getWidth()},
+                                                       {depth * width * size, width * size, size},
+                                                       volume.getIndices().data(), self);
+            },
+            "Gets the palette index of every block as an array of shape (height, depth, width).")
+        .def("get_block_data", &BlockVolume::getBlockData, py::arg("x"), py::arg("y"), py::arg("z"),
+             "Gets the block data at the given world coordinates.")
+        .def("set_index", &BlockVolume::setIndex, py::arg("x"), py::arg("y"), py::arg("z"), py::arg("index"),
+             "Sets the palette index of the block at the given world coordinates.");
+
+    py::class_<BlockRef>(m, "BlockRef", "A lightweight reference to the block at a position in a dimension.")
+        .def(py::init<Dimension &, int, int, int>(), py::arg("dimension"), py::arg("x"), py::arg("y"), py::arg("z"))
+        .def_property_readonly("dimension", &BlockRef::getDimension, py::return_value_policy::reference,
+                               "Gets the dimension which contains this block.")
+        .def_property_readonly("x", &BlockRef::getX, "Gets the x-coordinate of this block.")
+        .def_property_readonly("y", &BlockRef::getY, "Gets the y-coordinate of this block.")
+        .def_property_readonly("z", &BlockRef::getZ, "Gets the z-coordinate of this block.")
+        .def("get_relative", py::overload_cast<int, int, int>(&BlockRef::getRelative, py::const_),
+             py::arg("offset_x"), py::arg("offset_y"), py::arg("offset_z"), "Gets the block at the given offsets.")
+        .def("get_relative", py::overload_cast<BlockFace, int>(&BlockRef::getRelative, py::const_), py::arg("face"),
+             py::arg("distance") = 1, "Gets the block at the given distance of the given face.")
+        .def_property_readonly("neighbors", &BlockRef::getNeighbors,
+                               "Gets the six blocks sharing a face with this block, in the order of BlockFace.")
+        .def_property_readonly("type", &BlockRef::getType, "Gets the type of this block.")
+        .def_property(
+            "data", &BlockRef::getData,
+            [](const BlockRef &self, std::shared_ptr<BlockData> data) { return self.setData(std::move(data)); },
+            "Gets or sets the complete data for this block.")
+        .def("set_data", &BlockRef::setData, py::arg("data"), py::arg("apply_physics") = true,
+             "Sets the complete data for this block.")
+        .def_property_readonly("block", &BlockRef::getBlock, "Gets the Block at the position of this reference.")
+        .def("__eq__", [](const BlockRef &self, const BlockRef &other) { return self == other; })
+        .def("__hash__", [](const BlockRef &self) { return std::hash<BlockRef>{}(self); })
+        .def("__repr__", [](const BlockRef &self) {
+            return fmt::format("BlockRef(x={}, y={}, z={})", self.getX(), self.getY(), self.getZ());
+        });
+
+    py::class_<BlockTransaction>(m, "BlockTransaction",
+                                 "Collects block changes so that they can be applied to a dimension at once.")
+        .def(py::init<>())
+        .def("set_block_data", &BlockTransaction::setBlockData, py::arg("x"), py::arg("y"), py::arg("z"),
+             py::arg("data"), "Sets the block data at the given coordinates.")
+        .def("get_block_data", &BlockTransaction::getBlockData, py::arg("x"), py::arg("y"), py::arg("z"),
+             "Gets the pending block data at the given coordinates, or None if the block is not changed.")
+        .def("clear", &BlockTransaction::clear, "Discards all changes.")
+        .def("__contains__",
+             [](const BlockTransaction &self, std::tuple<int, int, int> pos) {
+                 return self.contains(std::get<0>(pos), std::get<1>(pos), std::get<2>(pos));
+             })
+        .def("__len__", &BlockTransaction::size);
+
     py::class_<BlockState, std::shared_ptr<BlockState>>(
         m, "BlockState", "Represents a captured state of a block, which will not update automatically.")
         .def_property_readonly("block", &BlockState::getBlock, "Gets the block represented by this block state.")
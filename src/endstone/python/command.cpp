@@ -39,11 +39,14 @@ namespace {
 Command createCommand(const std::string &name, const std::optional<std::string> &description,
                       const std::optional<std::vector<std::string>> &usages,
                       const std::optional<std::vector<std::string>> &aliases,
-                      const std::optional<std::vector<std::string>> &permissions, const py::args & /*args*/,
-                      const py::kwargs & /*kwargs*/)
+                      const std::optional<std::vector<std::string>> &permissions, const std::optional<bool> &is_async,
+                      const py::args & /*args*/, const py::kwargs & /*kwargs*/)
 {
-    return Command(std::move(name), description.value_or(""), usages.value_or(std::vector<std::string>{}),
-                   aliases.value_or(std::vector<std::string>{}), permissions.value_or(std::vector<std::string>{}));
+    auto command = Command(std::move(name), description.value_or(""), usages.value_or(std::vector<std::string>{}),
+                           aliases.value_or(std::vector<std::string>{}),
+                           permissions.value_or(std::vector<std::string>{}));
+    command.setAsync(is_async.value_or(false));
+    return command;
 }
 }  // namespace
 
@@ -73,7 +76,8 @@ void init_command(py::module &m, py::class_<CommandSender, Permissible> &command
     py::class_<Command, std::shared_ptr<Command>>(m, "Command",
                                                   "Represents a Command, which executes various tasks upon user input")
         .def(py::init(&createCommand), py::arg("name"), py::arg("description") = py::none(),
-             py::arg("usages") = py::none(), py::arg("aliases") = py::none(), py::arg("permissions") = py::none())
+             py::arg("usages") = py::none(), py::arg("aliases") = py::none(), py::arg("permissions") = py::none(),
+             py::arg("is_async") = py::none())
         .def("execute", &Command::execute, py::arg("sender"), py::arg("args"),
              "Executes the command, returning its success")
         .def("test_permission", &Command::testPermission, py::arg("target"),
@@ -95,6 +99,10 @@ void init_command(py::module &m, py::class_<CommandSender, Permissible> &command
             "permissions", &Command::getPermissions,
             [](Command &self, const std::vector<std::string> &permissions) { self.setPermissions(permissions); },
             "The permissions required by users to be able to perform this command")
+        .def_property("is_async", &Command::isAsync, &Command::setAsync,
+                      "Whether this command is executed asynchronously off the server thread. Asynchronous commands "
+                      "report success as soon as they are scheduled, so returning False does not show the usage. "
+                      "Cannot be changed once the command is registered.")
         .def_property_readonly("is_registered", &Command::isRegistered,
                                "Returns the current registered state of this command");
 
@@ -15,6 +15,7 @@
 #include <utility>
 
 #include <pybind11/chrono.h>
+#include <pybind11/functional.h>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -203,18 +204,29 @@ void init_server(py::class_<Server> &server)
                                "Gets a CommandSender for this server.")
         .def("dispatch_command", &Server::dispatchCommand, py::arg("sender"), py::arg("command_line"),
              "Dispatches a command on this server, and executes it if found.")
+        .def(
+            "dispatch_commands",
+            [](const Server &self, CommandSender &sender, const std::vector<std::string> &command_lines) {
+                return self.dispatchCommands(sender, command_lines);
+            },
+            py::arg("sender"), py::arg("command_lines"),
+            "Dispatches multiple commands on this server in a batch, and executes them if found.")
         .def_property_readonly("scheduler", &Server::getScheduler, py::return_value_policy::reference,
                                "Gets the scheduler for managing scheduled events.")
         .def_property_readonly("level", &Server::getLevel, py::return_value_policy::reference_internal,
                                "Gets the server level.")
         .def_property_readonly("online_players", &Server::getOnlinePlayers, py::return_value_policy::reference_internal,
                                "Gets a list of all currently online players.")
+        .def_property_readonly("online_players_version", &Server::getOnlinePlayersVersion,
+                               "Gets a counter that changes whenever a player joins or quits.")
         .def_property("max_players", &Server::getMaxPlayers, &Server::setMaxPlayers,
                       "The maximum amount of players which can login to this server.")
         .def("get_player", py::overload_cast<std::string>(&Server::getPlayer, py::const_), py::arg("name").noconvert(),
              py::return_value_policy::reference, "Gets the player with the exact given name, case insensitive.")
         .def("get_player", py::overload_cast<UUID>(&Server::getPlayer, py::const_), py::arg("unique_id").noconvert(),
              py::return_value_policy::reference, "Gets the player with the given UUID.")
+        .def("get_player_by_xuid", &Server::getPlayerByXuid, py::arg("xuid"), py::return_value_policy::reference,
+             "Gets the player with the given Xbox User ID (XUID).")
         .def_property_readonly("online_mode", &Server::getOnlineMode,
                                "Gets whether the Server is in online mode or not.")
         .def("shutdown", &Server::shutdown, "Shutdowns the server, stopping everything.")
@@ -226,6 +238,43 @@ void init_server(py::class_<Server> &server)
             "broadcast_message", [](const Server &self, const Message &message) { self.broadcastMessage(message); },
             py::arg("message"),
             "Broadcasts the specified message to every user with permission endstone.broadcast.user")
+        .def("broadcast_packet", &Server::broadcastPacket, py::arg("packet"), py::arg("recipients"),
+             "Sends a packet to multiple players at once.")
+        .def(
+            "register_packet_listener",
+            [](Server &self, Plugin &plugin, int packet_id,
+               const std::function<void(const OutboundPacket *)> &listener) {
+                return self.registerPacketListener(plugin, packet_id,
+                                                   [listener](const OutboundPacket &packet) { listener(&packet); });
+            },
+            py::arg("plugin"), py::arg("packet_id"), py::arg("listener"),
+            "Registers a listener for the game packets with the given Minecraft packet ID sent to players.")
+        .def(
+            "register_unconnected_message_listener",
+            [](Server &self, Plugin &plugin, std::uint8_t message_id,
+               const std::function<void(UnconnectedMessage *)> &listener) {
+                return self.registerUnconnectedMessageListener(
+                    plugin, message_id, [listener](UnconnectedMessage &message) { listener(&message); });
+            },
+            py::arg("plugin"), py::arg("message_id"), py::arg("listener"),
+            "Registers a listener for the unconnected RakNet messages with the given message ID sent by the server.")
+        .def("unregister_packet_listeners", &Server::unregisterPacketListeners, py::arg("plugin"),
+             "Unregisters all packet listeners registered by a plugin.")
+        .def_property_readonly("network_stats", &Server::getNetworkStats,
+                               "Gets the network statistics of the server since it started.")
+        .def_property_readonly("packet_type_stats", &Server::getPacketTypeStats,
+                               "Gets the game packets exchanged with all players per packet type since the server "
+                               "started.")
+        .def_property("packet_rate_limit", &Server::getPacketRateLimit, &Server::setPacketRateLimit,
+                      "Gets or sets the limits applied to incoming RakNet datagrams.")
+        .def_property("server_list_ping_cache_ttl", &Server::getServerListPingCacheTtl,
+                      &Server::setServerListPingCacheTtl,
+                      "Gets or sets how long the server info rendered by ServerListPingEvent is reused.")
+        .def("invalidate_server_list_ping", &Server::invalidateServerListPing,
+             "Discards the cached server info, so that ServerListPingEvent is fired for the next ping.")
+        .def_property("server_list_ping_reply_enabled", &Server::isServerListPingReplyEnabled,
+                      &Server::setServerListPingReplyEnabled,
+                      "Gets or sets whether unconnected pings are answered from the cached server info.")
         .def_property_readonly("scoreboard", &Server::getScoreboard,
                                "Gets the primary Scoreboard controlled by the server.",
                                py::return_value_policy::reference)
@@ -362,6 +411,17 @@ void init_player(py::module_ &m, py::class_<Player, Mob> &player)
         .def_property_readonly(
             "ping", [](const Player &self) { return self.getPing().count(); },
             "Gets the player's average ping in milliseconds.")
+        .def_property_readonly("network_stats", &Player::getNetworkStats,
+                               "Gets the network statistics of the player's connection.")
+        .def_property_readonly("packet_type_stats", &Player::getPacketTypeStats,
+                               "Gets the game packets exchanged with the player per packet type since the player "
+                               "joined.")
+        .def("set_chunk_send_rate", &Player::setChunkSendRate, py::arg("chunks_per_tick"), py::arg("bytes_per_tick"),
+             "Limits the chunks sent to the player per tick, 0 for unlimited.")
+        .def_property_readonly("chunks_per_tick", &Player::getChunksPerTick,
+                               "Gets the number of sub-chunks sent to the player per tick, or 0 if unlimited.")
+        .def_property_readonly("chunk_bytes_per_tick", &Player::getChunkBytesPerTick,
+                               "Gets the number of bytes of chunk data sent to the player per tick, or 0 if unlimited.")
         .def("update_commands", &Player::updateCommands, "Send the list of commands to the client.")
         .def("perform_command", &Player::performCommand, py::arg("command"),
              "Makes the player perform the given command.")
@@ -14,6 +14,7 @@
 
 #include "endstone/level/level.h"
 
+#include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -65,6 +66,63 @@ void init_level(py::module_ &m)
         .def("__repr__", location_to_string)
         .def("__str__", location_to_string);
 
+    py::class_<ChunkSnapshot>(m, "ChunkSnapshot", "Represents an immutable copy of the blocks in a chunk.")
+        .def_property_readonly("x", &ChunkSnapshot::getX, "Gets the X-coordinate of this chunk.")
+        .def_property_readonly("z", &ChunkSnapshot::getZ, "Gets the Z-coordinate of this chunk.")
+        .def_property_readonly("min_height", &ChunkSnapshot::getMinHeight,
+                               "Gets the lowest Y-coordinate in this snapshot.")
+        .def_property_readonly("max_height", &ChunkSnapshot::getMaxHeight,
+                               "Gets the highest Y-coordinate in this snapshot, exclusive.")
+        .def_property_readonly("palette", &ChunkSnapshot::getPalette, "Gets the distinct block data in this chunk.")
+        .def_property_readonly("bits_per_block", &ChunkSnapshot::getBitsPerBlock,
+                               "Gets the number of bits used to store the palette index of each block.")
+        .def_property_readonly("memory_usage", &ChunkSnapshot::getMemoryUsage,
+                               "Gets the approximate number of bytes used by this snapshot.")
+        .def("get_palette_index", &ChunkSnapshot::getPaletteIndex, py::arg("x"), py::arg("y"), py::arg("z"),
+             "Gets the palette index of the block at the given position within the chunk.")
+        .def("get_block_data", &ChunkSnapshot::getBlockData, py::arg("x"), py::arg("y"), py::arg("z"),
+             "Gets the block data at the given position within the chunk.");
+
+    py::class_<ChunkLoadTask, std::shared_ptr<ChunkLoadTask>>(
+        m, "ChunkLoadTask", "Represents a request to load an area of chunks, started by Dimension.load_chunks_async.")
+        .def_property_readonly("total_chunks", &ChunkLoadTask::getTotalChunks,
+                               "Gets the number of chunks requested by this task.")
+        .def_property_readonly("loaded_chunks", &ChunkLoadTask::getLoadedChunks,
+                               "Gets the number of chunks loaded so far.")
+        .def_property_readonly("chunks_per_second", &ChunkLoadTask::getChunksPerSecond,
+                               "Gets the average number of chunks loaded per second since the first batch was started.")
+        .def_property("min_ticks_per_second", &ChunkLoadTask::getMinTicksPerSecond,
+                      &ChunkLoadTask::setMinTicksPerSecond,
+                      "Gets or sets the average ticks per second below which no new batch is started for this task.")
+        .def_property_readonly("is_done", &ChunkLoadTask::isDone, "Checks if this task has finished.")
+        .def_property_readonly("is_cancelled", &ChunkLoadTask::isCancelled, "Checks if this task has been cancelled.")
+        .def("cancel", &ChunkLoadTask::cancel, "Cancels this task.")
+        .def("when_complete", &ChunkLoadTask::whenComplete, py::arg("callback"),
+             "Registers a callback to run on the server thread once this task is done.");
+
+    py::enum_<FluidCollisionMode>(m, "FluidCollisionMode",
+                                  "Determines the collision behavior of ray traces with fluids.")
+        .value("NEVER", FluidCollisionMode::Never, "Ignore fluids.")
+        .value("SOURCE_ONLY", FluidCollisionMode::SourceOnly, "Only collide with source fluid blocks.")
+        .value("ALWAYS", FluidCollisionMode::Always, "Collide with all fluids.");
+
+    py::class_<BlockRayTraceResult>(m, "BlockRayTraceResult", "The block hit by a ray trace.")
+        .def_readonly("position", &BlockRayTraceResult::position, "The point where the ray hit the block.")
+        .def_readonly("distance", &BlockRayTraceResult::distance,
+                      "The distance from the origin of the ray to the hit position.")
+        .def_readonly("x", &BlockRayTraceResult::x, "The X-coordinate of the block.")
+        .def_readonly("y", &BlockRayTraceResult::y, "The Y-coordinate of the block.")
+        .def_readonly("z", &BlockRayTraceResult::z, "The Z-coordinate of the block.")
+        .def_readonly("face", &BlockRayTraceResult::face, "The face of the block hit by the ray.");
+
+    py::class_<ActorRayTraceResult>(m, "ActorRayTraceResult", "The actor hit by a ray trace.")
+        .def_readonly("position", &ActorRayTraceResult::position,
+                      "The point where the ray hit the bounding box of the actor.")
+        .def_readonly("distance", &ActorRayTraceResult::distance,
+                      "The distance from the origin of the ray to the hit position.")
+        .def_readonly("actor", &ActorRayTraceResult::actor, "The actor hit by the ray.")
+        .def_readonly("face", &ActorRayTraceResult::face, "The face of the bounding box hit by the ray.");
+
     py::enum_<Dimension::Type>(dimension, "Type", "Represents various dimension types.")
         .value("OVERWORLD", Dimension::Type::Overworld)
         .value("NETHER", Dimension::Type::Nether)
@@ -79,11 +137,45 @@ void init_level(py::module_ &m)
         .def("get_block_at", py::overload_cast<Location>(&Dimension::getBlockAt), py::arg("location").noconvert(),
              "Gets the Block at the given Location")
         .def("get_block_at", py::overload_cast<int, int, int>(&Dimension::getBlockAt), py::arg("x"), py::arg("y"),
-             py::arg("z"), "Gets the Block at the given coordinates");
+             py::arg("z"), "Gets the Block at the given coordinates")
+        .def("get_block_data_at", &Dimension::getBlockDataAt, py::arg("x"), py::arg("y"), py::arg("z"),
+             "Gets the block data at the given coordinates without creating a Block.")
+        .def("set_block_data_at", &Dimension::setBlockDataAt, py::arg("x"), py::arg("y"), py::arg("z"),
+             py::arg("data"), py::arg("apply_physics") = true,
+             "Sets the block data at the given coordinates without creating a Block.")
+        .def("get_blocks", &Dimension::getBlocks, py::arg("x"), py::arg("y"), py::arg("z"), py::arg("width"),
+             py::arg("height"), py::arg("depth"), "Reads a cuboid of blocks into a BlockVolume.")
+        .def("set_blocks", &Dimension::setBlocks, py::arg("volume"), py::arg("apply_physics") = true,
+             "Writes the blocks of a BlockVolume back to the dimension. Returns the number of blocks changed.")
+        .def("fill", &Dimension::fill, py::arg("x"), py::arg("y"), py::arg("z"), py::arg("width"), py::arg("height"),
+             py::arg("depth"), py::arg("data"), py::arg("apply_physics") = true,
+             "Fills a cuboid with the given block data. Returns the number of blocks changed.")
+        .def("apply_transaction", &Dimension::applyTransaction, py::arg("transaction"), py::arg("apply_physics") = true,
+             "Applies all changes of a block transaction. Returns the number of blocks changed.")
+        .def("get_chunk_snapshot", &Dimension::getChunkSnapshot, py::arg("x"), py::arg("z"),
+             "Captures an immutable copy of the blocks in a loaded chunk.")
+        .def("load_chunks_async", &Dimension::loadChunksAsync, py::arg("min_x"), py::arg("min_z"), py::arg("max_x"),
+             py::arg("max_z"), "Starts loading, and generating if needed, every chunk in a rectangular area.")
+        .def("get_nearby_actors", &Dimension::getNearbyActors, py::arg("center"), py::arg("radius"),
+             py::arg("type") = py::none(), py::return_value_policy::reference,
+             "Gets the actors whose bounding box is within the given radius of a point.")
+        .def("get_actors_in_box", &Dimension::getActorsInBox, py::arg("min"), py::arg("max"),
+             py::arg("type") = py::none(), py::return_value_policy::reference,
+             "Gets the actors whose bounding box intersects the given box.")
+        .def("get_actors_in_chunk", &Dimension::getActorsInChunk, py::arg("x"), py::arg("z"),
+             py::return_value_policy::reference, "Gets the actors in a chunk.")
+        .def("ray_trace_blocks", &Dimension::rayTraceBlocks, py::arg("origin"), py::arg("direction"),
+             py::arg("max_distance"), py::arg("fluid_mode") = FluidCollisionMode::Never,
+             "Performs a ray trace that checks for collisions with blocks.")
+        .def("ray_trace_actors", &Dimension::rayTraceActors, py::arg("origin"), py::arg("direction"),
+             py::arg("max_distance"), py::arg("ray_size") = 0.0F, py::arg("exclude") = nullptr,
+             "Performs a ray trace that checks for collisions with the bounding boxes of actors.");
 
     level.def_property_readonly("name", &Level::getName, "Gets the unique name of this level")
         .def_property_readonly("actors", &Level::getActors, "Get a list of all actors in this level",
                                py::return_value_policy::reference_internal)
+        .def_property_readonly("actors_version", &Level::getActorsVersion,
+                               "Gets a counter that changes whenever an actor is added to or removed from this level.")
         .def_property("time", &Level::getTime, &Level::setTime, "Gets and sets the relative in-game time on the server")
         .def_property_readonly("dimensions", &Level::getDimensions, "Gets a list of all dimensions within this level.",
                                py::return_value_policy::reference_internal)
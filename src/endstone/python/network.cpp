@@ -12,6 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <pybind11/chrono.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -24,8 +29,104 @@ namespace endstone::python {
 void init_network(py::module_ &m)
 {
     py::enum_<PacketType>(m, "PacketType", "Represents the types of packets.")
+        .value("PLAY_SOUND", PacketType::PlaySound)
+        .value("SET_TITLE", PacketType::SetTitle)
         .value("SPAWN_PARTICLE_EFFECT", PacketType::SpawnParticleEffect);
 
+    py::class_<NetworkStats>(m, "NetworkStats",
+                             "Represents the network statistics of a connection, as measured by the transport layer.")
+        .def_property_readonly("bytes_sent", &NetworkStats::getBytesSent,
+                               "Gets the total number of bytes sent, including protocol overhead and resends.")
+        .def_property_readonly("bytes_received", &NetworkStats::getBytesReceived,
+                               "Gets the total number of bytes received, including protocol overhead.")
+        .def_property_readonly("bytes_resent", &NetworkStats::getBytesResent,
+                               "Gets the total number of bytes sent again because they were not acknowledged in time.")
+        .def_property_readonly(
+            "packets_sent", &NetworkStats::getPacketsSent,
+            "Gets the total number of RakNet datagrams sent, including acknowledgements and resends.")
+        .def_property_readonly("packets_received", &NetworkStats::getPacketsReceived,
+                               "Gets the total number of RakNet datagrams received, including acknowledgements.")
+        .def_property_readonly("send_rate", &NetworkStats::getSendRate,
+                               "Gets the number of bytes sent over the last second.")
+        .def_property_readonly("receive_rate", &NetworkStats::getReceiveRate,
+                               "Gets the number of bytes received over the last second.")
+        .def_property_readonly("packet_loss", &NetworkStats::getPacketLoss,
+                               "Gets the ratio of packets lost over the last second, between 0 and 1.");
+
+    py::class_<PacketTypeStats>(m, "PacketTypeStats",
+                                "Represents the game packets of one type exchanged with a connection.")
+        .def_property_readonly("id", &PacketTypeStats::getId, "Gets the Minecraft packet ID of the packet type.")
+        .def_property_readonly("name", &PacketTypeStats::getName, "Gets the name of the packet type.")
+        .def_property_readonly("packets_sent", &PacketTypeStats::getPacketsSent,
+                               "Gets the number of packets of this type sent.")
+        .def_property_readonly("bytes_sent", &PacketTypeStats::getBytesSent,
+                               "Gets the number of bytes of the packets of this type sent, before compression.")
+        .def_property_readonly("packets_received", &PacketTypeStats::getPacketsReceived,
+                               "Gets the number of packets of this type received.")
+        .def_property_readonly("bytes_received", &PacketTypeStats::getBytesReceived,
+                               "Gets the number of bytes of the packets of this type received, before compression.");
+
+    py::class_<PacketRateLimitConfig> packet_rate_limit_config(
+        m, "PacketRateLimitConfig",
+        "The limits applied to incoming RakNet datagrams before any packet is deserialized.");
+    py::class_<PacketRateLimitConfig::Limit>(packet_rate_limit_config, "Limit",
+                                             "A token bucket, refilled at a constant rate up to its capacity.")
+        .def(py::init<double, double>(), py::arg("rate"), py::arg("burst"))
+        .def_readwrite("rate", &PacketRateLimitConfig::Limit::rate, "The number of datagrams allowed per second.")
+        .def_readwrite("burst", &PacketRateLimitConfig::Limit::burst, "The number of datagrams allowed in a burst.");
+    packet_rate_limit_config.def(py::init<>())
+        .def_readwrite("enabled", &PacketRateLimitConfig::enabled,
+                       "Whether incoming datagrams are rate limited at all.")
+        .def_readwrite("ping", &PacketRateLimitConfig::ping)
+        .def_readwrite("connection", &PacketRateLimitConfig::connection)
+        .def_readwrite("datagram", &PacketRateLimitConfig::datagram)
+        .def_readwrite("acknowledgement", &PacketRateLimitConfig::acknowledgement)
+        .def_readwrite("other", &PacketRateLimitConfig::other)
+        .def_readwrite("ping_per_host", &PacketRateLimitConfig::ping_per_host)
+        .def_readwrite("ping_total", &PacketRateLimitConfig::ping_total)
+        .def_readwrite("new_peers_per_prefix", &PacketRateLimitConfig::new_peers_per_prefix)
+        .def_readwrite("block_threshold", &PacketRateLimitConfig::block_threshold)
+        .def_readwrite("block_duration", &PacketRateLimitConfig::block_duration)
+        .def_readwrite("idle_timeout", &PacketRateLimitConfig::idle_timeout)
+        .def_readwrite("max_peers", &PacketRateLimitConfig::max_peers);
+
+    py::class_<OutboundPacket>(m, "OutboundPacket",
+                               "Represents a read-only view of a game packet about to be sent to players.")
+        .def_property_readonly("id", &OutboundPacket::getId, "Gets the Minecraft packet ID of the packet.")
+        .def_property_readonly(
+            "payload",
+            [](const OutboundPacket &self) {
+                const auto payload = self.getPayload();
+                return py::bytes(reinterpret_cast<const char *>(payload.data()), payload.size());
+            },
+            "Gets the encoded body of the packet, without the packet header.")
+        .def_property_readonly(
+            "recipients",
+            [](const OutboundPacket &self) {
+                const auto recipients = self.getRecipients();
+                return std::vector<Player *>(recipients.begin(), recipients.end());
+            },
+            py::return_value_policy::reference, "Gets the players the packet is sent to.");
+
+    py::class_<UnconnectedMessage>(m, "UnconnectedMessage",
+                                   "Represents an unconnected RakNet message about to be sent over the network.")
+        .def_property_readonly("id", &UnconnectedMessage::getId, "Gets the RakNet message ID of the message.")
+        .def_property_readonly("address", &UnconnectedMessage::getAddress, "Gets the address the message is sent to.")
+        .def_property(
+            "payload",
+            [](const UnconnectedMessage &self) {
+                const auto payload = self.getPayload();
+                return py::bytes(reinterpret_cast<const char *>(payload.data()), payload.size());
+            },
+            [](UnconnectedMessage &self, const py::bytes &payload) {
+                const auto view = static_cast<std::string_view>(payload);
+                const auto *begin = reinterpret_cast<const std::byte *>(view.data());
+                self.setPayload({begin, begin + view.size()});
+            },
+            "Gets or sets the payload of the message, including the RakNet message ID.")
+        .def_property_readonly("is_modified", &UnconnectedMessage::isModified,
+                               "Checks if the payload has been replaced.");
+
     py::class_<Packet>(m, "Packet", "Represents a packet.")
         .def_property_readonly("type", &Packet::getType, "Gets the type of the packet.");
 
@@ -37,6 +138,35 @@ void init_network(py::module_ &m)
         .def_readwrite("position", &SpawnParticleEffectPacket::position)
         .def_readwrite("effect_name", &SpawnParticleEffectPacket::effect_name)
         .def_readwrite("molang_variables_json", &SpawnParticleEffectPacket::molang_variables_json);
+
+    py::class_<PlaySoundPacket, Packet>(m, "PlaySoundPacket", "Represents a packet for playing a sound to the client.")
+        .def(py::init<>())
+        .def_readwrite("sound_name", &PlaySoundPacket::sound_name)
+        .def_readwrite("position", &PlaySoundPacket::position)
+        .def_readwrite("volume", &PlaySoundPacket::volume)
+        .def_readwrite("pitch", &PlaySoundPacket::pitch);
+
+    py::class_<SetTitlePacket, Packet> set_title_packet(
+        m, "SetTitlePacket", "Represents a packet for displaying titles, subtitles and action bars on the client.");
+
+    py::enum_<SetTitlePacket::Type>(set_title_packet, "Type", "Represents the action of the packet.")
+        .value("CLEAR", SetTitlePacket::Type::Clear)
+        .value("RESET", SetTitlePacket::Type::Reset)
+        .value("TITLE", SetTitlePacket::Type::Title)
+        .value("SUBTITLE", SetTitlePacket::Type::Subtitle)
+        .value("ACTIONBAR", SetTitlePacket::Type::Actionbar)
+        .value("TIMES", SetTitlePacket::Type::Times)
+        .export_values();
+
+    set_title_packet.def(py::init<>())
+        .def_readwrite("type", &SetTitlePacket::type)
+        .def_readwrite("text", &SetTitlePacket::text)
+        .def_readwrite("fade_in_time", &SetTitlePacket::fade_in_time)
+        .def_readwrite("stay_time", &SetTitlePacket::stay_time)
+        .def_readwrite("fade_out_time", &SetTitlePacket::fade_out_time)
+        .def_readwrite("xuid", &SetTitlePacket::xuid)
+        .def_readwrite("platform_online_id", &SetTitlePacket::platform_online_id)
+        .def_readwrite("filtered_text", &SetTitlePacket::filtered_text);
 }
 
 }  // namespace endstone::python
@@ -37,6 +37,9 @@ void Actor::remove()
         auto &server = entt::locator<EndstoneServer>::value();
         endstone::ActorRemoveEvent e{getEndstoneActor()};
         server.getPluginManager().callEvent(e);
+        if (auto *level = static_cast<endstone::core::EndstoneLevel *>(server.getLevel()); level) {
+            level->removeActor(getEndstoneActor());
+        }
     }
     ENDSTONE_HOOK_CALL_ORIGINAL(&Actor::remove, this);
 }
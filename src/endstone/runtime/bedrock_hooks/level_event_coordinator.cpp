@@ -25,11 +25,15 @@ void LevelEventCoordinator::_postReloadActorAdded(Actor &actor, ActorInitializat
 {
     ENDSTONE_HOOK_CALL_ORIGINAL(&LevelEventCoordinator::_postReloadActorAdded, this, actor, init_method);
 
+    auto &server = entt::locator<EndstoneServer>::value();
+    if (auto *level = static_cast<endstone::core::EndstoneLevel *>(server.getLevel()); level) {
+        level->addActor(actor.getEndstoneActor());
+    }
+
     if (actor.isPlayer()) {
         return;
     }
 
-    auto &server = entt::locator<EndstoneServer>::value();
     endstone::ActorSpawnEvent e{actor.getEndstoneActor()};
     server.getPluginManager().callEvent(e);
 
@@ -50,5 +50,5 @@ void Player::setPermissions(CommandPermissionLevel level)
     ENDSTONE_HOOK_CALL_ORIGINAL(&Player::setPermissions, this, level);
     auto &player = getEndstoneActor<EndstonePlayer>();
     player.recalculatePermissions();
-    player.updateCommands();
+    player.queueCommandUpdate();
 }
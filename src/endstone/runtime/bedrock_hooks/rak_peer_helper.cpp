@@ -14,11 +14,100 @@
 
 #include "bedrock/network/rak_peer_helper.h"
 
+#include <algorithm>
+#include <array>
+#include <span>
+
 #include <entt/entt.hpp>
 
+#include "bedrock/deps/raknet/message_identifiers.h"
+#include "bedrock/deps/raknet/raknet_socket2.h"
+#include "bedrock/deps/raknet/socket_includes.h"
 #include "endstone/core/server.h"
 #include "endstone/runtime/hook.h"
 
+using endstone::core::DatagramStats;
+using endstone::core::EndstoneServer;
+using endstone::core::PacketRateLimiter;
+using endstone::core::PeerAddress;
+
+namespace {
+// Answers an unconnected ping from the cached pong on the receive thread, so that RakNet never sees it
+bool replyToPing(EndstoneServer &server, const RakNet::RNS2RecvStruct &recv_struct)
+{
+    if (static_cast<std::uint8_t>(recv_struct.data[0]) != UnconnectedPing || !recv_struct.socket) {
+        return false;
+    }
+
+    std::array<std::byte, MAXIMUM_MTU_SIZE> pong;
+    const auto ping = std::as_bytes(std::span(recv_struct.data, static_cast<std::size_t>(recv_struct.bytes_read)));
+    const auto size = server.getServerListPing().respond(ping, pong);
+    if (size == 0) {
+        return false;
+    }
+
+    const auto &address = recv_struct.system_address.address;
+    const auto address_size = address.addr4.sin_family == AF_INET ? sizeof(sockaddr_in) : sizeof(sockaddr_in6);
+    const auto socket = static_cast<RakNet::RNS2_Berkley *>(recv_struct.socket)->GetSocket();
+    sendto(socket, reinterpret_cast<const char *>(pong.data()), static_cast<int>(size), 0,
+           reinterpret_cast<const sockaddr *>(&address), static_cast<socklen_t>(address_size));
+    server.getDatagramStats().record(DatagramStats::Direction::Outbound, UnconnectedPong, size);
+    return true;
+}
+
+// RakPeer::OnRNS2Recv only releases the datagrams it accepts, rejected ones must be released by the handler
+void releaseDatagram(RakNet::RNS2RecvStruct *recv_struct)
+{
+    if (recv_struct->socket && recv_struct->socket->GetEventHandler()) {
+        recv_struct->socket->GetEventHandler()->DeallocRNS2RecvStruct(recv_struct, __FILE__, __LINE__);
+    }
+}
+
+// Returns whether RakNet should process the datagram
+bool filterDatagram(RakNet::RNS2RecvStruct *recv_struct)
+{
+    if (recv_struct->bytes_read <= 0) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    const auto &system_address = recv_struct->system_address;
+    const auto address = PeerAddress::fromSystemAddress(system_address);
+    const auto packet_id = static_cast<std::uint8_t>(recv_struct->data[0]);
+    server.getDatagramStats().record(DatagramStats::Direction::Inbound, packet_id,
+                                     static_cast<std::size_t>(recv_struct->bytes_read), address);
+    switch (server.getPacketRateLimiter().check(address, packet_id)) {
+    case PacketRateLimiter::Verdict::Accept:
+        return !replyToPing(server, *recv_struct);
+    case PacketRateLimiter::Verdict::Drop:
+        return false;
+    case PacketRateLimiter::Verdict::Block: {
+        char buffer[64];
+        system_address.ToString(true, buffer, ':');
+        server.getLogger().warning("{} is sending too many packets and has been blocked.", buffer);
+        if (entt::locator<RakNet::RakPeerInterface *>::has_value()) {
+            auto *peer = entt::locator<RakNet::RakPeerInterface *>::value();
+            peer->CloseConnection(RakNet::AddressOrGUID(system_address), true, 0,
+                                  PacketPriority::IMMEDIATE_PRIORITY);
+        }
+        return false;
+    }
+    default:
+        return true;
+    }
+}
+
+bool onIncomingDatagram(RakNet::RNS2RecvStruct *recv_struct)
+{
+    if (filterDatagram(recv_struct)) {
+        return true;
+    }
+    // dropped datagrams and pings answered by replyToPing
+    releaseDatagram(recv_struct);
+    return false;
+}
+}  // namespace
+
 RakNet::StartupResult RakPeerHelper::peerStartup(RakNet::RakPeerInterface *peer, const ConnectionDefinition &def,
                                                  PeerPurpose purpose)
 {
@@ -31,6 +120,8 @@ RakNet::StartupResult RakPeerHelper::peerStartup(RakNet::RakPeerInterface *peer,
             throw std::runtime_error("Server RakPeer is already defined.");
         }
         entt::locator<RakNet::RakPeerInterface *>::emplace(peer);
+        // Drops datagrams from abusive peers and answers pings on the receive thread, before RakNet processes them
+        peer->SetIncomingDatagramEventHandler(&onIncomingDatagram);
     }
     return result;
 }
@@ -14,18 +14,17 @@
 
 #include "bedrock/deps/raknet/raknet_socket2.h"
 
-#include <sstream>
+#include <span>
 
 #include <entt/entt.hpp>
 
-#include "bedrock/deps/raknet/get_time.h"
-#include "bedrock/deps/raknet/message_identifiers.h"
 #include "endstone/core/server.h"
-#include "endstone/event/server/server_list_ping_event.h"
-#include "endstone/plugin/plugin_manager.h"
+#include "endstone/network/unconnected_message.h"
 #include "endstone/runtime/hook.h"
 
+using endstone::core::DatagramStats;
 using endstone::core::EndstoneServer;
+using endstone::core::PeerAddress;
 
 namespace RakNet {
 
@@ -33,46 +32,47 @@ RNS2SendResult RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP(RNS2Socket so
                                                                    RNS2_SendParameters *send_parameters,
                                                                    const char *file, unsigned int line)
 {
-    if (send_parameters->data[0] != UnconnectedPong) {
+    auto &server = entt::locator<EndstoneServer>::value();
+    if (send_parameters->length <= 0) {
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    constexpr static int head_size = sizeof(char) + sizeof(std::uint64_t) + sizeof(std::uint64_t) + 16;
-    const char *data = send_parameters->data;
-    std::size_t strlen = data[head_size] << 8 | data[head_size + 1];
-    if (strlen != send_parameters->length - (head_size + 2)) {
+    const auto address = PeerAddress::fromSystemAddress(send_parameters->system_address);
+    const auto packet_id = static_cast<std::uint8_t>(send_parameters->data[0]);
+    auto &pipeline = server.getPacketPipeline();
+    // connected datagrams carry game packets, which listeners see when they are encoded, they are never replaced here
+    if (!pipeline.hasMessageListeners(packet_id)) {
+        server.getDatagramStats().record(DatagramStats::Direction::Outbound, packet_id,
+                                         static_cast<std::size_t>(send_parameters->length), address);
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    std::string ping_response{data + head_size + 2, strlen};
-    auto &server = entt::locator<EndstoneServer>::value();
     char buffer[64];
     send_parameters->system_address.ToString(false, buffer);
-    endstone::ServerListPingEvent event(std::string(buffer), send_parameters->system_address.GetPort(), ping_response);
-    if (!event.deserialize()) {
-        server.getLogger().error("Unable to parse ping response: {}", ping_response);
+    endstone::UnconnectedMessage message(
+        std::as_bytes(std::span(send_parameters->data, static_cast<std::size_t>(send_parameters->length))),
+        {std::string(buffer), send_parameters->system_address.GetPort()});
+    if (!pipeline.process(message)) {
+        server.getDatagramStats().record(DatagramStats::Direction::Outbound, packet_id,
+                                         static_cast<std::size_t>(send_parameters->length), address);
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    server.getPluginManager().callEvent(event);
-
-    std::vector<char> packet;
-    packet.reserve(256);
-    packet.insert(packet.end(), data, data + head_size);
-
-    ping_response = event.serialize();
-    strlen = ping_response.length();
-    packet.push_back(static_cast<char>((strlen >> 8) & 0xFF));
-    packet.push_back(static_cast<char>(strlen & 0xFF));
-    packet.insert(packet.end(), ping_response.begin(), ping_response.end());
-
-    send_parameters->data = packet.data();
-    send_parameters->length = static_cast<int>(packet.size());
-    return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket, send_parameters,
-                                       file, line);
+    // the replaced payload is owned by the message, it must outlive the original call
+    const auto payload = message.getPayload();
+    auto *data = send_parameters->data;
+    auto length = send_parameters->length;
+    send_parameters->data = const_cast<char *>(reinterpret_cast<const char *>(payload.data()));
+    send_parameters->length = static_cast<int>(payload.size());
+    server.getDatagramStats().record(DatagramStats::Direction::Outbound, packet_id, payload.size(), address);
+    const auto result = ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
+                                                    send_parameters, file, line);
+    send_parameters->data = data;
+    send_parameters->length = length;
+    return result;
 }
 
 }  // namespace RakNet
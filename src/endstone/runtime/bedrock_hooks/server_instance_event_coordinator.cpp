@@ -24,6 +24,7 @@
 #include "endstone/event/server/server_load_event.h"
 #include "endstone/plugin/plugin_load_order.h"
 #include "endstone/runtime/hook.h"
+#include "endstone/runtime/packet_hooks.h"
 
 namespace py = pybind11;
 
@@ -47,8 +48,10 @@ void ServerInstanceEventCoordinator::sendServerThreadStarted(ServerInstance &ins
     auto &server = entt::locator<EndstoneServer>::value();
     auto &level = *instance.getMinecraft().getLevel();
     server.setLevel(std::make_unique<EndstoneLevel>(level));
+    endstone::hook::install_packet_hooks(*level.getPacketSender());
     server.setScoreboard(std::make_unique<EndstoneScoreboard>(level.getScoreboard()));
     server.setCommandMap(std::make_unique<endstone::core::EndstoneCommandMap>(server));
+    server.getChunkLoader().start();
     server.enablePlugins(PluginLoadOrder::PostWorld);
     ServerLoadEvent event{ServerLoadEvent::LoadType::Startup};
     server.getPluginManager().callEvent(event);
@@ -58,6 +61,7 @@ void ServerInstanceEventCoordinator::sendServerThreadStarted(ServerInstance &ins
 void ServerInstanceEventCoordinator::sendServerThreadStopped(ServerInstance &instance)
 {
     py::gil_scoped_acquire acquire{};
+    entt::locator<EndstoneServer>::value().getChunkLoader().stop();
     entt::locator<EndstoneServer>::value().disablePlugins();
     entt::locator<EndstoneServer>::reset();  // we explicitly acquire GIL and destroy the server instance as the command
                                              // map and the plugin manager hold shared_ptrs to python objects
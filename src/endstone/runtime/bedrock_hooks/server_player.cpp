@@ -103,7 +103,7 @@ void ServerPlayer::setLocalPlayerAsInitialized()
     }
 
     endstone_player.recalculatePermissions();
-    endstone_player.updateCommands();
+    endstone_player.queueCommandUpdate();
 }
 
 void ServerPlayer::disconnect()
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <system_error>
 #include <unordered_map>
 
@@ -27,6 +28,13 @@ void *&get_original(const char *name);
 const std::unordered_map<std::string, void *> &get_targets();
 const std::unordered_map<std::string, void *> &get_detours();
 
+/**
+ * Replaces the entry at the given index of a virtual function table and returns the function it pointed to.
+ *
+ * Used for the virtual functions that have no exported symbol, which affects every object sharing the table.
+ */
+void *replace_vtable_entry(void **vtable, std::size_t index, void *detour);
+
 template <size_t N>
 struct StrLiteral {
     constexpr StrLiteral(const char (&str)[N])
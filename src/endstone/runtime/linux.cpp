@@ -19,9 +19,13 @@
 #include <fcntl.h>
 #include <gelf.h>
 #include <libelf.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include <cerrno>
+#include <cstdint>
 #include <string>
+#include <system_error>
 #include <unordered_map>
 
 #include "endstone/detail/platform.h"
@@ -103,6 +107,22 @@ const std::unordered_map<std::string, void *> &get_detours()
     });
     return detours;
 }
+
+void *replace_vtable_entry(void **vtable, std::size_t index, void *detour)
+{
+    auto *entry = vtable + index;
+    const auto page_size = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    auto *page = reinterpret_cast<void *>(reinterpret_cast<std::uintptr_t>(entry) & ~(page_size - 1));
+
+    // Virtual function tables are made read-only after relocation. The previous protection cannot be queried, so the
+    // page is left writable rather than risking to make writable data on the same page read-only.
+    if (mprotect(page, page_size, PROT_READ | PROT_WRITE) != 0) {
+        throw std::system_error(errno, std::generic_category(), "mprotect failed");
+    }
+    void *original = *entry;
+    *entry = detour;
+    return original;
+}
 }  // namespace endstone::hook
 
 #endif
@@ -0,0 +1,397 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/runtime/packet_hooks.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+#include "bedrock/core/utility/binary_stream.h"
+#include "bedrock/entity/components/user_entity_identifier_component.h"
+#include "bedrock/network/net_event_callback.h"
+#include "bedrock/network/network_identifier.h"
+#include "bedrock/network/packet.h"
+#include "endstone/core/network/packet_adapter.h"
+#include "endstone/core/server.h"
+#include "endstone/detail/cast.h"
+#include "endstone/network/outbound_packet.h"
+#include "endstone/network/set_title_packet.h"
+#include "endstone/runtime/hook.h"
+
+using endstone::core::ChunkSendQueue;
+using endstone::core::EndstonePlayer;
+using endstone::core::EndstoneServer;
+using endstone::core::PacketStats;
+
+namespace endstone::hook {
+
+namespace {
+
+// Indices in the virtual function tables of the engine. MSVC emits a single destructor entry where the Itanium ABI
+// emits two, and it groups the overloads of a virtual function in reverse order of declaration.
+namespace slot {
+#ifdef _WIN32
+constexpr std::size_t SendToClientByNetworkId = 4;
+constexpr std::size_t SendToClient = 5;
+constexpr std::size_t SendToClients = 6;
+constexpr std::size_t SendBroadcastExcept = 7;
+constexpr std::size_t SendBroadcast = 8;
+constexpr std::size_t PacketGetId = 1;
+constexpr std::size_t PacketWrite = 4;
+constexpr std::size_t PacketRead = 5;
+constexpr std::size_t DispatcherHandle = 1;
+#else
+constexpr std::size_t SendToClient = 5;
+constexpr std::size_t SendToClientByNetworkId = 6;
+constexpr std::size_t SendToClients = 7;
+constexpr std::size_t SendBroadcast = 8;
+constexpr std::size_t SendBroadcastExcept = 9;
+constexpr std::size_t PacketGetId = 2;
+constexpr std::size_t PacketWrite = 5;
+constexpr std::size_t PacketRead = 6;
+constexpr std::size_t DispatcherHandle = 2;
+#endif
+}  // namespace slot
+
+class PacketSenderHooks : public PacketSender {
+public:
+    void sendToClient(const UserEntityIdentifierComponent *user, const ::Packet &packet);
+    void sendToClientByNetworkId(const NetworkIdentifier &network_id, const ::Packet &packet, SubClientId sub_id);
+    void sendToClients(const std::vector<NetworkIdentifierWithSubId> &targets, const ::Packet &packet);
+    void sendBroadcast(const ::Packet &packet);
+    void sendBroadcastExcept(const NetworkIdentifier &network_id, SubClientId sub_id, const ::Packet &packet);
+};
+
+class PacketHooks : public ::Packet {
+public:
+    using GetId = MinecraftPacketIds (PacketHooks::*)() const;
+
+    void write(BinaryStream &stream) const;
+    [[nodiscard]] Bedrock::Result<void> read(ReadOnlyBinaryStream &stream);
+};
+
+class PacketHandlerDispatcherHooks {
+public:
+    void handle(const NetworkIdentifier &source, NetEventCallback &callback, std::shared_ptr<::Packet> &packet) const;
+};
+
+struct PacketOriginals {
+    void *write;
+    void *read;
+};
+
+// Only written while installing, before any client is connected
+std::array<void *, 16> gSenderOriginals{};
+std::unordered_map<void *const *, PacketOriginals> gPacketOriginals;
+std::unordered_map<void *const *, void *> gDispatcherOriginals;
+
+// The packet being sent through the packet sender on this thread, measured when the engine encodes it
+struct Encoding {
+    const ::Packet *packet;
+    int id;
+    std::size_t size;
+    bool encoded;
+    const std::vector<Player *> *recipients;  // set when the packet has listeners
+};
+thread_local Encoding *gEncoding = nullptr;
+
+// The last packet decoded on this thread, handled right after it has been decoded
+struct Decoding {
+    const ::Packet *packet;
+    std::size_t size;
+    std::optional<ChunkSendQueue::Area> sub_chunks;  // sub-chunk requests only
+};
+thread_local Decoding gDecoded{nullptr, 0, std::nullopt};
+
+bool is_chunk_packet(int id)
+{
+    return id == static_cast<int>(MinecraftPacketIds::FullChunkData) ||
+           id == static_cast<int>(MinecraftPacketIds::SubChunkPacket);
+}
+
+void *const *get_vtable(const void *object)
+{
+    return *static_cast<void *const *const *>(object);
+}
+
+template <typename Fn, typename... Args>
+void call_sender_original(Fn fp, std::size_t index, Args &&...args)
+{
+    std::invoke(detail::fp_cast(fp, gSenderOriginals[index]), std::forward<Args>(args)...);
+}
+
+int get_packet_id(const ::Packet &packet)
+{
+    const auto get_id = detail::fp_cast(PacketHooks::GetId{}, get_vtable(&packet)[slot::PacketGetId]);
+    return static_cast<int>(std::invoke(get_id, static_cast<const PacketHooks &>(packet)));
+}
+
+/**
+ * Sends a packet with the original packet sender and accounts for it once per recipient, packets with listeners are
+ * dispatched to them when they are encoded. Recipients are passed to the callback of for_each_recipient as a network
+ * identifier and a sub-client ID.
+ */
+template <typename Send, typename ForEachRecipient>
+void send_packet(const ::Packet &packet, Send &&send, ForEachRecipient &&for_each_recipient)
+{
+    if (!entt::locator<EndstoneServer>::has_value()) {
+        std::invoke(std::forward<Send>(send));
+        return;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    const auto id = get_packet_id(packet);
+    // the player index is only safe to read on the server thread
+    const auto on_server_thread = server.isPrimaryThread();
+    const auto resolve = [&](auto &&callback) {
+        std::invoke(for_each_recipient, [&](const NetworkIdentifier &network_id, SubClientId sub_id) {
+            auto *player = on_server_thread ? server.getPlayer(network_id, sub_id) : nullptr;
+            callback(static_cast<EndstonePlayer *>(player));
+        });
+    };
+
+    // recipients are only collected for the listeners, packets nobody listens to skip the allocation
+    std::vector<Player *> players;
+    const auto listened = server.getPacketPipeline().hasPacketListeners(id);
+    if (listened) {
+        resolve([&](EndstonePlayer *player) {
+            if (player) {
+                players.push_back(player);
+            }
+        });
+    }
+
+    Encoding encoding{&packet, id, 0, false, listened ? &players : nullptr};
+    auto *previous = std::exchange(gEncoding, &encoding);
+    std::invoke(std::forward<Send>(send));
+    gEncoding = previous;
+
+    std::uint64_t recipients = 0;
+    resolve([&](EndstonePlayer *player) {
+        ++recipients;
+        if (player) {
+            player->getPacketStats().record(PacketStats::Direction::Outbound, id, encoding.size);
+            if (is_chunk_packet(id)) {
+                player->getChunkSendQueue().recordBytes(encoding.size);
+            }
+        }
+    });
+    server.getPacketStats().record(PacketStats::Direction::Outbound, id, encoding.size, recipients);
+}
+
+template <typename Fn>
+void for_each_online_player(Fn &&fn)
+{
+    for (const auto *player : entt::locator<EndstoneServer>::value().getOnlinePlayers()) {
+        auto &handle = static_cast<const EndstonePlayer *>(player)->getHandle();
+        if (const auto *user = handle.tryGetComponent<UserEntityIdentifierComponent>()) {
+            fn(user->network_id, user->client_sub_id);
+        }
+    }
+}
+
+void PacketSenderHooks::sendToClient(const UserEntityIdentifierComponent *user, const ::Packet &packet)
+{
+    send_packet(
+        packet,
+        [&] { call_sender_original(&PacketSenderHooks::sendToClient, slot::SendToClient, this, user, packet); },
+        [&](auto &&record) { record(user->network_id, user->client_sub_id); });
+}
+
+void PacketSenderHooks::sendToClientByNetworkId(const NetworkIdentifier &network_id, const ::Packet &packet,
+                                                SubClientId sub_id)
+{
+    send_packet(
+        packet,
+        [&] {
+            call_sender_original(&PacketSenderHooks::sendToClientByNetworkId, slot::SendToClientByNetworkId, this,
+                                 network_id, packet, sub_id);
+        },
+        [&](auto &&record) { record(network_id, sub_id); });
+}
+
+void PacketSenderHooks::sendToClients(const std::vector<NetworkIdentifierWithSubId> &targets, const ::Packet &packet)
+{
+    send_packet(
+        packet,
+        [&] { call_sender_original(&PacketSenderHooks::sendToClients, slot::SendToClients, this, targets, packet); },
+        [&](auto &&record) {
+            for (const auto &target : targets) {
+                record(target.network_identifier, target.sub_id);
+            }
+        });
+}
+
+void PacketSenderHooks::sendBroadcast(const ::Packet &packet)
+{
+    send_packet(
+        packet, [&] { call_sender_original(&PacketSenderHooks::sendBroadcast, slot::SendBroadcast, this, packet); },
+        [&](auto &&record) { for_each_online_player(record); });
+}
+
+void PacketSenderHooks::sendBroadcastExcept(const NetworkIdentifier &network_id, SubClientId sub_id,
+                                            const ::Packet &packet)
+{
+    send_packet(
+        packet,
+        [&] {
+            call_sender_original(&PacketSenderHooks::sendBroadcastExcept, slot::SendBroadcastExcept, this, network_id,
+                                 sub_id, packet);
+        },
+        [&](auto &&record) {
+            for_each_online_player([&](const NetworkIdentifier &id, SubClientId sub) {
+                if (sub != sub_id || id != network_id) {
+                    record(id, sub);
+                }
+            });
+        });
+}
+
+void PacketHooks::write(BinaryStream &stream) const
+{
+    const auto &originals = gPacketOriginals.at(get_vtable(this));
+    const auto write = detail::fp_cast(&PacketHooks::write, originals.write);
+    auto *encoding = gEncoding;
+    if (!encoding || encoding->packet != this || encoding->encoded) {
+        std::invoke(write, this, stream);
+        return;
+    }
+
+    // a broadcast is encoded once, whatever the number of recipients
+    const auto offset = stream.getBuffer().size();
+    std::invoke(write, this, stream);
+    encoding->size = stream.getBuffer().size() - offset;
+    encoding->encoded = true;
+    if (encoding->recipients) {
+        const auto payload = std::as_bytes(std::span(stream.getBuffer())).subspan(offset);
+        entt::locator<EndstoneServer>::value().getPacketPipeline().process(
+            OutboundPacket(encoding->id, payload, *encoding->recipients));
+    }
+}
+
+Bedrock::Result<void> PacketHooks::read(ReadOnlyBinaryStream &stream)
+{
+    const auto &originals = gPacketOriginals.at(get_vtable(this));
+    const auto view = stream.getView();
+    const auto unread = stream.getUnreadLength();
+    auto result = std::invoke(detail::fp_cast(&PacketHooks::read, originals.read), this, stream);
+    const auto size = unread - stream.getUnreadLength();
+    const auto id = get_packet_id(*this);
+    gDecoded = {this, size, std::nullopt};
+    if (id == static_cast<int>(MinecraftPacketIds::SubChunkRequestPacket) && result) {
+        gDecoded.sub_chunks = ChunkSendQueue::parseRequest(std::as_bytes(std::span(view.substr(view.size() - unread))));
+    }
+    if (entt::locator<EndstoneServer>::has_value()) {
+        entt::locator<EndstoneServer>::value().getPacketStats().record(PacketStats::Direction::Inbound, id, size);
+    }
+    return result;
+}
+
+void PacketHandlerDispatcherHooks::handle(const NetworkIdentifier &source, NetEventCallback &callback,
+                                          std::shared_ptr<::Packet> &packet) const
+{
+    const auto &original = gDispatcherOriginals.at(get_vtable(this));
+    const auto handle = detail::fp_cast(&PacketHandlerDispatcherHooks::handle, original);
+
+    // accounted for before the packet is handled, handling may remove the player
+    if (packet && entt::locator<EndstoneServer>::has_value()) {
+        auto &server = entt::locator<EndstoneServer>::value();
+        if (server.isPrimaryThread()) {
+            if (auto *player = static_cast<EndstonePlayer *>(server.getPlayer(source, packet->getClientSubId()))) {
+                const auto decoded = gDecoded.packet == packet.get();
+                const auto size = decoded ? gDecoded.size : 0;
+                player->getPacketStats().record(PacketStats::Direction::Inbound, get_packet_id(*packet), size);
+
+                // held back until the chunk budget of the player allows it, the queue owns the packet until then
+                auto &queue = player->getChunkSendQueue();
+                if (decoded && gDecoded.sub_chunks.has_value() && queue.isLimited()) {
+                    queue.push({gDecoded.sub_chunks.value(),
+                                [this, handle, source, &callback, packet]() mutable {
+                                    std::invoke(handle, this, source, callback, packet);
+                                }});
+                    return;
+                }
+            }
+        }
+    }
+    std::invoke(handle, this, source, callback, packet);
+}
+
+void hook_packet(void **vtable)
+{
+    if (gPacketOriginals.contains(vtable)) {
+        return;
+    }
+    gPacketOriginals[vtable] = {
+        replace_vtable_entry(vtable, slot::PacketWrite, detail::fp_cast(&PacketHooks::write)),
+        replace_vtable_entry(vtable, slot::PacketRead, detail::fp_cast(&PacketHooks::read)),
+    };
+}
+
+void hook_dispatcher(void **vtable)
+{
+    if (gDispatcherOriginals.contains(vtable)) {
+        return;
+    }
+    gDispatcherOriginals[vtable] =
+        replace_vtable_entry(vtable, slot::DispatcherHandle, detail::fp_cast(&PacketHandlerDispatcherHooks::handle));
+}
+
+}  // namespace
+
+void install_packet_hooks(PacketSender &sender)
+{
+    static std::once_flag once;
+    std::call_once(once, [&sender] {
+        auto **vtable = const_cast<void **>(get_vtable(&sender));
+        const auto hook_sender = [vtable](std::size_t index, void *detour) {
+            gSenderOriginals[index] = replace_vtable_entry(vtable, index, detour);
+        };
+        hook_sender(slot::SendToClient, detail::fp_cast(&PacketSenderHooks::sendToClient));
+        hook_sender(slot::SendToClientByNetworkId, detail::fp_cast(&PacketSenderHooks::sendToClientByNetworkId));
+        hook_sender(slot::SendToClients, detail::fp_cast(&PacketSenderHooks::sendToClients));
+        hook_sender(slot::SendBroadcast, detail::fp_cast(&PacketSenderHooks::sendBroadcast));
+        hook_sender(slot::SendBroadcastExcept, detail::fp_cast(&PacketSenderHooks::sendBroadcastExcept));
+
+        // every packet type has its own table, reached through a packet created by the factory
+        for (int id = 0; id < static_cast<int>(MinecraftPacketIds::EndId); ++id) {
+            const auto packet = MinecraftPackets::createPacket(static_cast<MinecraftPacketIds>(id));
+            if (!packet) {
+                continue;
+            }
+            hook_packet(const_cast<void **>(get_vtable(packet.get())));
+            if (const auto *handler = packet->getHandler()) {
+                hook_dispatcher(const_cast<void **>(get_vtable(handler)));
+            }
+        }
+
+        // the packets of the Endstone API are encoded by the adapter, which has a table of its own
+        SetTitlePacket title;
+        core::PacketAdapter adapter(title);
+        hook_packet(const_cast<void **>(get_vtable(&adapter)));
+    });
+}
+
+}  // namespace endstone::hook
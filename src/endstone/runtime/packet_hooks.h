@@ -0,0 +1,30 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "bedrock/network/packet_sender.h"
+
+namespace endstone::hook {
+
+/**
+ * Intercepts the game packets sent through the packet sender of the level and the game packets encoded, decoded and
+ * handled by the engine, so that they can be accounted for with their encoded size.
+ *
+ * These functions have no exported symbol, the entries of the virtual function tables of the packet sender, of every
+ * packet type and of their handler dispatchers are replaced instead. Installing is only done once.
+ */
+void install_packet_hooks(PacketSender &sender);
+
+}  // namespace endstone::hook
@@ -100,6 +100,19 @@ const std::unordered_map<std::string, void *> &get_detours()
         false);  // set load_symbol to false so symbols are limited to the export table
     return detours;
 }
+
+void *replace_vtable_entry(void **vtable, std::size_t index, void *detour)
+{
+    auto *entry = vtable + index;
+    DWORD protect;
+    if (!VirtualProtect(entry, sizeof(void *), PAGE_READWRITE, &protect)) {
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "VirtualProtect failed");
+    }
+    void *original = *entry;
+    *entry = detour;
+    VirtualProtect(entry, sizeof(void *), protect, &protect);
+    return original;
+}
 }  // namespace endstone::hook
 
 #endif
@@ -0,0 +1,46 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/level/actor_query.h"
+
+namespace endstone::core {
+
+TEST(ActorQueryTest, DistanceToBoxFromInside)
+{
+    EXPECT_FLOAT_EQ(distanceSquaredToBox({0.5F, 0.5F, 0.5F}, {0, 0, 0}, {1, 1, 1}), 0);
+    // points on the surface of the box are inside
+    EXPECT_FLOAT_EQ(distanceSquaredToBox({1, 0, 0.5F}, {0, 0, 0}, {1, 1, 1}), 0);
+}
+
+TEST(ActorQueryTest, DistanceToBoxFromFace)
+{
+    const Vector<float> min{-1, 64, -1};
+    const Vector<float> max{1, 66, 1};
+    EXPECT_FLOAT_EQ(distanceSquaredToBox({4, 65, 0}, min, max), 9);
+    EXPECT_FLOAT_EQ(distanceSquaredToBox({-4, 65, 0}, min, max), 9);
+    EXPECT_FLOAT_EQ(distanceSquaredToBox({0, 60, 0}, min, max), 16);
+    EXPECT_FLOAT_EQ(distanceSquaredToBox({0, 65, 3}, min, max), 4);
+}
+
+TEST(ActorQueryTest, DistanceToBoxFromCorner)
+{
+    // the closest point is the corner (1, 1, 1), not the center of the box
+    EXPECT_FLOAT_EQ(distanceSquaredToBox({2, 3, 3}, {0, 0, 0}, {1, 1, 1}), 9);
+    EXPECT_FLOAT_EQ(distanceSquaredToBox({-1, -2, 0.5F}, {0, 0, 0}, {1, 1, 1}), 5);
+}
+
+}  // namespace endstone::core
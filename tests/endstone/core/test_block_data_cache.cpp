@@ -0,0 +1,89 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/block/block_data_cache.h"
+
+namespace endstone::core {
+
+namespace {
+class TestBlockData : public BlockData {
+public:
+    explicit TestBlockData(std::string type) : type_(std::move(type)) {}
+
+    [[nodiscard]] std::string getType() const override
+    {
+        return type_;
+    }
+
+    [[nodiscard]] BlockStates getBlockStates() const override
+    {
+        return {};
+    }
+
+private:
+    std::string type_;
+};
+}  // namespace
+
+TEST(BlockDataCacheTest, MakeKey)
+{
+    EXPECT_EQ(BlockDataCache::makeKey("stone", {}), "minecraft:stone");
+    EXPECT_EQ(BlockDataCache::makeKey("minecraft:stone", {}), "minecraft:stone");
+    EXPECT_EQ(BlockDataCache::makeKey("custom:block", {}), "custom:block");
+    EXPECT_EQ(BlockDataCache::makeKey("wool", {{"color", "red"}}), R"(minecraft:wool["color"="red"])");
+
+    // states are sorted by name regardless of their insertion order
+    const BlockStates states{{"upside_down_bit", true}, {"weirdo_direction", 2}, {"facing", "north"}};
+    EXPECT_EQ(BlockDataCache::makeKey("oak_stairs", states),
+              R"(minecraft:oak_stairs["facing"="north","upside_down_bit"=true,"weirdo_direction"=2])");
+    EXPECT_NE(BlockDataCache::makeKey("lever", {{"open_bit", true}}),
+              BlockDataCache::makeKey("lever", {{"open_bit", 1}}));
+}
+
+TEST(BlockDataCacheTest, GetAndPut)
+{
+    BlockDataCache cache;
+    const auto key = BlockDataCache::makeKey("stone", {});
+    EXPECT_EQ(cache.get(key), nullptr);
+
+    auto data = std::make_shared<TestBlockData>("minecraft:stone");
+    cache.put(key, data);
+    EXPECT_EQ(cache.get(key), data);
+    EXPECT_EQ(cache.get(BlockDataCache::makeKey("minecraft:stone", {})), data);
+
+    const auto stats = cache.getStats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.size, 1);
+}
+
+TEST(BlockDataCacheTest, ClearWhenFull)
+{
+    BlockDataCache cache{2};
+    cache.put("a", std::make_shared<TestBlockData>("a"));
+    cache.put("b", std::make_shared<TestBlockData>("b"));
+    cache.put("b", std::make_shared<TestBlockData>("b"));
+    EXPECT_EQ(cache.getStats().size, 2);
+
+    cache.put("c", std::make_shared<TestBlockData>("c"));
+    EXPECT_EQ(cache.getStats().size, 1);
+    EXPECT_EQ(cache.get("a"), nullptr);
+    EXPECT_NE(cache.get("c"), nullptr);
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,87 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/block/block_ref.h"
+
+namespace endstone {
+
+TEST(BlockRefTest, Relative)
+{
+    const BlockRef origin;
+    const auto block = origin.getRelative(1, 2, 3);
+    EXPECT_EQ(block.getX(), 1);
+    EXPECT_EQ(block.getY(), 2);
+    EXPECT_EQ(block.getZ(), 3);
+    EXPECT_EQ(block.getRelative(BlockFace::Up, 2), origin.getRelative(1, 4, 3));
+    EXPECT_EQ(block.getRelative(BlockFace::West).getRelative(BlockFace::East), block);
+    EXPECT_NE(block, origin);
+}
+
+TEST(BlockRefTest, Neighbors)
+{
+    const BlockRef origin;
+    const auto neighbors = origin.getNeighbors();
+    EXPECT_EQ(neighbors[static_cast<int>(BlockFace::Down)], origin.getRelative(0, -1, 0));
+    EXPECT_EQ(neighbors[static_cast<int>(BlockFace::Up)], origin.getRelative(0, 1, 0));
+    EXPECT_EQ(neighbors[static_cast<int>(BlockFace::North)], origin.getRelative(0, 0, -1));
+    EXPECT_EQ(neighbors[static_cast<int>(BlockFace::South)], origin.getRelative(0, 0, 1));
+    EXPECT_EQ(neighbors[static_cast<int>(BlockFace::West)], origin.getRelative(-1, 0, 0));
+    EXPECT_EQ(neighbors[static_cast<int>(BlockFace::East)], origin.getRelative(1, 0, 0));
+}
+
+TEST(BlockRefTest, Hash)
+{
+    std::unordered_set<BlockRef> blocks;
+    const BlockRef origin;
+    for (int i = -8; i < 8; ++i) {
+        blocks.insert(origin.getRelative(i, 0, 0));
+        blocks.insert(origin.getRelative(0, i, 0));
+        blocks.insert(origin.getRelative(0, 0, i));
+    }
+    EXPECT_EQ(blocks.size(), 3 * 16 - 2);
+    EXPECT_TRUE(blocks.contains(origin));
+}
+
+TEST(BlockRefTest, FloodFill)
+{
+    // flood fill a 16x16x16 cube of air, as done by plugins that detect enclosed areas
+    constexpr int size = 16;
+    const auto inside = [](const BlockRef &block) {
+        return block.getX() >= 0 && block.getX() < size && block.getY() >= 0 && block.getY() < size &&
+               block.getZ() >= 0 && block.getZ() < size;
+    };
+
+    std::unordered_set<BlockRef> visited;
+    visited.reserve(size * size * size);
+    std::vector<BlockRef> queue{BlockRef{}};
+    visited.insert(queue.front());
+
+    while (!queue.empty()) {
+        const auto block = queue.back();
+        queue.pop_back();
+        for (const auto &neighbor : block.getNeighbors()) {
+            if (inside(neighbor) && visited.insert(neighbor).second) {
+                queue.push_back(neighbor);
+            }
+        }
+    }
+    EXPECT_EQ(visited.size(), size * size * size);
+}
+
+}  // namespace endstone
@@ -0,0 +1,129 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/block/block_transaction.h"
+
+namespace endstone {
+
+namespace {
+class TestBlockData : public BlockData {
+public:
+    explicit TestBlockData(std::string type) : type_(std::move(type)) {}
+
+    [[nodiscard]] std::string getType() const override
+    {
+        return type_;
+    }
+
+    [[nodiscard]] BlockStates getBlockStates() const override
+    {
+        return {};
+    }
+
+private:
+    std::string type_;
+};
+}  // namespace
+
+TEST(BlockTransactionTest, LaterChangeReplacesEarlierOne)
+{
+    const auto stone = std::make_shared<TestBlockData>("minecraft:stone");
+    const auto dirt = std::make_shared<TestBlockData>("minecraft:dirt");
+
+    BlockTransaction transaction;
+    EXPECT_TRUE(transaction.empty());
+    transaction.setBlockData(1, 2, 3, stone);
+    transaction.setBlockData(-1, -64, -3, stone);
+    transaction.setBlockData(1, 2, 3, dirt);
+
+    EXPECT_EQ(transaction.size(), 2);
+    EXPECT_EQ(transaction.getBlockData(1, 2, 3), dirt);
+    EXPECT_EQ(transaction.getBlockData(-1, -64, -3), stone);
+    EXPECT_EQ(transaction.getBlockData(1, 2, 4), nullptr);
+    EXPECT_EQ(transaction.getChanges().front().x, 1);
+
+    transaction.clear();
+    EXPECT_TRUE(transaction.empty());
+    EXPECT_FALSE(transaction.contains(1, 2, 3));
+}
+
+TEST(BlockTransactionTest, NegativeCoordinatesDoNotCollide)
+{
+    const auto stone = std::make_shared<TestBlockData>("minecraft:stone");
+    BlockTransaction transaction;
+    for (int i = -2; i <= 2; ++i) {
+        transaction.setBlockData(i, 0, 0, stone);
+        transaction.setBlockData(0, i, 0, stone);
+        transaction.setBlockData(0, 0, i, stone);
+    }
+    transaction.setBlockData(-30000000, -64, 30000000, stone);
+    transaction.setBlockData(30000000, 319, -30000000, stone);
+    EXPECT_EQ(transaction.size(), 3 * 5 - 2 + 2);
+}
+
+TEST(BlockTransactionTest, DistantCoordinatesDoNotCollide)
+{
+    const auto stone = std::make_shared<TestBlockData>("minecraft:stone");
+    const auto dirt = std::make_shared<TestBlockData>("minecraft:dirt");
+    BlockTransaction transaction;
+    transaction.setBlockData(0, 0, 0, stone);
+    transaction.setBlockData(1 << 26, 0, 0, dirt);
+    transaction.setBlockData(0, 1 << 12, 0, dirt);
+    transaction.setBlockData(0, 0, 1 << 26, dirt);
+    EXPECT_EQ(transaction.size(), 4);
+    EXPECT_EQ(transaction.getBlockData(0, 0, 0), stone);
+}
+
+TEST(BlockTransactionTest, Interior)
+{
+    const auto stone = std::make_shared<TestBlockData>("minecraft:stone");
+    BlockTransaction transaction;
+    for (int y = 0; y < 3; ++y) {
+        for (int z = 0; z < 3; ++z) {
+            for (int x = 0; x < 3; ++x) {
+                transaction.setBlockData(x, y, z, stone);
+            }
+        }
+    }
+
+    EXPECT_TRUE(transaction.isInterior(1, 1, 1));
+    EXPECT_FALSE(transaction.isInterior(0, 1, 1));
+    EXPECT_FALSE(transaction.isInterior(1, 2, 1));
+    EXPECT_FALSE(transaction.isInterior(5, 5, 5));
+}
+
+TEST(BlockTransactionTest, ChunkOrder)
+{
+    const auto stone = std::make_shared<TestBlockData>("minecraft:stone");
+    BlockTransaction transaction;
+    transaction.setBlockData(16, 0, 0, stone);
+    transaction.setBlockData(0, 5, 0, stone);
+    transaction.setBlockData(-1, 0, 0, stone);
+    transaction.setBlockData(1, 0, 0, stone);
+    transaction.setBlockData(0, 0, 16, stone);
+
+    const auto changes = transaction.getChangesInChunkOrder();
+    ASSERT_EQ(changes.size(), 5);
+    EXPECT_EQ(changes[0]->x, -1);  // chunk (-1, 0)
+    EXPECT_EQ(changes[1]->x, 1);   // chunk (0, 0), y = 0
+    EXPECT_EQ(changes[2]->y, 5);   // chunk (0, 0), y = 5
+    EXPECT_EQ(changes[3]->z, 16);  // chunk (0, 1)
+    EXPECT_EQ(changes[4]->x, 16);  // chunk (1, 0)
+}
+
+}  // namespace endstone
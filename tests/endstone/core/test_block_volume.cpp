@@ -0,0 +1,87 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/block/block_volume.h"
+
+namespace endstone {
+
+namespace {
+class TestBlockData : public BlockData {
+public:
+    explicit TestBlockData(std::string type) : type_(std::move(type)) {}
+
+    [[nodiscard]] std::string getType() const override
+    {
+        return type_;
+    }
+
+    [[nodiscard]] BlockStates getBlockStates() const override
+    {
+        return {};
+    }
+
+private:
+    std::string type_;
+};
+}  // namespace
+
+TEST(BlockVolumeTest, IndicesAreInYzxOrder)
+{
+    BlockVolume volume{-8, 60, 100, 3, 2, 4};
+    EXPECT_EQ(volume.getIndices().size(), 3 * 2 * 4);
+    EXPECT_EQ(volume.offsetOf(-8, 60, 100), 0);
+    EXPECT_EQ(volume.offsetOf(-7, 60, 100), 1);
+    EXPECT_EQ(volume.offsetOf(-8, 60, 101), 3);
+    EXPECT_EQ(volume.offsetOf(-8, 61, 100), 12);
+    EXPECT_EQ(volume.offsetOf(-6, 61, 103), volume.getIndices().size() - 1);
+}
+
+TEST(BlockVolumeTest, PaletteLookup)
+{
+    BlockVolume volume{0, 0, 0, 2, 2, 2};
+    const auto air = volume.addToPalette(std::make_shared<TestBlockData>("minecraft:air"));
+    const auto stone = volume.addToPalette(std::make_shared<TestBlockData>("minecraft:stone"));
+    EXPECT_EQ(air, 0);
+    EXPECT_EQ(stone, 1);
+
+    volume.setIndex(1, 1, 1, stone);
+    EXPECT_EQ(volume.getBlockData(0, 0, 0)->getType(), "minecraft:air");
+    EXPECT_EQ(volume.getBlockData(1, 1, 1)->getType(), "minecraft:stone");
+    EXPECT_EQ(volume.getBlockData(2, 1, 1), nullptr);
+    EXPECT_EQ(volume.getBlockData(-1, 0, 0), nullptr);
+
+    // out of range writes are ignored
+    volume.setIndex(0, 2, 0, stone);
+    EXPECT_EQ(std::count(volume.getIndices().begin(), volume.getIndices().end(), stone), 1);
+}
+
+TEST(BlockVolumeTest, PaletteIsLimitedToIndexRange)
+{
+    BlockVolume volume{0, 0, 0, 1, 1, 1};
+    const auto data = std::make_shared<TestBlockData>("minecraft:stone");
+    for (std::size_t i = 0; i < BlockVolume::MaxPaletteSize; ++i) {
+        volume.addToPalette(data);
+    }
+    EXPECT_EQ(volume.getPalette().size(), 65536);
+    EXPECT_THROW(volume.addToPalette(data), std::length_error);
+    EXPECT_EQ(volume.getPalette().size(), 65536);
+}
+
+}  // namespace endstone
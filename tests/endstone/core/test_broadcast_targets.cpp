@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/network/broadcast_targets.h"
+
+namespace endstone::core {
+namespace {
+NetworkIdentifier rakNetId(std::uint64_t guid)
+{
+    NetworkIdentifier id{};
+    id.type = NetworkIdentifier::Type::RakNet;
+    id.guid = RakNet::RakNetGUID(guid);
+    return id;
+}
+
+NetworkIdentifier netherNetId(std::uint64_t nether_net_id)
+{
+    NetworkIdentifier id{};
+    id.type = NetworkIdentifier::Type::NetherNet;
+    id.nether_net_id = nether_net_id;
+    return id;
+}
+}  // namespace
+
+TEST(BroadcastTargetsTest, Empty)
+{
+    BroadcastTargets targets;
+    EXPECT_TRUE(targets.empty());
+    EXPECT_TRUE(targets.get().empty());
+}
+
+TEST(BroadcastTargetsTest, KeepsOrder)
+{
+    BroadcastTargets targets{3};
+    EXPECT_TRUE(targets.add(rakNetId(3), SubClientId::PrimaryClient));
+    EXPECT_TRUE(targets.add(rakNetId(1), SubClientId::PrimaryClient));
+    EXPECT_TRUE(targets.add(netherNetId(2), SubClientId::PrimaryClient));
+
+    ASSERT_EQ(targets.get().size(), 3);
+    EXPECT_EQ(targets.get()[0].network_identifier.guid.g, 3);
+    EXPECT_EQ(targets.get()[1].network_identifier.guid.g, 1);
+    EXPECT_EQ(targets.get()[2].network_identifier.nether_net_id, 2);
+}
+
+TEST(BroadcastTargetsTest, SkipsDuplicates)
+{
+    BroadcastTargets targets;
+    EXPECT_TRUE(targets.add(rakNetId(1), SubClientId::PrimaryClient));
+    EXPECT_FALSE(targets.add(rakNetId(1), SubClientId::PrimaryClient));
+    EXPECT_EQ(targets.get().size(), 1);
+}
+
+TEST(BroadcastTargetsTest, SubClientsAreSeparateTargets)
+{
+    BroadcastTargets targets;
+    EXPECT_TRUE(targets.add(rakNetId(1), SubClientId::PrimaryClient));
+    EXPECT_TRUE(targets.add(rakNetId(1), SubClientId::Client2));
+    EXPECT_EQ(targets.get().size(), 2);
+}
+
+TEST(BroadcastTargetsTest, ComparesByTransport)
+{
+    // the same number as a RakNet GUID and as a NetherNet ID identifies two different clients
+    BroadcastTargets targets;
+    EXPECT_TRUE(targets.add(rakNetId(1), SubClientId::PrimaryClient));
+    EXPECT_TRUE(targets.add(netherNetId(1), SubClientId::PrimaryClient));
+    EXPECT_EQ(targets.get().size(), 2);
+}
+
+}  // namespace endstone::core
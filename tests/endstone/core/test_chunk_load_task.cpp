@@ -0,0 +1,136 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <set>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/level/chunk_load_task.h"
+
+namespace endstone::core {
+
+TEST(ChunkLoadTaskTest, PlanBatchesCoversAreaOnce)
+{
+    const auto batches = EndstoneChunkLoadTask::planBatches(-10, -3, 10, 20, 8);
+    std::set<std::pair<int, int>> chunks;
+    std::size_t count = 0;
+    for (const auto &batch : batches) {
+        EXPECT_LE(batch.max_x - batch.min_x + 1, 8);
+        EXPECT_LE(batch.max_z - batch.min_z + 1, 8);
+        for (auto x = batch.min_x; x <= batch.max_x; ++x) {
+            for (auto z = batch.min_z; z <= batch.max_z; ++z) {
+                EXPECT_GE(x, -10);
+                EXPECT_LE(x, 10);
+                EXPECT_GE(z, -3);
+                EXPECT_LE(z, 20);
+                chunks.emplace(x, z);
+                count++;
+            }
+        }
+    }
+    EXPECT_EQ(count, 21 * 24);
+    EXPECT_EQ(chunks.size(), count);
+}
+
+TEST(ChunkLoadTaskTest, PlanBatchesStartsAtCenter)
+{
+    const auto batches = EndstoneChunkLoadTask::planBatches(-12, -12, 12, 12, 8);
+    ASSERT_FALSE(batches.empty());
+    const auto &first = batches.front();
+    EXPECT_TRUE(first.min_x <= 0 && 0 <= first.max_x);
+    EXPECT_TRUE(first.min_z <= 0 && 0 <= first.max_z);
+}
+
+TEST(ChunkLoadTaskTest, Progress)
+{
+    EndstoneChunkLoadTask task(0, 0, 15, 15, 8);
+    EXPECT_EQ(task.getTotalChunks(), 256);
+
+    bool completed = false;
+    task.whenComplete([&](ChunkLoadTask &) { completed = true; });
+
+    std::size_t batches = 0;
+    while (auto batch = task.nextBatch()) {
+        EXPECT_FALSE(task.isDone());
+        task.finishBatch(batch.value(), batch->size());
+        batches++;
+    }
+    EXPECT_EQ(batches, 4);
+    EXPECT_EQ(task.getLoadedChunks(), 256);
+    EXPECT_TRUE(task.isDone());
+    EXPECT_FALSE(task.isCancelled());
+    EXPECT_TRUE(completed);
+}
+
+TEST(ChunkLoadTaskTest, RetryBatch)
+{
+    EndstoneChunkLoadTask task(0, 0, 15, 15, 8);
+    const auto first = task.nextBatch();
+    ASSERT_TRUE(first.has_value());
+    task.retryBatch(first.value());
+
+    const auto again = task.nextBatch();
+    ASSERT_TRUE(again.has_value());
+    EXPECT_EQ(again->min_x, first->min_x);
+    EXPECT_EQ(again->min_z, first->min_z);
+    EXPECT_FALSE(task.isDone());
+}
+
+TEST(ChunkLoadTaskTest, CancelWaitsForBatchesInProgress)
+{
+    EndstoneChunkLoadTask task(0, 0, 15, 15, 8);
+    const auto batch = task.nextBatch();
+    ASSERT_TRUE(batch.has_value());
+
+    task.cancel();
+    EXPECT_TRUE(task.isCancelled());
+    EXPECT_FALSE(task.isDone());
+    EXPECT_FALSE(task.nextBatch().has_value());
+
+    task.finishBatch(batch.value(), 10);
+    EXPECT_TRUE(task.isDone());
+    EXPECT_EQ(task.getLoadedChunks(), 10);
+
+    bool completed = false;
+    task.whenComplete([&](ChunkLoadTask &) { completed = true; });
+    EXPECT_TRUE(completed);
+}
+
+TEST(ChunkLoadTaskTest, CancelCompletesOnUpdate)
+{
+    EndstoneChunkLoadTask task(0, 0, 15, 15, 8);
+    bool completed = false;
+    task.whenComplete([&](ChunkLoadTask &) { completed = true; });
+
+    // with no batch in progress, the task completes on the next update of the server thread
+    task.cancel();
+    EXPECT_FALSE(task.isDone());
+    task.update();
+    EXPECT_TRUE(task.isDone());
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(task.getLoadedChunks(), 0);
+}
+
+TEST(ChunkLoadTaskTest, MinTicksPerSecond)
+{
+    EndstoneChunkLoadTask task(0, 0, 0, 0, 8);
+    EXPECT_FLOAT_EQ(task.getMinTicksPerSecond(), 0.0F);
+    task.setMinTicksPerSecond(18.0F);
+    EXPECT_FLOAT_EQ(task.getMinTicksPerSecond(), 18.0F);
+    task.setMinTicksPerSecond(-1.0F);
+    EXPECT_FLOAT_EQ(task.getMinTicksPerSecond(), 0.0F);
+}
+
+}  // namespace endstone::core
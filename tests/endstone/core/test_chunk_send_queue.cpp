@@ -0,0 +1,136 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/network/chunk_send_queue.h"
+
+namespace endstone::core {
+
+class ChunkSendQueueTest : public ::testing::Test {
+protected:
+    void push(Vector<float> center, std::size_t count, std::size_t bytes = 0)
+    {
+        const auto id = static_cast<int>(queue_.size() + handled_.size());
+        queue_.push({{center, count}, [this, id, bytes]() {
+                         handled_.push_back(id);
+                         queue_.recordBytes(bytes);
+                     }});
+    }
+
+    std::size_t tick()
+    {
+        return queue_.tick({0, 64, 0}, 0);
+    }
+
+    ChunkSendQueue queue_;
+    std::vector<int> handled_;
+};
+
+TEST_F(ChunkSendQueueTest, ParseRequest)
+{
+    // dimension 0, base sub-chunk (1, -1, 2), offsets (0, 0, 0) and (1, 0, 0)
+    const std::vector<std::byte> body{std::byte{0x00}, std::byte{0x02}, std::byte{0x01}, std::byte{0x04},
+                                      std::byte{0x02}, std::byte{0x00}, std::byte{0x00}, std::byte{0x00},
+                                      std::byte{0x00}, std::byte{0x00}, std::byte{0x00}, std::byte{0x01},
+                                      std::byte{0x00}, std::byte{0x00}};
+    const auto area = ChunkSendQueue::parseRequest(body);
+    ASSERT_TRUE(area.has_value());
+    EXPECT_EQ(area->count, 2);
+    EXPECT_EQ(area->center, Vector<float>(32, -8, 40));
+
+    // the offsets announced are missing
+    const std::vector truncated(body.begin(), body.end() - 3);
+    EXPECT_FALSE(ChunkSendQueue::parseRequest(truncated).has_value());
+    EXPECT_FALSE(ChunkSendQueue::parseRequest({}).has_value());
+}
+
+TEST_F(ChunkSendQueueTest, UnlimitedByDefault)
+{
+    EXPECT_FALSE(queue_.isLimited());
+    for (int i = 0; i < 10; ++i) {
+        push({0, 64, 0}, 100);
+    }
+    EXPECT_EQ(tick(), 10);
+    EXPECT_EQ(queue_.size(), 0);
+}
+
+TEST_F(ChunkSendQueueTest, ChunkBudget)
+{
+    queue_.setRate(4, 0);
+    EXPECT_TRUE(queue_.isLimited());
+    push({0, 64, 0}, 2);
+    push({0, 64, 0}, 2);
+    push({0, 64, 0}, 2);
+
+    EXPECT_EQ(tick(), 2);
+    EXPECT_EQ(queue_.size(), 1);
+    EXPECT_EQ(tick(), 1);
+    EXPECT_EQ(queue_.size(), 0);
+}
+
+TEST_F(ChunkSendQueueTest, OverdraftIsPaidBack)
+{
+    // a request is never split, what it takes beyond the budget is taken from the next ticks
+    queue_.setRate(4, 0);
+    push({0, 64, 0}, 10);
+    push({0, 64, 0}, 1);
+
+    EXPECT_EQ(tick(), 1);
+    EXPECT_EQ(tick(), 0);
+    EXPECT_EQ(tick(), 1);
+}
+
+TEST_F(ChunkSendQueueTest, ByteBudget)
+{
+    queue_.setRate(0, 1000);
+    push({0, 64, 0}, 1, 1500);
+    push({0, 64, 0}, 1, 100);
+    push({0, 64, 0}, 1, 100);
+
+    EXPECT_EQ(tick(), 1);
+    EXPECT_EQ(tick(), 2);
+}
+
+TEST_F(ChunkSendQueueTest, NearestInFrontFirst)
+{
+    // the player is at the origin and faces south (+z)
+    queue_.setRate(1, 0);
+    push({80, 64, 0}, 1);    // to the side
+    push({0, 64, -40}, 1);   // behind, further than in front once weighted
+    push({0, 64, 100}, 1);   // in front
+    push({0, 64, -8}, 1);    // around the player, whatever the direction
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(tick(), 1);
+    }
+    EXPECT_EQ(handled_, (std::vector{3, 2, 1, 0}));
+}
+
+TEST_F(ChunkSendQueueTest, RateCanBeLifted)
+{
+    queue_.setRate(1, 0);
+    push({0, 64, 0}, 1);
+    push({0, 64, 0}, 1);
+    EXPECT_EQ(tick(), 1);
+
+    queue_.setRate(0, 0);
+    EXPECT_FALSE(queue_.isLimited());
+    EXPECT_EQ(tick(), 1);
+}
+
+}  // namespace endstone::core
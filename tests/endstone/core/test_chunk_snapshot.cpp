@@ -0,0 +1,138 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/level/chunk_snapshot.h"
+
+namespace endstone {
+
+namespace {
+class TestBlockData : public BlockData {
+public:
+    explicit TestBlockData(std::string type) : type_(std::move(type)) {}
+
+    [[nodiscard]] std::string getType() const override
+    {
+        return type_;
+    }
+
+    [[nodiscard]] BlockStates getBlockStates() const override
+    {
+        return {};
+    }
+
+private:
+    std::string type_;
+};
+
+// a chunk column of the overworld with the given number of distinct blocks, laid out in horizontal layers
+BlockVolume makeChunk(int x, int z, int num_blocks)
+{
+    BlockVolume volume{x << 4, -64, z << 4, 16, 384, 16};
+    for (int i = 0; i < num_blocks; ++i) {
+        volume.addToPalette(std::make_shared<TestBlockData>("minecraft:block_" + std::to_string(i)));
+    }
+    for (auto y = volume.getY(); y < volume.getY() + volume.getHeight(); ++y) {
+        for (auto bz = volume.getZ(); bz < volume.getZ() + 16; ++bz) {
+            for (auto bx = volume.getX(); bx < volume.getX() + 16; ++bx) {
+                volume.setIndex(bx, y, bz, static_cast<BlockVolume::Index>((y + bx + bz) % num_blocks));
+            }
+        }
+    }
+    return volume;
+}
+}  // namespace
+
+TEST(ChunkSnapshotTest, RoundTrip)
+{
+    for (const auto num_blocks : {1, 2, 5, 16, 17, 300}) {
+        const auto volume = makeChunk(-3, 7, num_blocks);
+        const ChunkSnapshot snapshot{-3, 7, volume};
+        EXPECT_EQ(snapshot.getMinHeight(), -64);
+        EXPECT_EQ(snapshot.getMaxHeight(), 320);
+        for (auto y = -64; y < 320; y += 7) {
+            for (auto z = 0; z < 16; ++z) {
+                for (auto x = 0; x < 16; ++x) {
+                    const auto expected = volume.getIndices()[volume.offsetOf((-3 << 4) + x, y, (7 << 4) + z)];
+                    ASSERT_EQ(snapshot.getPaletteIndex(x, y, z), expected) << num_blocks << " blocks";
+                }
+            }
+        }
+    }
+}
+
+TEST(ChunkSnapshotTest, BitsPerBlock)
+{
+    EXPECT_EQ(ChunkSnapshot(0, 0, makeChunk(0, 0, 1)).getBitsPerBlock(), 0);
+    EXPECT_EQ(ChunkSnapshot(0, 0, makeChunk(0, 0, 2)).getBitsPerBlock(), 1);
+    EXPECT_EQ(ChunkSnapshot(0, 0, makeChunk(0, 0, 16)).getBitsPerBlock(), 4);
+    EXPECT_EQ(ChunkSnapshot(0, 0, makeChunk(0, 0, 17)).getBitsPerBlock(), 5);
+}
+
+TEST(ChunkSnapshotTest, OutOfBounds)
+{
+    const ChunkSnapshot snapshot{0, 0, makeChunk(0, 0, 4)};
+    EXPECT_EQ(snapshot.getBlockData(16, 0, 0), nullptr);
+    EXPECT_EQ(snapshot.getBlockData(0, -65, 0), nullptr);
+    EXPECT_EQ(snapshot.getBlockData(0, 320, 0), nullptr);
+    EXPECT_NE(snapshot.getBlockData(15, 319, 15), nullptr);
+}
+
+TEST(ChunkSnapshotTest, RejectVolumeOfWrongSize)
+{
+    const BlockVolume narrow{0, -64, 0, 8, 384, 16};
+    EXPECT_THROW(ChunkSnapshot(0, 0, narrow), std::invalid_argument);
+    const BlockVolume deep{0, -64, 0, 16, 384, 32};
+    EXPECT_THROW(ChunkSnapshot(0, 0, deep), std::invalid_argument);
+}
+
+TEST(ChunkSnapshotTest, ReadFromManyThreads)
+{
+    const ChunkSnapshot snapshot{0, 0, makeChunk(0, 0, 16)};
+    std::vector<std::thread> threads;
+    std::vector<std::size_t> counts(4);
+    for (std::size_t t = 0; t < counts.size(); ++t) {
+        threads.emplace_back([&snapshot, &counts, t]() {
+            for (auto y = snapshot.getMinHeight(); y < snapshot.getMaxHeight(); ++y) {
+                for (auto z = 0; z < 16; ++z) {
+                    for (auto x = 0; x < 16; ++x) {
+                        counts[t] += snapshot.getPaletteIndex(x, y, z) == 0 ? 1 : 0;
+                    }
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (const auto count : counts) {
+        EXPECT_EQ(count, counts.front());
+    }
+}
+
+TEST(ChunkSnapshotTest, MemoryUsage)
+{
+    const auto volume = makeChunk(0, 0, 16);
+    const ChunkSnapshot snapshot{0, 0, volume};
+    // 4 bits per block for 16 distinct blocks instead of 16 bits per block in the volume
+    EXPECT_LT(snapshot.getMemoryUsage(), volume.getIndices().size() * sizeof(BlockVolume::Index) / 3);
+}
+
+}  // namespace endstone
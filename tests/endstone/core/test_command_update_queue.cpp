@@ -0,0 +1,81 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/command/command_update_queue.h"
+
+namespace endstone::core {
+
+class CommandUpdateQueueTest : public ::testing::Test {
+protected:
+    static UUID makeId(std::uint8_t id)
+    {
+        UUID uuid{};
+        uuid.data[15] = id;
+        return uuid;
+    }
+};
+
+TEST_F(CommandUpdateQueueTest, CoalesceRequests)
+{
+    CommandUpdateQueue queue;
+    queue.push(makeId(1));
+    queue.push(makeId(2));
+    queue.push(makeId(1));
+
+    const auto players = queue.pop();
+    ASSERT_EQ(players.size(), 2);
+    EXPECT_EQ(players[0], makeId(1));
+    EXPECT_EQ(players[1], makeId(2));
+    EXPECT_TRUE(queue.empty());
+
+    // served players can ask again
+    queue.push(makeId(1));
+    EXPECT_EQ(queue.pop().size(), 1);
+
+    const auto stats = queue.getStats();
+    EXPECT_EQ(stats.requested, 4);
+    EXPECT_EQ(stats.coalesced, 1);
+    EXPECT_EQ(stats.sent, 3);
+    EXPECT_EQ(stats.pending, 0);
+}
+
+TEST_F(CommandUpdateQueueTest, JoinStorm)
+{
+    // 100 players joining at once, each asking for an update on join and again when their permissions are set
+    CommandUpdateQueue queue{20};
+    for (int round = 0; round < 2; ++round) {
+        for (std::uint8_t i = 0; i < 100; ++i) {
+            queue.push(makeId(i));
+        }
+    }
+
+    std::uint8_t next = 0;
+    int ticks = 0;
+    while (!queue.empty()) {
+        const auto players = queue.pop();
+        EXPECT_LE(players.size(), 20);
+        for (const auto &player : players) {
+            EXPECT_EQ(player, makeId(next++));  // served in the order they asked
+        }
+        ticks++;
+    }
+
+    EXPECT_EQ(next, 100);
+    EXPECT_EQ(ticks, 5);
+    EXPECT_EQ(queue.getStats().coalesced, 100);
+}
+
+}  // namespace endstone::core
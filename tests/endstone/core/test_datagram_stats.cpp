@@ -0,0 +1,122 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/network/datagram_stats.h"
+
+namespace endstone::core {
+
+TEST(DatagramStatsTest, RecordPerDirectionAndId)
+{
+    DatagramStats stats;
+    stats.record(DatagramStats::Direction::Inbound, 0x01, 33);
+    stats.record(DatagramStats::Direction::Inbound, 0x01, 33);
+    stats.record(DatagramStats::Direction::Outbound, 0x1c, 120);
+
+    auto counter = stats.get(DatagramStats::Direction::Inbound, 0x01);
+    EXPECT_EQ(counter.datagrams, 2);
+    EXPECT_EQ(counter.bytes, 66);
+
+    counter = stats.get(DatagramStats::Direction::Outbound, 0x1c);
+    EXPECT_EQ(counter.datagrams, 1);
+    EXPECT_EQ(counter.bytes, 120);
+
+    counter = stats.get(DatagramStats::Direction::Outbound, 0x01);
+    EXPECT_EQ(counter.datagrams, 0);
+    EXPECT_EQ(counter.bytes, 0);
+}
+
+TEST(DatagramStatsTest, RecordFromManyThreads)
+{
+    DatagramStats stats;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&stats]() {
+            for (int j = 0; j < 10000; ++j) {
+                stats.record(DatagramStats::Direction::Outbound, 0x84, 10);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    const auto counter = stats.get(DatagramStats::Direction::Outbound, 0x84);
+    EXPECT_EQ(counter.datagrams, 40000);
+    EXPECT_EQ(counter.bytes, 400000);
+}
+
+TEST(DatagramStatsTest, GetTotal)
+{
+    DatagramStats stats;
+    stats.record(DatagramStats::Direction::Inbound, 0x01, 33);
+    stats.record(DatagramStats::Direction::Inbound, 0x84, 500);
+    stats.record(DatagramStats::Direction::Outbound, 0x1c, 120);
+
+    auto total = stats.getTotal(DatagramStats::Direction::Inbound);
+    EXPECT_EQ(total.datagrams, 2);
+    EXPECT_EQ(total.bytes, 533);
+
+    total = stats.getTotal(DatagramStats::Direction::Outbound);
+    EXPECT_EQ(total.datagrams, 1);
+    EXPECT_EQ(total.bytes, 120);
+}
+
+TEST(DatagramStatsTest, RecordPerPeer)
+{
+    DatagramStats stats;
+    PeerAddress alice;
+    alice.ip[15] = 1;
+    alice.port = 19132;
+    PeerAddress bob = alice;
+    bob.port = 19133;
+
+    stats.record(DatagramStats::Direction::Inbound, 0x84, 100, alice);
+    EXPECT_FALSE(stats.getPeer(alice, DatagramStats::Direction::Inbound).has_value());
+
+    stats.addPeer(alice);
+    stats.record(DatagramStats::Direction::Inbound, 0x84, 100, alice);
+    stats.record(DatagramStats::Direction::Inbound, 0xc0, 10, alice);
+    stats.record(DatagramStats::Direction::Outbound, 0x84, 200, alice);
+    stats.record(DatagramStats::Direction::Inbound, 0x84, 100, bob);
+
+    auto counter = stats.getPeer(alice, DatagramStats::Direction::Inbound);
+    ASSERT_TRUE(counter.has_value());
+    EXPECT_EQ(counter->datagrams, 2);
+    EXPECT_EQ(counter->bytes, 110);
+    counter = stats.getPeer(alice, DatagramStats::Direction::Outbound);
+    ASSERT_TRUE(counter.has_value());
+    EXPECT_EQ(counter->datagrams, 1);
+    EXPECT_EQ(counter->bytes, 200);
+    EXPECT_EQ(stats.getTotal(DatagramStats::Direction::Inbound).datagrams, 4);
+
+    stats.removePeer(alice);
+    EXPECT_FALSE(stats.getPeer(alice, DatagramStats::Direction::Inbound).has_value());
+}
+
+TEST(DatagramStatsTest, GetName)
+{
+    EXPECT_STREQ(DatagramStats::getName(0x01), "UnconnectedPing");
+    EXPECT_STREQ(DatagramStats::getName(0x1c), "UnconnectedPong");
+    EXPECT_STREQ(DatagramStats::getName(0x84), "Datagram");
+    EXPECT_STREQ(DatagramStats::getName(0xc0), "Ack");
+    EXPECT_STREQ(DatagramStats::getName(0xa0), "Nak");
+    EXPECT_STREQ(DatagramStats::getName(0x42), "Unknown");
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,121 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/ban/ip_ban_list.h"
+
+namespace endstone::core {
+
+class IpBanListTest : public ::testing::Test {
+protected:
+    std::string file_ = "test_banned_ips.json";
+
+    void TearDown() override
+    {
+        std::remove(file_.c_str());
+        std::remove((file_ + ".journal").c_str());
+    }
+};
+
+TEST_F(IpBanListTest, IsBanned)
+{
+    EndstoneIpBanList ban_list{file_};
+
+    ban_list.addBan("192.168.1.10", "Misconduct", std::nullopt, "Moderator");
+    EXPECT_TRUE(ban_list.isBanned("192.168.1.10"));
+    EXPECT_FALSE(ban_list.isBanned("192.168.1.11"));
+
+    ban_list.removeBan("192.168.1.10");
+    EXPECT_FALSE(ban_list.isBanned("192.168.1.10"));
+}
+
+TEST_F(IpBanListTest, IsBannedByRange)
+{
+    EndstoneIpBanList ban_list{file_};
+
+    ban_list.addBan("10.20.0.0/16", "Botnet", std::nullopt, "AntiCheat");
+    ban_list.addBan("2001:db8::/32", "Botnet", std::nullopt, "AntiCheat");
+    EXPECT_TRUE(ban_list.isBanned("10.20.0.1"));
+    EXPECT_TRUE(ban_list.isBanned("10.20.255.255"));
+    EXPECT_FALSE(ban_list.isBanned("10.21.0.1"));
+    EXPECT_TRUE(ban_list.isBanned("2001:db8:1234::1"));
+    EXPECT_FALSE(ban_list.isBanned("2001:db9::1"));
+
+    ban_list.removeBan("10.20.0.0/16");
+    EXPECT_FALSE(ban_list.isBanned("10.20.0.1"));
+    EXPECT_TRUE(ban_list.isBanned("2001:db8:1234::1"));
+}
+
+TEST_F(IpBanListTest, GetBanEntryByRange)
+{
+    EndstoneIpBanList ban_list{file_};
+
+    ban_list.addBan("10.0.0.0/8", "Botnet", std::nullopt, "AntiCheat");
+    ban_list.addBan("10.20.0.0/16", "Spam", std::nullopt, "Moderator");
+    ban_list.addBan("10.20.30.40", "Griefing", std::nullopt, "Moderator");
+
+    // an exact entry comes first, then the most specific range covering the address
+    ASSERT_NE(ban_list.getBanEntry("10.20.30.40"), nullptr);
+    EXPECT_EQ(ban_list.getBanEntry("10.20.30.40")->getReason(), "Griefing");
+    ASSERT_NE(ban_list.getBanEntry("10.20.30.41"), nullptr);
+    EXPECT_EQ(ban_list.getBanEntry("10.20.30.41")->getAddress(), "10.20.0.0/16");
+    ASSERT_NE(ban_list.getBanEntry("10.1.2.3"), nullptr);
+    EXPECT_EQ(ban_list.getBanEntry("10.1.2.3")->getAddress(), "10.0.0.0/8");
+    EXPECT_EQ(ban_list.getBanEntry("11.0.0.1"), nullptr);
+
+    const auto &const_list = ban_list;
+    ASSERT_NE(const_list.getBanEntry("10.20.0.1"), nullptr);
+    EXPECT_EQ(const_list.getBanEntry("10.20.0.1")->getReason(), "Spam");
+
+    ban_list.removeBan("10.20.0.0/16");
+    ASSERT_NE(ban_list.getBanEntry("10.20.0.1"), nullptr);
+    EXPECT_EQ(ban_list.getBanEntry("10.20.0.1")->getAddress(), "10.0.0.0/8");
+}
+
+TEST_F(IpBanListTest, ExpiredRangeIsRemoved)
+{
+    EndstoneIpBanList ban_list{file_};
+
+    ban_list.addBan("10.0.0.0/8", "Botnet", std::chrono::seconds(-1), "AntiCheat");
+    EXPECT_FALSE(ban_list.isBanned("10.1.2.3"));
+    EXPECT_EQ(ban_list.getEntries().size(), 0);
+}
+
+TEST(CidrTreeTest, Contains)
+{
+    CidrTree tree;
+    EXPECT_TRUE(tree.insert("172.16.0.0/12"));
+    EXPECT_TRUE(tree.insert("0.0.0.0/0"));
+    EXPECT_TRUE(tree.contains("8.8.8.8"));
+    EXPECT_TRUE(tree.erase("0.0.0.0/0"));
+    EXPECT_FALSE(tree.contains("8.8.8.8"));
+    EXPECT_TRUE(tree.contains("172.31.255.255"));
+    EXPECT_FALSE(tree.contains("172.32.0.0"));
+    EXPECT_FALSE(tree.contains("::ffff:ac10:1"));
+    EXPECT_FALSE(tree.erase("172.16.0.0/13"));
+}
+
+TEST(CidrTreeTest, IsRange)
+{
+    EXPECT_TRUE(CidrTree::isRange("192.168.0.0/16"));
+    EXPECT_TRUE(CidrTree::isRange("2001:db8::/32"));
+    EXPECT_FALSE(CidrTree::isRange("192.168.0.1"));
+    EXPECT_FALSE(CidrTree::isRange("192.168.0.0/33"));
+    EXPECT_FALSE(CidrTree::isRange("192.168.0.0/"));
+    EXPECT_FALSE(CidrTree::isRange("192.168.0.0/1x"));
+    EXPECT_FALSE(CidrTree::isRange("localhost/8"));
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,59 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/util/latency_tracker.h"
+
+namespace endstone::core {
+
+using Duration = LatencyTracker::Duration;
+
+TEST(LatencyTrackerTest, Empty)
+{
+    LatencyTracker tracker;
+    EXPECT_EQ(tracker.getCount(), 0);
+    EXPECT_EQ(tracker.getPercentile(50).count(), 0.0);
+}
+
+TEST(LatencyTrackerTest, Percentiles)
+{
+    LatencyTracker tracker{100};
+    for (int i = 100; i >= 1; --i) {
+        tracker.record(Duration(i));
+    }
+
+    EXPECT_EQ(tracker.getCount(), 100);
+    EXPECT_DOUBLE_EQ(tracker.getPercentile(0).count(), 1.0);
+    EXPECT_DOUBLE_EQ(tracker.getPercentile(50).count(), 50.0);
+    EXPECT_DOUBLE_EQ(tracker.getPercentile(95).count(), 95.0);
+    EXPECT_DOUBLE_EQ(tracker.getPercentile(99).count(), 99.0);
+    EXPECT_DOUBLE_EQ(tracker.getPercentile(100).count(), 100.0);
+}
+
+TEST(LatencyTrackerTest, RollingWindow)
+{
+    LatencyTracker tracker{4};
+    for (int i = 0; i < 4; ++i) {
+        tracker.record(Duration(1000));
+    }
+    for (int i = 0; i < 4; ++i) {
+        tracker.record(Duration(1));
+    }
+
+    EXPECT_EQ(tracker.getCount(), 8);
+    EXPECT_DOUBLE_EQ(tracker.getPercentile(100).count(), 1.0);
+}
+
+}  // namespace endstone::core
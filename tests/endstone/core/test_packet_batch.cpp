@@ -0,0 +1,107 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/network/packet_batch.h"
+
+namespace endstone::core {
+
+class PacketBatchTest : public ::testing::Test {
+protected:
+    std::size_t send(::Packet *packet = nullptr)
+    {
+        return batch_.send([this](::Packet &sent) { sent_.push_back(&sent); }, packet);
+    }
+
+    PacketBatch batch_;
+    std::vector<::Packet *> sent_;
+};
+
+TEST_F(PacketBatchTest, SendInQueueOrder)
+{
+    const auto first = std::make_shared<::Packet>();
+    const auto second = std::make_shared<::Packet>();
+    batch_.add(first);
+    batch_.add(second);
+    EXPECT_FALSE(batch_.empty());
+
+    EXPECT_EQ(send(), 2);
+    ASSERT_EQ(sent_.size(), 2);
+    EXPECT_EQ(sent_[0], first.get());
+    EXPECT_EQ(sent_[1], second.get());
+    EXPECT_TRUE(batch_.empty());
+}
+
+TEST_F(PacketBatchTest, ImmediatePacketIsSentLast)
+{
+    // a chat message sent right away must not overtake the title queued before it
+    const auto queued = std::make_shared<::Packet>();
+    ::Packet immediate;
+    batch_.add(queued);
+
+    EXPECT_EQ(send(&immediate), 2);
+    ASSERT_EQ(sent_.size(), 2);
+    EXPECT_EQ(sent_[0], queued.get());
+    EXPECT_EQ(sent_[1], &immediate);
+}
+
+TEST_F(PacketBatchTest, ImmediatePacketWithEmptyBatch)
+{
+    ::Packet immediate;
+    EXPECT_EQ(send(&immediate), 1);
+    ASSERT_EQ(sent_.size(), 1);
+    EXPECT_EQ(sent_[0], &immediate);
+    EXPECT_EQ(send(), 0);
+}
+
+TEST_F(PacketBatchTest, PacketsQueuedWhileSendingGoToNextBatch)
+{
+    const auto first = std::make_shared<::Packet>();
+    const auto second = std::make_shared<::Packet>();
+    batch_.add(first);
+
+    const auto count = batch_.send([&](::Packet &sent) {
+        sent_.push_back(&sent);
+        batch_.add(second);
+    });
+    EXPECT_EQ(count, 1);
+    ASSERT_EQ(sent_.size(), 1);
+    EXPECT_FALSE(batch_.empty());
+
+    EXPECT_EQ(send(), 1);
+    EXPECT_EQ(sent_[1], second.get());
+}
+
+TEST_F(PacketBatchTest, Stats)
+{
+    PacketBatch::Stats stats;
+    EXPECT_EQ(stats.getAveragePackets(), 0.0F);
+    EXPECT_EQ(stats.getAverageBytes(), 0.0F);
+
+    stats.record(3, 300);
+    stats.record(1, 100);
+    EXPECT_EQ(stats.flushes, 2);
+    EXPECT_EQ(stats.packets, 4);
+    EXPECT_EQ(stats.bytes, 400);
+    EXPECT_EQ(stats.max_packets, 3);
+    EXPECT_EQ(stats.max_bytes, 300);
+    EXPECT_FLOAT_EQ(stats.getAveragePackets(), 2.0F);
+    EXPECT_FLOAT_EQ(stats.getAverageBytes(), 200.0F);
+}
+
+}  // namespace endstone::core
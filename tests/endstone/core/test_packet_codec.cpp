@@ -0,0 +1,236 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <initializer_list>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/network/packet_codec.h"
+
+namespace endstone::core {
+
+namespace {
+/**
+ * Builds the expected encoding of a packet from bytes and string contents, without going through the codec.
+ */
+std::vector<std::byte> bytes(std::initializer_list<std::variant<int, std::string_view>> parts)
+{
+    std::vector<std::byte> result;
+    for (const auto &part : parts) {
+        if (const auto *value = std::get_if<int>(&part)) {
+            result.push_back(static_cast<std::byte>(*value));
+        }
+        else {
+            for (const auto c : std::get<std::string_view>(part)) {
+                result.push_back(static_cast<std::byte>(c));
+            }
+        }
+    }
+    return result;
+}
+}  // namespace
+
+class PacketCodecTest : public ::testing::Test {
+protected:
+    template <typename T>
+    static std::vector<std::byte> encode(const T &packet)
+    {
+        std::vector<std::byte> buffer(PacketCodec::getSize(packet));
+        PacketCodec::BufferWriter writer(buffer);
+        PacketCodec::encode(writer, packet);
+        EXPECT_EQ(writer.getPosition(), buffer.size());
+        return buffer;
+    }
+
+    template <typename T>
+    static T decode(const std::vector<std::byte> &buffer)
+    {
+        T packet;
+        PacketCodec::BufferReader reader(buffer);
+        PacketCodec::decode(reader, packet);
+        EXPECT_EQ(reader.getRemaining(), 0);
+        return packet;
+    }
+};
+
+TEST_F(PacketCodecTest, VarInt)
+{
+    std::vector<std::byte> buffer(5);
+    PacketCodec::BufferWriter writer(buffer);
+    writer.writeUnsignedVarInt(300);
+    writer.writeVarInt(-1);
+    writer.writeVarInt64(-129);
+    EXPECT_EQ(writer.getPosition(), 5);
+    EXPECT_EQ(buffer, bytes({0xAC, 0x02, 0x01, 0x81, 0x02}));
+
+    PacketCodec::BufferReader reader(buffer);
+    EXPECT_EQ(reader.readUnsignedVarInt(), 300);
+    EXPECT_EQ(reader.readVarInt(), -1);
+    EXPECT_EQ(reader.readVarInt64(), -129);
+}
+
+TEST_F(PacketCodecTest, SpawnParticleEffectPacket)
+{
+    SpawnParticleEffectPacket packet;
+    packet.dimension_id = 1;
+    packet.actor_id = -1;
+    packet.position = {1.5F, 64.0F, -2.0F};
+    packet.effect_name = "minecraft:heart_particle";
+    packet.molang_variables_json = "[]";
+
+    const auto expected = bytes({
+        0x01,                              // dimension id
+        0x01,                              // actor id, zigzag encoded
+        0x00, 0x00, 0xC0, 0x3F,            // x
+        0x00, 0x00, 0x80, 0x42,            // y
+        0x00, 0x00, 0x00, 0xC0,            // z
+        0x18, "minecraft:heart_particle",  // effect name
+        0x01, 0x02, "[]",                  // molang variables
+    });
+
+    const auto buffer = encode(packet);
+    EXPECT_EQ(buffer, expected);
+
+    const auto decoded = decode<SpawnParticleEffectPacket>(buffer);
+    EXPECT_EQ(decoded.dimension_id, packet.dimension_id);
+    EXPECT_EQ(decoded.actor_id, packet.actor_id);
+    EXPECT_EQ(decoded.position, packet.position);
+    EXPECT_EQ(decoded.effect_name, packet.effect_name);
+    EXPECT_EQ(decoded.molang_variables_json, packet.molang_variables_json);
+
+    packet.molang_variables_json.reset();
+    EXPECT_EQ(encode(packet).size(), expected.size() - 3);
+    EXPECT_FALSE(decode<SpawnParticleEffectPacket>(encode(packet)).molang_variables_json.has_value());
+}
+
+TEST_F(PacketCodecTest, SetTitlePacket)
+{
+    SetTitlePacket packet;
+    packet.type = SetTitlePacket::Type::Subtitle;
+    packet.text = "Hello";
+    packet.xuid = "2535400000000000";
+
+    const auto expected = bytes({
+        0x06,                      // type
+        0x05, "Hello",             // text
+        0x14,                      // fade in time
+        0x8C, 0x01,                // stay time
+        0x28,                      // fade out time
+        0x10, "2535400000000000",  // xuid
+        0x00,                      // platform online id
+        0x00,                      // filtered text
+    });
+
+    const auto buffer = encode(packet);
+    EXPECT_EQ(buffer, expected);
+
+    const auto decoded = decode<SetTitlePacket>(buffer);
+    EXPECT_EQ(decoded.type, SetTitlePacket::Type::Subtitle);
+    EXPECT_EQ(decoded.text, "Hello");
+    EXPECT_EQ(decoded.stay_time, 70);
+    EXPECT_EQ(decoded.xuid, "2535400000000000");
+}
+
+TEST_F(PacketCodecTest, PlaySoundPacket)
+{
+    PlaySoundPacket packet;
+    packet.sound_name = "random.orb";
+    packet.position = {-0.5F, 64.0F, 10.25F};
+    packet.volume = 0.5F;
+
+    const auto expected = bytes({
+        0x0A, "random.orb",      // sound name
+        0x07,                    // x
+        0x80, 0x04,              // y
+        0xA4, 0x01,              // z
+        0x00, 0x00, 0x00, 0x3F,  // volume
+        0x00, 0x00, 0x80, 0x3F,  // pitch
+    });
+
+    const auto buffer = encode(packet);
+    EXPECT_EQ(buffer, expected);
+
+    const auto decoded = decode<PlaySoundPacket>(buffer);
+    EXPECT_EQ(decoded.sound_name, "random.orb");
+    EXPECT_EQ(decoded.position, packet.position);
+    EXPECT_FLOAT_EQ(decoded.volume, 0.5F);
+    EXPECT_FLOAT_EQ(decoded.pitch, 1.0F);
+}
+
+TEST_F(PacketCodecTest, PlaySoundPacketBelowZero)
+{
+    PlaySoundPacket packet;
+    packet.sound_name = "random.orb";
+    packet.position = {0.3F, -1.1F, -0.3F};
+
+    // coordinates are floored, and Y keeps its sign through the unsigned varint
+    const auto expected = bytes({
+        0x0A, "random.orb",            // sound name
+        0x04,                          // x = 2
+        0xF7, 0xFF, 0xFF, 0xFF, 0x0F,  // y = -9
+        0x05,                          // z = -3
+        0x00, 0x00, 0x80, 0x3F,        // volume
+        0x00, 0x00, 0x80, 0x3F,        // pitch
+    });
+
+    const auto buffer = encode(packet);
+    EXPECT_EQ(buffer, expected);
+
+    const auto decoded = decode<PlaySoundPacket>(buffer);
+    EXPECT_EQ(decoded.position, (Vector<float>{0.25F, -1.125F, -0.375F}));
+}
+
+TEST_F(PacketCodecTest, EncodeByType)
+{
+    SetTitlePacket packet;
+    packet.text = "Title";
+    const Packet &base = packet;
+    EXPECT_EQ(PacketCodec::getSize(base), PacketCodec::getSize(packet));
+    EXPECT_EQ(PacketCodec::encode(base), encode(packet));
+}
+
+TEST_F(PacketCodecTest, BufferTooSmall)
+{
+    PlaySoundPacket packet;
+    packet.sound_name = "random.orb";
+    std::vector<std::byte> buffer(PacketCodec::getSize(packet) - 1);
+    PacketCodec::BufferWriter writer(buffer);
+    EXPECT_THROW(PacketCodec::encode(writer, packet), std::out_of_range);
+}
+
+TEST_F(PacketCodecTest, TruncatedPayload)
+{
+    SetTitlePacket packet;
+    packet.text = "Hello";
+    auto buffer = encode(packet);
+    buffer.pop_back();
+
+    SetTitlePacket decoded;
+    PacketCodec::BufferReader reader(buffer);
+    EXPECT_THROW(PacketCodec::decode(reader, decoded), std::out_of_range);
+}
+
+TEST_F(PacketCodecTest, StringLongerThanPayload)
+{
+    // a length prefix of 2^32 - 1 followed by a few bytes must not allocate 4 GiB
+    const auto buffer = bytes({0xFF, 0xFF, 0xFF, 0xFF, 0x0F, "a"});
+
+    PacketCodec::BufferReader reader(buffer);
+    EXPECT_THROW(reader.readString(), std::out_of_range);
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,155 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "endstone/core/logger_factory.h"
+#include "endstone/core/network/packet_pipeline.h"
+
+namespace endstone::core {
+
+class MockPlugin : public Plugin {
+public:
+    MOCK_METHOD(const PluginDescription &, getDescription, (), (const, override));
+};
+
+class PacketPipelineTest : public ::testing::Test {
+protected:
+    static UnconnectedMessage makeMessage(const std::vector<std::byte> &payload)
+    {
+        return {payload, {"127.0.0.1", 19132}};
+    }
+
+    PacketPipeline pipeline_{LoggerFactory::getLogger("PacketPipelineTest")};
+    std::vector<std::byte> payload_{std::byte{0x1c}, std::byte{0x01}, std::byte{0x02}};
+};
+
+TEST_F(PacketPipelineTest, DispatchByPacketId)
+{
+    auto *player = reinterpret_cast<Player *>(alignof(std::max_align_t));
+    const std::vector<Player *> recipients{player};
+    int calls = 0;
+    pipeline_.addPacketListener(310, [&](const OutboundPacket &packet) {
+        calls++;
+        EXPECT_EQ(packet.getId(), 310);
+        EXPECT_EQ(packet.getPayload().data(), payload_.data());  // no copy is made
+        ASSERT_EQ(packet.getRecipients().size(), 1);
+        EXPECT_EQ(packet.getRecipients()[0], player);
+    });
+    pipeline_.addPacketListener(9, [&](const OutboundPacket &) { FAIL() << "Listener for another ID was called"; });
+
+    EXPECT_TRUE(pipeline_.hasPacketListeners(310));
+    EXPECT_FALSE(pipeline_.hasPacketListeners(311));
+    EXPECT_FALSE(pipeline_.hasPacketListeners(-1));
+    EXPECT_FALSE(pipeline_.hasPacketListeners(PacketPipeline::MaxPacketId));
+
+    pipeline_.process(OutboundPacket(310, payload_, recipients));
+    pipeline_.process(OutboundPacket(311, payload_, recipients));
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(pipeline_.getStats().dispatched, 1);
+}
+
+TEST_F(PacketPipelineTest, DispatchByMessageId)
+{
+    int calls = 0;
+    pipeline_.addMessageListener(0x1c, [&](UnconnectedMessage &message) {
+        calls++;
+        EXPECT_EQ(message.getId(), 0x1c);
+        EXPECT_EQ(message.getPayload().size(), 3);
+        EXPECT_EQ(message.getPayload().data(), payload_.data());  // no copy is made
+        EXPECT_EQ(message.getAddress().getPort(), 19132);
+    });
+    pipeline_.addMessageListener(0x1d, [&](UnconnectedMessage &) { FAIL() << "Listener for another ID was called"; });
+
+    EXPECT_TRUE(pipeline_.hasMessageListeners(0x1c));
+    EXPECT_FALSE(pipeline_.hasMessageListeners(0x84));
+
+    auto message = makeMessage(payload_);
+    EXPECT_FALSE(pipeline_.process(message));
+    EXPECT_EQ(calls, 1);
+
+    const std::vector other_payload{std::byte{0x84}};
+    auto other = makeMessage(other_payload);
+    EXPECT_FALSE(pipeline_.process(other));
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(pipeline_.getStats().dispatched, 1);
+}
+
+TEST_F(PacketPipelineTest, ConnectedDatagramsAreNeverDispatched)
+{
+    // the high bit marks the header of a connected datagram, whose game packets must not be replaced
+    int calls = 0;
+    pipeline_.addMessageListener(0x84, [&](UnconnectedMessage &) { calls++; });
+    EXPECT_FALSE(pipeline_.hasMessageListeners(0x84));
+
+    const std::vector payload{std::byte{0x84}};
+    auto message = makeMessage(payload);
+    EXPECT_FALSE(pipeline_.process(message));
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(PacketPipelineTest, ReplacePayload)
+{
+    pipeline_.addMessageListener(
+        0x1c, [](UnconnectedMessage &message) { message.setPayload({std::byte{0x1c}, std::byte{0xff}}); });
+    pipeline_.addMessageListener(0x1c, [](UnconnectedMessage &message) {
+        // later listeners see the payload replaced by earlier ones
+        EXPECT_EQ(message.getPayload().size(), 2);
+    });
+
+    auto message = makeMessage(payload_);
+    EXPECT_TRUE(pipeline_.process(message));
+    EXPECT_TRUE(message.isModified());
+    ASSERT_EQ(message.getPayload().size(), 2);
+    EXPECT_EQ(message.getPayload()[1], std::byte{0xff});
+    EXPECT_EQ(payload_.size(), 3);
+    EXPECT_EQ(pipeline_.getStats().modified, 1);
+}
+
+TEST_F(PacketPipelineTest, ListenerExceptionIsCaught)
+{
+    int calls = 0;
+    pipeline_.addMessageListener(0x1c, [](UnconnectedMessage &) { throw std::runtime_error("error"); });
+    pipeline_.addMessageListener(0x1c, [&](UnconnectedMessage &) { calls++; });
+    pipeline_.addPacketListener(310, [](const OutboundPacket &) { throw std::runtime_error("error"); });
+    pipeline_.addPacketListener(310, [&](const OutboundPacket &) { calls++; });
+
+    auto message = makeMessage(payload_);
+    EXPECT_NO_THROW(pipeline_.process(message));
+    EXPECT_NO_THROW(pipeline_.process(OutboundPacket(310, payload_, {})));
+    EXPECT_EQ(calls, 2);
+}
+
+TEST_F(PacketPipelineTest, RemoveListenersByOwner)
+{
+    MockPlugin plugin;
+    int calls = 0;
+    pipeline_.addMessageListener(0x1c, [&](UnconnectedMessage &) { calls++; }, &plugin);
+    pipeline_.addMessageListener(0x1d, [&](UnconnectedMessage &) { calls++; }, &plugin);
+    pipeline_.addMessageListener(0x1d, [&](UnconnectedMessage &) { calls++; });
+    pipeline_.addPacketListener(310, [&](const OutboundPacket &) { calls++; }, &plugin);
+
+    pipeline_.removeListeners(plugin);
+    EXPECT_FALSE(pipeline_.hasMessageListeners(0x1c));
+    EXPECT_TRUE(pipeline_.hasMessageListeners(0x1d));
+    EXPECT_FALSE(pipeline_.hasPacketListeners(310));
+
+    const std::vector payload{std::byte{0x1d}};
+    auto message = makeMessage(payload);
+    pipeline_.process(message);
+    EXPECT_EQ(calls, 1);
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,253 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "endstone/core/network/packet_rate_limiter.h"
+
+namespace endstone::core {
+
+class PacketRateLimiterTest : public ::testing::Test {
+protected:
+    using Clock = PacketRateLimiter::Clock;
+    using Verdict = PacketRateLimiter::Verdict;
+
+    static PacketRateLimiter::Address makeAddress(std::uint8_t last_octet, std::uint16_t port = 19132)
+    {
+        PacketRateLimiter::Address address;
+        address.ip[10] = 0xff;
+        address.ip[11] = 0xff;
+        address.ip[12] = 127;
+        address.ip[15] = last_octet;
+        address.port = port;
+        return address;
+    }
+
+    static PacketRateLimiter::Config makeConfig()
+    {
+        PacketRateLimiter::Config config;
+        config.ping = {10, 5};
+        config.block_threshold = 100;
+        return config;
+    }
+
+    static constexpr std::uint8_t UnconnectedPing = 0x01;
+    static constexpr std::uint8_t Datagram = 0x84;
+    Clock::time_point now_ = Clock::now();
+};
+
+TEST_F(PacketRateLimiterTest, Classify)
+{
+    using PacketClass = PacketRateLimiter::PacketClass;
+    EXPECT_EQ(PacketRateLimiter::classify(0x01), PacketClass::Ping);
+    EXPECT_EQ(PacketRateLimiter::classify(0x05), PacketClass::Connection);
+    EXPECT_EQ(PacketRateLimiter::classify(0x07), PacketClass::Connection);
+    EXPECT_EQ(PacketRateLimiter::classify(0x84), PacketClass::Datagram);
+    EXPECT_EQ(PacketRateLimiter::classify(0xc0), PacketClass::Acknowledgement);
+    EXPECT_EQ(PacketRateLimiter::classify(0xa0), PacketClass::Acknowledgement);
+    EXPECT_EQ(PacketRateLimiter::classify(0x13), PacketClass::Other);
+}
+
+TEST_F(PacketRateLimiterTest, BurstThenRefill)
+{
+    PacketRateLimiter limiter{makeConfig()};
+    const auto address = makeAddress(1);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(limiter.check(address, UnconnectedPing, now_), Verdict::Accept);
+    }
+    EXPECT_EQ(limiter.check(address, UnconnectedPing, now_), Verdict::Drop);
+
+    // 10 tokens per second, one token is refilled after 100ms
+    now_ += std::chrono::milliseconds(100);
+    EXPECT_EQ(limiter.check(address, UnconnectedPing, now_), Verdict::Accept);
+    EXPECT_EQ(limiter.check(address, UnconnectedPing, now_), Verdict::Drop);
+
+    const auto stats = limiter.getStats();
+    EXPECT_EQ(stats.accepted[0], 6);
+    EXPECT_EQ(stats.dropped[0], 2);
+}
+
+TEST_F(PacketRateLimiterTest, BucketsArePerPeerAndClass)
+{
+    PacketRateLimiter limiter{makeConfig()};
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(limiter.check(makeAddress(1), UnconnectedPing, now_), Verdict::Accept);
+    }
+    EXPECT_EQ(limiter.check(makeAddress(1), UnconnectedPing, now_), Verdict::Drop);
+    EXPECT_EQ(limiter.check(makeAddress(1), Datagram, now_), Verdict::Accept);
+    EXPECT_EQ(limiter.check(makeAddress(1, 19133), UnconnectedPing, now_), Verdict::Accept);
+    EXPECT_EQ(limiter.check(makeAddress(2), UnconnectedPing, now_), Verdict::Accept);
+    EXPECT_EQ(limiter.getStats().peers, 3);
+}
+
+TEST_F(PacketRateLimiterTest, PingsAreLimitedPerHost)
+{
+    auto config = makeConfig();
+    config.ping_per_host = {1, 8};
+    PacketRateLimiter limiter{config};
+
+    // rotating the source port only helps until the per-host bucket is empty
+    for (std::uint16_t port = 0; port < 8; ++port) {
+        EXPECT_EQ(limiter.check(makeAddress(1, port), UnconnectedPing, now_), Verdict::Accept);
+    }
+    EXPECT_EQ(limiter.check(makeAddress(1, 8), UnconnectedPing, now_), Verdict::Drop);
+    EXPECT_EQ(limiter.check(makeAddress(1, 8), Datagram, now_), Verdict::Accept);
+    EXPECT_EQ(limiter.check(makeAddress(2, 8), UnconnectedPing, now_), Verdict::Accept);
+    EXPECT_EQ(limiter.check(makeAddress(1, 8), UnconnectedPing, now_ + std::chrono::seconds(1)), Verdict::Accept);
+}
+
+TEST_F(PacketRateLimiterTest, PingsAreLimitedInTotal)
+{
+    auto config = makeConfig();
+    config.ping_total = {1, 4};
+    PacketRateLimiter limiter{config};
+
+    for (std::uint8_t host = 0; host < 4; ++host) {
+        EXPECT_EQ(limiter.check(makeAddress(host), UnconnectedPing, now_), Verdict::Accept);
+    }
+    EXPECT_EQ(limiter.check(makeAddress(4), UnconnectedPing, now_), Verdict::Drop);
+    EXPECT_EQ(limiter.check(makeAddress(4), Datagram, now_), Verdict::Accept);
+}
+
+TEST_F(PacketRateLimiterTest, BlockFloodingPeer)
+{
+    auto config = makeConfig();
+    PacketRateLimiter limiter{config};
+    const auto address = makeAddress(1);
+
+    int blocked = 0;
+    for (int i = 0; i < 200; ++i) {
+        if (limiter.check(address, UnconnectedPing, now_) == Verdict::Block) {
+            blocked++;
+        }
+    }
+    EXPECT_EQ(blocked, 1);
+    EXPECT_EQ(limiter.getStats().blocked, 1);
+
+    // everything from a blocked peer is dropped, even packets that are within their limit
+    now_ += std::chrono::seconds(10);
+    EXPECT_EQ(limiter.check(address, Datagram, now_), Verdict::Drop);
+    EXPECT_EQ(limiter.check(makeAddress(2), Datagram, now_), Verdict::Accept);
+
+    now_ += config.block_duration;
+    EXPECT_EQ(limiter.check(address, Datagram, now_), Verdict::Accept);
+}
+
+TEST_F(PacketRateLimiterTest, ForgetIdlePeers)
+{
+    auto config = makeConfig();
+    PacketRateLimiter limiter{config};
+    (void)limiter.check(makeAddress(1), UnconnectedPing, now_);
+    (void)limiter.check(makeAddress(2), UnconnectedPing, now_);
+    EXPECT_EQ(limiter.getStats().peers, 2);
+
+    now_ += config.idle_timeout + std::chrono::seconds(1);
+    (void)limiter.check(makeAddress(3), UnconnectedPing, now_);
+    EXPECT_EQ(limiter.getStats().peers, 1);
+}
+
+TEST_F(PacketRateLimiterTest, MaxPeers)
+{
+    auto config = makeConfig();
+    config.max_peers = 2;
+    PacketRateLimiter limiter{config};
+    for (int i = 0; i < 6; ++i) {
+        (void)limiter.check(makeAddress(1), UnconnectedPing, now_);
+    }
+    (void)limiter.check(makeAddress(2), UnconnectedPing, now_);
+    (void)limiter.check(makeAddress(1), Datagram, now_);
+
+    // the least recently seen peer is evicted to make room for a new one
+    EXPECT_EQ(limiter.check(makeAddress(3), UnconnectedPing, now_), Verdict::Accept);
+    EXPECT_EQ(limiter.getStats().peers, 2);
+    EXPECT_EQ(limiter.check(makeAddress(1), UnconnectedPing, now_), Verdict::Drop);
+
+    // peer 3 is now the least recently seen, peer 1 keeps its state
+    EXPECT_EQ(limiter.check(makeAddress(4), UnconnectedPing, now_), Verdict::Accept);
+    EXPECT_EQ(limiter.check(makeAddress(1), UnconnectedPing, now_), Verdict::Drop);
+    EXPECT_EQ(limiter.getStats().peers, 2);
+}
+
+TEST_F(PacketRateLimiterTest, NewPeersAreLimitedPerPrefix)
+{
+    auto config = makeConfig();
+    config.new_peers_per_prefix = {1, 4};
+    PacketRateLimiter limiter{config};
+
+    // a spoofed flood from one /24 cannot fill the peer table
+    for (std::uint8_t host = 0; host < 4; ++host) {
+        EXPECT_EQ(limiter.check(makeAddress(host), Datagram, now_), Verdict::Accept);
+    }
+    EXPECT_EQ(limiter.check(makeAddress(4), Datagram, now_), Verdict::Drop);
+    EXPECT_EQ(limiter.getStats().peers, 4);
+
+    // known peers and other prefixes are not affected
+    EXPECT_EQ(limiter.check(makeAddress(0), Datagram, now_), Verdict::Accept);
+    auto other = makeAddress(4);
+    other.ip[14] = 1;
+    EXPECT_EQ(limiter.check(other, Datagram, now_), Verdict::Accept);
+
+    now_ += std::chrono::seconds(1);
+    EXPECT_EQ(limiter.check(makeAddress(4), Datagram, now_), Verdict::Accept);
+}
+
+TEST_F(PacketRateLimiterTest, Disabled)
+{
+    auto config = makeConfig();
+    config.enabled = false;
+    PacketRateLimiter limiter{config};
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(limiter.check(makeAddress(1), UnconnectedPing, now_), Verdict::Accept);
+    }
+}
+
+TEST_F(PacketRateLimiterTest, SetConfig)
+{
+    PacketRateLimiter limiter{makeConfig()};
+    auto config = limiter.getConfig();
+    config.enabled = false;
+    ASSERT_TRUE(limiter.setConfig(config));
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(limiter.check(makeAddress(1), UnconnectedPing, now_), Verdict::Accept);
+    }
+
+    config.enabled = true;
+    ASSERT_TRUE(limiter.setConfig(config));
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(limiter.check(makeAddress(1), UnconnectedPing, now_), Verdict::Accept);
+    }
+    EXPECT_EQ(limiter.check(makeAddress(1), UnconnectedPing, now_), Verdict::Drop);
+}
+
+TEST_F(PacketRateLimiterTest, RejectInvalidConfig)
+{
+    PacketRateLimiter limiter{makeConfig()};
+    auto config = makeConfig();
+    config.datagram.rate = -1;
+    EXPECT_FALSE(limiter.setConfig(config));
+
+    config = makeConfig();
+    config.ping_total.burst = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(limiter.setConfig(config));
+
+    config = makeConfig();
+    config.max_peers = 0;
+    EXPECT_FALSE(limiter.setConfig(config));
+
+    EXPECT_DOUBLE_EQ(limiter.getConfig().datagram.rate, makeConfig().datagram.rate);
+}
+
+}  // namespace endstone::core
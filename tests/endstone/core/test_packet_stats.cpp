@@ -0,0 +1,97 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/network/packet_stats.h"
+
+namespace endstone::core {
+
+TEST(PacketStatsTest, RecordPerIdAndDirection)
+{
+    PacketStats stats;
+    stats.record(PacketStats::Direction::Inbound, 1, 100);
+    stats.record(PacketStats::Direction::Inbound, 144, 40);
+    stats.record(PacketStats::Direction::Inbound, 144, 60);
+    stats.record(PacketStats::Direction::Outbound, 144, 10);
+
+    EXPECT_EQ(stats.get(PacketStats::Direction::Inbound, 1).packets, 1);
+    EXPECT_EQ(stats.get(PacketStats::Direction::Inbound, 1).bytes, 100);
+    EXPECT_EQ(stats.get(PacketStats::Direction::Inbound, 144).packets, 2);
+    EXPECT_EQ(stats.get(PacketStats::Direction::Inbound, 144).bytes, 100);
+    EXPECT_EQ(stats.get(PacketStats::Direction::Outbound, 144).packets, 1);
+    EXPECT_EQ(stats.get(PacketStats::Direction::Outbound, 144).bytes, 10);
+    EXPECT_EQ(stats.get(PacketStats::Direction::Outbound, 1).packets, 0);
+}
+
+TEST(PacketStatsTest, RecordPerRecipient)
+{
+    PacketStats stats;
+    stats.record(PacketStats::Direction::Outbound, 58, 2000, 3);
+
+    EXPECT_EQ(stats.get(PacketStats::Direction::Outbound, 58).packets, 3);
+    EXPECT_EQ(stats.get(PacketStats::Direction::Outbound, 58).bytes, 6000);
+}
+
+TEST(PacketStatsTest, GetTotal)
+{
+    PacketStats stats;
+    stats.record(PacketStats::Direction::Outbound, 9, 30);
+    stats.record(PacketStats::Direction::Outbound, 58, 2000);
+    stats.record(PacketStats::Direction::Inbound, 144, 80);
+
+    const auto total = stats.getTotal(PacketStats::Direction::Outbound);
+    EXPECT_EQ(total.packets, 2);
+    EXPECT_EQ(total.bytes, 2030);
+}
+
+TEST(PacketStatsTest, GetPacketTypeStats)
+{
+    PacketStats stats;
+    stats.record(PacketStats::Direction::Outbound, 9, 30);
+    stats.record(PacketStats::Direction::Inbound, 9, 20);
+    stats.record(PacketStats::Direction::Inbound, 144, 80);
+
+    const auto result = stats.getPacketTypeStats();
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].getId(), 9);
+    EXPECT_EQ(result[0].getName(), "Text");
+    EXPECT_EQ(result[0].getPacketsSent(), 1);
+    EXPECT_EQ(result[0].getBytesSent(), 30);
+    EXPECT_EQ(result[0].getPacketsReceived(), 1);
+    EXPECT_EQ(result[0].getBytesReceived(), 20);
+    EXPECT_EQ(result[1].getId(), 144);
+    EXPECT_EQ(result[1].getPacketsSent(), 0);
+    EXPECT_EQ(result[1].getBytesReceived(), 80);
+}
+
+TEST(PacketStatsTest, IgnoreOutOfRangeIds)
+{
+    PacketStats stats;
+    stats.record(PacketStats::Direction::Inbound, -1, 10);
+    stats.record(PacketStats::Direction::Inbound, static_cast<int>(PacketStats::MaxPacketId), 10);
+
+    EXPECT_EQ(stats.get(PacketStats::Direction::Inbound, -1).packets, 0);
+    EXPECT_EQ(stats.get(PacketStats::Direction::Inbound, static_cast<int>(PacketStats::MaxPacketId)).packets, 0);
+    EXPECT_EQ(stats.getTotal(PacketStats::Direction::Inbound).packets, 0);
+}
+
+TEST(PacketStatsTest, GetName)
+{
+    EXPECT_EQ(PacketStats::getName(1), "Login");
+    EXPECT_EQ(PacketStats::getName(320), "CameraAimAssistPresets");
+    EXPECT_EQ(PacketStats::getName(500), "");
+}
+
+}  // namespace endstone::core
@@ -35,6 +35,7 @@ protected:
     void TearDown() override
     {
         std::remove(file_.c_str());
+        std::remove((file_ + ".journal").c_str());
     }
 };
 
@@ -109,6 +110,42 @@ TEST_F(PlayerBanListTest, IsBanned)
     EXPECT_FALSE(ban_list.isBanned("playerNotExist"));
 }
 
+TEST_F(PlayerBanListTest, IsBannedIgnoresCase)
+{
+    EndstonePlayerBanList ban_list{file_};
+
+    ban_list.addBan("Player11", uuid_, xuid_, "Misconduct", std::nullopt, "Moderator");
+    EXPECT_TRUE(ban_list.isBanned("player11"));
+    EXPECT_TRUE(ban_list.isBanned("PLAYER11", uuid_, xuid_));
+    EXPECT_FALSE(ban_list.isBanned("player11", uuid_, "1234567890"));
+}
+
+TEST_F(PlayerBanListTest, IsBannedRemovesExpiredEntries)
+{
+    EndstonePlayerBanList ban_list{file_};
+
+    ban_list.addBan("player11", "Misconduct", std::chrono::seconds(-1), "Moderator");
+    ban_list.addBan("player12", "Misconduct", std::chrono::hours(1), "Moderator");
+    EXPECT_FALSE(ban_list.isBanned("player11"));
+    EXPECT_TRUE(ban_list.isBanned("player12"));
+    EXPECT_EQ(ban_list.getEntries().size(), 1);
+
+    // expiration brought forward after the entry was added
+    ban_list.getBanEntry("player12")->setExpiration(std::chrono::system_clock::now() - std::chrono::seconds(1));
+    EXPECT_FALSE(ban_list.isBanned("player12"));
+    EXPECT_EQ(ban_list.getEntries().size(), 0);
+}
+
+TEST_F(PlayerBanListTest, IsBannedKeepsExtendedEntries)
+{
+    EndstonePlayerBanList ban_list{file_};
+
+    ban_list.addBan("player11", "Misconduct", std::chrono::seconds(-1), "Moderator");
+    ban_list.getBanEntry("player11")->setExpiration(std::chrono::system_clock::now() + std::chrono::hours(1));
+    EXPECT_TRUE(ban_list.isBanned("player11"));
+    EXPECT_TRUE(ban_list.isBanned("player11"));
+}
+
 TEST_F(PlayerBanListTest, RemoveBanEntry)
 {
     EndstonePlayerBanList ban_list{file_};
@@ -237,6 +274,116 @@ TEST_F(PlayerBanListTest, LoadBanList)
     EXPECT_FALSE(entry->getExpiration());
 }
 
+TEST_F(PlayerBanListTest, LoadLargeBanList)
+{
+    constexpr int count = 100000;
+    nlohmann::json json = nlohmann::json::array();
+    for (int i = 0; i < count; i++) {
+        json.push_back({
+            {"name", fmt::format("Player{}", i)},
+            {"xuid", std::to_string(2535400000000000 + i)},
+            {"expires", "forever"},
+        });
+    }
+
+    std::ofstream file(file_);
+    file << json;
+    file.close();
+
+    EndstonePlayerBanList ban_list{file_};
+    auto result = ban_list.load();
+    EXPECT_TRUE(result) << result.error().getMessage() << result.error().getStackTrace();
+    EXPECT_EQ(ban_list.getEntries().size(), count);
+
+    for (int i = 0; i < count; i++) {
+        ASSERT_TRUE(ban_list.isBanned(fmt::format("player{}", i), std::nullopt, std::to_string(2535400000000000 + i)));
+    }
+    EXPECT_FALSE(ban_list.isBanned("player0", std::nullopt, "2535400000000001"));
+    EXPECT_FALSE(ban_list.isBanned(fmt::format("player{}", count)));
+}
+
+TEST_F(PlayerBanListTest, LoadFromJournal)
+{
+    {
+        EndstonePlayerBanList ban_list{file_};
+        ban_list.addBan("player11", uuid_, xuid_, "Misconduct", std::nullopt, "Moderator");
+        ban_list.addBan("player12", "Cheating", std::nullopt, "Admin");
+        ban_list.addBan("player13", "Abuse", std::nullopt, "AutoModeration");
+        ban_list.removeBan("player12");
+    }
+
+    EndstonePlayerBanList ban_list{file_};
+    auto result = ban_list.load();
+    EXPECT_TRUE(result) << result.error().getMessage() << result.error().getStackTrace();
+
+    EXPECT_EQ(ban_list.getEntries().size(), 2);
+    auto *entry = ban_list.getBanEntry("player11");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->getUniqueId(), uuid_);
+    EXPECT_EQ(entry->getXuid(), xuid_);
+    EXPECT_EQ(entry->getReason(), "Misconduct");
+    EXPECT_EQ(entry->getSource(), "Moderator");
+    EXPECT_EQ(ban_list.getBanEntry("player12"), nullptr);
+    EXPECT_NE(ban_list.getBanEntry("player13"), nullptr);
+}
+
+TEST_F(PlayerBanListTest, LoadIgnoresIncompleteJournalRecord)
+{
+    {
+        EndstonePlayerBanList ban_list{file_};
+        ban_list.addBan("player11", "Misconduct", std::nullopt, "Moderator");
+    }
+    {
+        std::ofstream journal(file_ + ".journal", std::ios::app);
+        journal << R"({"key":"player12","entries":[{"name":"play)";
+    }
+
+    EndstonePlayerBanList ban_list{file_};
+    auto result = ban_list.load();
+    EXPECT_TRUE(result) << result.error().getMessage() << result.error().getStackTrace();
+    EXPECT_EQ(ban_list.getEntries().size(), 1);
+    EXPECT_NE(ban_list.getBanEntry("player11"), nullptr);
+}
+
+TEST_F(PlayerBanListTest, SaveClearsJournal)
+{
+    EndstonePlayerBanList ban_list{file_};
+    ban_list.addBan("player11", "Misconduct", std::nullopt, "Moderator");
+    ban_list.addBan("player12", "Cheating", std::nullopt, "Admin");
+
+    auto result = ban_list.save();
+    EXPECT_TRUE(result) << result.error().getMessage() << result.error().getStackTrace();
+    EXPECT_FALSE(std::filesystem::exists(file_ + ".journal"));
+
+    ban_list.removeBan("player11");
+    EndstonePlayerBanList reloaded{file_};
+    ASSERT_TRUE(ban_list.load());  // waits for the pending journal record
+    ASSERT_TRUE(reloaded.load());
+    EXPECT_EQ(reloaded.getEntries().size(), 1);
+    EXPECT_NE(reloaded.getBanEntry("player12"), nullptr);
+}
+
+TEST_F(PlayerBanListTest, SharedWriter)
+{
+    auto writer = std::make_shared<SerialExecutor>();
+    std::string other_file = "test_banned_players_other.json";
+    {
+        EndstonePlayerBanList ban_list{file_, writer};
+        EndstonePlayerBanList other{other_file, writer};
+        ban_list.addBan("player11", "Misconduct", std::nullopt, "Moderator");
+        other.addBan("player12", "Cheating", std::nullopt, "Admin");
+    }
+
+    EndstonePlayerBanList ban_list{file_};
+    EndstonePlayerBanList other{other_file};
+    ASSERT_TRUE(ban_list.load());
+    ASSERT_TRUE(other.load());
+    std::remove((other_file + ".journal").c_str());
+    EXPECT_NE(ban_list.getBanEntry("player11"), nullptr);
+    EXPECT_EQ(ban_list.getBanEntry("player12"), nullptr);
+    EXPECT_NE(other.getBanEntry("player12"), nullptr);
+}
+
 TEST_F(PlayerBanListTest, LoadNonExistingFile)
 {
     EndstonePlayerBanList ban_list{"non_existing_banned_players.json"};
@@ -0,0 +1,85 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "endstone/core/player_index.h"
+
+namespace endstone::core {
+
+class PlayerIndexTest : public ::testing::Test {
+protected:
+    static Player *makePlayer(std::uintptr_t id)
+    {
+        // The index never dereferences the pointers it holds, opaque values are good enough for testing
+        return reinterpret_cast<Player *>(id * alignof(std::max_align_t));
+    }
+
+    static NetworkIdentifier makeNetworkId(std::uint64_t guid)
+    {
+        NetworkIdentifier network_id{};
+        network_id.guid = RakNet::RakNetGUID{guid};
+        network_id.type = NetworkIdentifier::Type::RakNet;
+        return network_id;
+    }
+};
+
+TEST_F(PlayerIndexTest, Lookup)
+{
+    PlayerIndex index;
+    index.add(makePlayer(1), "Steve", "2535400000000001", makeNetworkId(1), SubClientId::PrimaryClient);
+    index.add(makePlayer(2), "Alex", "", makeNetworkId(2), SubClientId::PrimaryClient);
+
+    EXPECT_EQ(index.getByName("Steve"), makePlayer(1));
+    EXPECT_EQ(index.getByName("sTEVE"), makePlayer(1));
+    EXPECT_EQ(index.getByName("alex"), makePlayer(2));
+    EXPECT_EQ(index.getByName("Herobrine"), nullptr);
+
+    EXPECT_EQ(index.getByXuid("2535400000000001"), makePlayer(1));
+    EXPECT_EQ(index.getByXuid(""), nullptr);
+
+    EXPECT_EQ(index.getByNetworkId(makeNetworkId(2), SubClientId::PrimaryClient), makePlayer(2));
+    EXPECT_EQ(index.getByNetworkId(makeNetworkId(2), SubClientId::Client2), nullptr);
+    EXPECT_EQ(index.getByNetworkId(makeNetworkId(3), SubClientId::PrimaryClient), nullptr);
+}
+
+TEST_F(PlayerIndexTest, Remove)
+{
+    PlayerIndex index;
+    index.add(makePlayer(1), "Steve", "1", makeNetworkId(1), SubClientId::PrimaryClient);
+    index.remove(makePlayer(1));
+    index.remove(makePlayer(1));
+
+    EXPECT_EQ(index.getByName("Steve"), nullptr);
+    EXPECT_EQ(index.getByXuid("1"), nullptr);
+    EXPECT_EQ(index.getByNetworkId(makeNetworkId(1), SubClientId::PrimaryClient), nullptr);
+}
+
+TEST_F(PlayerIndexTest, RemoveKeepsNewerPlayer)
+{
+    // A player who rejoins may be constructed before the previous instance is destroyed
+    PlayerIndex index;
+    index.add(makePlayer(1), "Steve", "1", makeNetworkId(1), SubClientId::PrimaryClient);
+    index.add(makePlayer(2), "Steve", "1", makeNetworkId(2), SubClientId::PrimaryClient);
+    index.remove(makePlayer(1));
+
+    EXPECT_EQ(index.getByName("Steve"), makePlayer(2));
+    EXPECT_EQ(index.getByXuid("1"), makePlayer(2));
+    EXPECT_EQ(index.getByNetworkId(makeNetworkId(1), SubClientId::PrimaryClient), nullptr);
+    EXPECT_EQ(index.getByNetworkId(makeNetworkId(2), SubClientId::PrimaryClient), makePlayer(2));
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,98 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/level/ray_trace.h"
+
+namespace endstone::core {
+
+TEST(RayTraceTest, IntersectRayBox)
+{
+    const Vector<double> min{0, 0, 0};
+    const Vector<double> max{1, 1, 1};
+
+    auto hit = intersectRayBox({-1, 0.5, 0.5}, {1, 0, 0}, min, max, 10);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_DOUBLE_EQ(hit->distance, 1);
+    EXPECT_EQ(hit->face, BlockFace::West);
+
+    hit = intersectRayBox({0.5, 3, 0.5}, {0, -1, 0}, min, max, 10);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_DOUBLE_EQ(hit->distance, 2);
+    EXPECT_EQ(hit->face, BlockFace::Up);
+
+    // misses, points away, and too far away
+    EXPECT_FALSE(intersectRayBox({-1, 2, 0.5}, {1, 0, 0}, min, max, 10).has_value());
+    EXPECT_FALSE(intersectRayBox({-1, 0.5, 0.5}, {-1, 0, 0}, min, max, 10).has_value());
+    EXPECT_FALSE(intersectRayBox({-1, 0.5, 0.5}, {1, 0, 0}, min, max, 0.5).has_value());
+}
+
+TEST(RayTraceTest, IntersectRayBoxFromInside)
+{
+    const auto hit = intersectRayBox({0.5, 0.5, 0.5}, {0, 0, 1}, {0, 0, 0}, {1, 1, 1}, 10);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_DOUBLE_EQ(hit->distance, 0);
+    EXPECT_EQ(hit->face, BlockFace::North);
+}
+
+TEST(RayTraceTest, TraverseBlocksAlongAxis)
+{
+    std::vector<int> visited;
+    traverseBlocks({0.5, 64.5, 0.5}, {-1, 0, 0}, 3, [&](int x, int y, int z) {
+        EXPECT_EQ(y, 64);
+        EXPECT_EQ(z, 0);
+        visited.push_back(x);
+        return false;
+    });
+    EXPECT_EQ(visited, (std::vector<int>{0, -1, -2, -3}));
+}
+
+TEST(RayTraceTest, TraverseBlocksIsContinuous)
+{
+    const Vector<double> origin{0.3, 70.1, -4.7};
+    const auto direction = Vector<double>{0.6, -0.25, 0.8} / Vector<double>{0.6, -0.25, 0.8}.length();
+    int count = 0;
+    int last[3] = {0, 70, -5};
+    traverseBlocks(origin, direction, 50, [&](int x, int y, int z) {
+        if (count++ > 0) {
+            // every block shares a face with the previous one
+            EXPECT_EQ(std::abs(x - last[0]) + std::abs(y - last[1]) + std::abs(z - last[2]), 1);
+        }
+        last[0] = x;
+        last[1] = y;
+        last[2] = z;
+        return false;
+    });
+
+    const auto end = origin + direction * 50.0;
+    EXPECT_EQ(last[0], static_cast<int>(std::floor(end.getX())));
+    EXPECT_EQ(last[1], static_cast<int>(std::floor(end.getY())));
+    EXPECT_EQ(last[2], static_cast<int>(std::floor(end.getZ())));
+}
+
+TEST(RayTraceTest, TraverseBlocksStops)
+{
+    int count = 0;
+    traverseBlocks({0, 0, 0}, {0, 1, 0}, 100, [&](int, int y, int) {
+        count++;
+        return y == 5;
+    });
+    EXPECT_EQ(count, 6);
+}
+
+}  // namespace endstone::core
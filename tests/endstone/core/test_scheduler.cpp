@@ -34,19 +34,39 @@ public:
     MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
     MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
     MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(std::vector<bool>, dispatchCommands, (endstone::CommandSender &, std::span<const std::string>),
+                (const, override));
     MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
     MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
     MOCK_METHOD(std::vector<endstone::Player *>, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(std::uint64_t, getOnlinePlayersVersion, (), (const, override));
     MOCK_METHOD(int, getMaxPlayers, (), (const, override));
     MOCK_METHOD(endstone::Result<void>, setMaxPlayers, (int), (override));
     MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
     MOCK_METHOD(endstone::Player *, getPlayer, (std::string), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayerByXuid, (std::string), (const, override));
     MOCK_METHOD(bool, getOnlineMode, (), (const, override));
     MOCK_METHOD(void, shutdown, (), (override));
     MOCK_METHOD(void, reload, (), (override));
     MOCK_METHOD(void, reloadData, (), (override));
     MOCK_METHOD(void, broadcast, (const endstone::Message &, const std::string &), (const, override));
     MOCK_METHOD(void, broadcastMessage, (const endstone::Message &), (const, override));
+    MOCK_METHOD(void, broadcastPacket, (endstone::Packet &, const std::vector<endstone::Player *> &),
+                (const, override));
+    MOCK_METHOD(endstone::Result<void>, registerPacketListener,
+                (endstone::Plugin &, int, std::function<void(const endstone::OutboundPacket &)>), (override));
+    MOCK_METHOD(endstone::Result<void>, registerUnconnectedMessageListener,
+                (endstone::Plugin &, std::uint8_t, std::function<void(endstone::UnconnectedMessage &)>), (override));
+    MOCK_METHOD(void, unregisterPacketListeners, (endstone::Plugin &), (override));
+    MOCK_METHOD(endstone::NetworkStats, getNetworkStats, (), (const, override));
+    MOCK_METHOD(std::vector<endstone::PacketTypeStats>, getPacketTypeStats, (), (const, override));
+    MOCK_METHOD(endstone::PacketRateLimitConfig, getPacketRateLimit, (), (const, override));
+    MOCK_METHOD(endstone::Result<void>, setPacketRateLimit, (const endstone::PacketRateLimitConfig &), (override));
+    MOCK_METHOD(std::chrono::milliseconds, getServerListPingCacheTtl, (), (const, override));
+    MOCK_METHOD(endstone::Result<void>, setServerListPingCacheTtl, (std::chrono::milliseconds), (override));
+    MOCK_METHOD(void, invalidateServerListPing, (), (override));
+    MOCK_METHOD(bool, isServerListPingReplyEnabled, (), (const, override));
+    MOCK_METHOD(void, setServerListPingReplyEnabled, (bool), (override));
     MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
     MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
     MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, createScoreboard, (), (override));
@@ -0,0 +1,81 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/scheduler/serial_executor.h"
+
+using endstone::core::SerialExecutor;
+
+// Test if tasks are executed
+TEST(SerialExecutorTest, ExecuteTasks)
+{
+    SerialExecutor executor;
+    auto future1 = executor.submit([]() { return 1; });
+    auto future2 = executor.submit([](int a, int b) { return a + b; }, 2, 3);
+    EXPECT_EQ(future1.get(), 1);
+    EXPECT_EQ(future2.get(), 5);
+}
+
+// Test if tasks submitted from different threads run in the order they were submitted
+TEST(SerialExecutorTest, SubmissionOrderAcrossThreads)
+{
+    SerialExecutor executor;
+    std::vector<int> order;  // only touched by the executor thread
+
+    // Hold the executor so every task below is queued before any of them runs
+    std::promise<void> gate;
+    executor.submit([f = gate.get_future().share()]() { f.wait(); });
+
+    for (int i = 0; i < 100; ++i) {
+        // each task is submitted from its own thread, which finishes submitting before the next one starts
+        std::thread([&executor, &order, i]() { executor.submit([&order, i]() { order.push_back(i); }); }).join();
+    }
+
+    gate.set_value();
+    executor.submit([]() {}).get();
+
+    ASSERT_EQ(order.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+// Test if the destructor runs the tasks that are still queued
+TEST(SerialExecutorTest, DestructorDrainsTasks)
+{
+    int counter = 0;
+    {
+        SerialExecutor executor;
+        for (int i = 0; i < 10; ++i) {
+            executor.submit([&counter]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                counter++;
+            });
+        }
+    }
+    EXPECT_EQ(counter, 10);
+}
+
+// Test if tasks with exceptions are handled properly
+TEST(SerialExecutorTest, TaskWithException)
+{
+    SerialExecutor executor;
+    auto future = executor.submit([]() { throw std::runtime_error("Task exception"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+    EXPECT_EQ(executor.submit([]() { return 1; }).get(), 1);
+}
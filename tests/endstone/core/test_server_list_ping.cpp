@@ -0,0 +1,217 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "endstone/core/logger_factory.h"
+#include "endstone/core/network/server_list_ping.h"
+
+namespace endstone::core {
+
+class ServerListPingTest : public ::testing::Test {
+protected:
+    using Clock = ServerListPing::Clock;
+
+    static std::vector<std::byte> makePong(const std::string &server_info, std::uint8_t time = 0)
+    {
+        std::vector<std::byte> payload(HeadSize, std::byte{0});
+        payload[0] = std::byte{0x1c};
+        payload[8] = std::byte{time};
+        payload.push_back(static_cast<std::byte>(server_info.length() >> 8));
+        payload.push_back(static_cast<std::byte>(server_info.length() & 0xFF));
+        const auto *begin = reinterpret_cast<const std::byte *>(server_info.data());
+        payload.insert(payload.end(), begin, begin + server_info.length());
+        return payload;
+    }
+
+    static std::vector<std::byte> makePing(std::uint8_t time)
+    {
+        std::vector<std::byte> ping(ServerListPing::PingSize, std::byte{0});
+        ping[0] = std::byte{0x01};
+        ping[8] = std::byte{time};
+        ping[ServerListPing::PingSize - 1] = std::byte{0xff};  // client GUID
+        return ping;
+    }
+
+    static std::string getServerInfo(const UnconnectedMessage &packet)
+    {
+        const auto payload = packet.getPayload();
+        return {reinterpret_cast<const char *>(payload.data()) + HeadSize + 2, payload.size() - HeadSize - 2};
+    }
+
+    ServerListPing createServerListPing(Clock::duration ttl)
+    {
+        return ServerListPing{[this](const std::string &server_info, const SocketAddress &) {
+                                  renders_++;
+                                  return std::optional(server_info + ";Endstone");
+                              },
+                              ttl};
+    }
+
+    static constexpr std::size_t HeadSize = ServerListPing::PongHeadSize;
+    int renders_ = 0;
+    Clock::time_point now_ = Clock::now();
+    SocketAddress address_{"127.0.0.1", 19132};
+};
+
+TEST_F(ServerListPingTest, RenderOnceWithinTtl)
+{
+    auto ping = createServerListPing(std::chrono::seconds(1));
+    const auto first = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;", 1);
+    const auto second = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;", 2);
+
+    UnconnectedMessage packet1{first, address_};
+    ping.onUnconnectedPong(packet1, now_);
+    UnconnectedMessage packet2{second, address_};
+    ping.onUnconnectedPong(packet2, now_ + std::chrono::milliseconds(500));
+
+    EXPECT_EQ(renders_, 1);
+    EXPECT_EQ(getServerInfo(packet1), "MCPE;Dedicated Server;800;1.21.80;0;10;;Endstone");
+    EXPECT_EQ(getServerInfo(packet2), "MCPE;Dedicated Server;800;1.21.80;0;10;;Endstone");
+    EXPECT_EQ(packet2.getPayload()[8], std::byte{2});  // the head of each pong is kept
+    EXPECT_EQ(ping.getStats().hits, 1);
+    EXPECT_EQ(ping.getStats().misses, 1);
+}
+
+TEST_F(ServerListPingTest, RenderAgainWhenServerInfoChanges)
+{
+    auto ping = createServerListPing(std::chrono::seconds(1));
+    const auto first = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;");
+    const auto second = makePong("MCPE;Dedicated Server;800;1.21.80;1;10;");
+
+    UnconnectedMessage packet1{first, address_};
+    ping.onUnconnectedPong(packet1, now_);
+    UnconnectedMessage packet2{second, address_};
+    ping.onUnconnectedPong(packet2, now_);
+
+    EXPECT_EQ(renders_, 2);
+    EXPECT_EQ(getServerInfo(packet2), "MCPE;Dedicated Server;800;1.21.80;1;10;;Endstone");
+}
+
+TEST_F(ServerListPingTest, RenderAgainAfterTtlOrInvalidate)
+{
+    auto ping = createServerListPing(std::chrono::seconds(1));
+    const auto payload = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;");
+
+    UnconnectedMessage packet1{payload, address_};
+    ping.onUnconnectedPong(packet1, now_);
+    UnconnectedMessage packet2{payload, address_};
+    ping.onUnconnectedPong(packet2, now_ + std::chrono::seconds(1));
+    EXPECT_EQ(renders_, 2);
+
+    ping.invalidate();
+    UnconnectedMessage packet3{payload, address_};
+    ping.onUnconnectedPong(packet3, now_ + std::chrono::seconds(1));
+    EXPECT_EQ(renders_, 3);
+}
+
+TEST_F(ServerListPingTest, ZeroTtlDisablesCache)
+{
+    auto ping = createServerListPing(Clock::duration::zero());
+    const auto payload = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;");
+    for (int i = 0; i < 3; ++i) {
+        UnconnectedMessage packet{payload, address_};
+        ping.onUnconnectedPong(packet, now_);
+    }
+    EXPECT_EQ(renders_, 3);
+}
+
+TEST_F(ServerListPingTest, CacheDisabledByDefault)
+{
+    ServerListPing ping{[this](const std::string &server_info, const SocketAddress &) {
+        renders_++;
+        return std::optional(server_info);
+    }};
+    EXPECT_EQ(ping.getTtl(), Clock::duration::zero());
+
+    const auto payload = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;");
+    UnconnectedMessage packet{payload, address_};
+    ping.onUnconnectedPong(packet, now_);
+    std::array<std::byte, 256> buffer{};
+    EXPECT_EQ(ping.respond(makePing(1), buffer, now_), 0);
+}
+
+TEST_F(ServerListPingTest, IgnoreMalformedPong)
+{
+    auto ping = createServerListPing(std::chrono::seconds(1));
+    auto payload = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;");
+    payload.pop_back();
+
+    UnconnectedMessage packet{payload, address_};
+    ping.onUnconnectedPong(packet, now_);
+    EXPECT_FALSE(packet.isModified());
+    EXPECT_EQ(renders_, 0);
+}
+
+TEST_F(ServerListPingTest, RespondFromCache)
+{
+    auto ping = createServerListPing(std::chrono::seconds(1));
+    std::array<std::byte, 1500> buffer{};
+    EXPECT_EQ(ping.respond(makePing(1), buffer, now_), 0);  // nothing cached yet
+
+    const auto payload = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;", 1);
+    UnconnectedMessage packet{payload, address_};
+    ping.onUnconnectedPong(packet, now_);
+
+    const auto size = ping.respond(makePing(2), buffer, now_);
+    ASSERT_EQ(size, packet.getPayload().size());
+    EXPECT_EQ(buffer[8], std::byte{2});  // the time of the ping is echoed
+    buffer[8] = std::byte{1};
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.begin() + size, packet.getPayload().begin()));
+    EXPECT_EQ(ping.getStats().replies, 1);
+    EXPECT_EQ(renders_, 1);
+
+    EXPECT_EQ(ping.respond(makePing(3), buffer, now_ + std::chrono::seconds(1)), 0);  // expired
+    EXPECT_EQ(ping.respond(makePing(3), std::span(buffer).first(HeadSize), now_), 0);  // too small
+    auto malformed = makePing(3);
+    malformed.pop_back();
+    EXPECT_EQ(ping.respond(malformed, buffer, now_), 0);
+}
+
+TEST_F(ServerListPingTest, RespondThroughPipeline)
+{
+    // wired the same way as the server: pongs sent by RakNet go through the pipeline, pings are answered by respond
+    PacketPipeline pipeline{LoggerFactory::getLogger("ServerListPingTest")};
+    auto ping = createServerListPing(std::chrono::minutes(1));
+    ping.attach(pipeline);
+    ASSERT_TRUE(pipeline.hasMessageListeners(0x1c));
+
+    std::array<std::byte, 1500> buffer{};
+    EXPECT_EQ(ping.respond(makePing(1), buffer), 0);
+
+    const auto payload = makePong("MCPE;Dedicated Server;800;1.21.80;0;10;", 1);
+    UnconnectedMessage packet{payload, address_};
+    EXPECT_TRUE(pipeline.process(packet));
+    EXPECT_EQ(getServerInfo(packet), "MCPE;Dedicated Server;800;1.21.80;0;10;;Endstone");
+
+    const auto size = ping.respond(makePing(2), buffer);
+    ASSERT_EQ(size, packet.getPayload().size());
+    EXPECT_EQ(buffer[8], std::byte{2});
+    EXPECT_EQ(ping.getStats().replies, 1);
+
+    ping.setReplyEnabled(false);
+    EXPECT_EQ(ping.respond(makePing(3), buffer), 0);
+    ping.setReplyEnabled(true);
+    EXPECT_NE(ping.respond(makePing(3), buffer), 0);
+    EXPECT_EQ(renders_, 1);
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,97 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+#include "endstone/core/util/tracked_list.h"
+
+namespace endstone::core {
+
+TEST(TrackedListTest, AddAndRemove)
+{
+    std::array<int, 3> items{};
+    TrackedList<int> list;
+    EXPECT_TRUE(list.add(&items[0]));
+    EXPECT_TRUE(list.add(&items[1]));
+    EXPECT_TRUE(list.add(&items[2]));
+    EXPECT_FALSE(list.add(&items[1]));
+    EXPECT_FALSE(list.add(nullptr));
+    EXPECT_EQ(list.size(), 3);
+
+    EXPECT_TRUE(list.remove(&items[0]));
+    EXPECT_FALSE(list.remove(&items[0]));
+    EXPECT_FALSE(list.contains(&items[0]));
+    EXPECT_TRUE(list.contains(&items[1]));
+    EXPECT_TRUE(list.contains(&items[2]));
+
+    // the last element fills the gap left by the removed one
+    EXPECT_EQ(list.values(), (std::vector<int *>{&items[2], &items[1]}));
+
+    EXPECT_TRUE(list.remove(&items[1]));
+    EXPECT_TRUE(list.remove(&items[2]));
+    EXPECT_TRUE(list.values().empty());
+}
+
+TEST(TrackedListTest, Version)
+{
+    int a = 0;
+    int b = 0;
+    TrackedList<int> list;
+    EXPECT_EQ(list.getVersion(), 0);
+
+    list.add(&a);
+    list.add(&b);
+    EXPECT_EQ(list.getVersion(), 2);
+
+    // no-ops leave the version untouched
+    list.add(&a);
+    list.remove(nullptr);
+    EXPECT_EQ(list.getVersion(), 2);
+
+    list.remove(&a);
+    EXPECT_EQ(list.getVersion(), 3);
+}
+
+TEST(TrackedListTest, RandomOperations)
+{
+    std::array<int, 64> items{};
+    TrackedList<int> list;
+    std::vector<int *> expected;
+    unsigned seed = 12345;
+    for (int i = 0; i < 10000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        auto *item = &items[(seed >> 16) % items.size()];
+        if (auto it = std::find(expected.begin(), expected.end(), item); it != expected.end()) {
+            expected.erase(it);
+            EXPECT_TRUE(list.remove(item));
+        }
+        else {
+            expected.push_back(item);
+            EXPECT_TRUE(list.add(item));
+        }
+    }
+
+    auto actual = list.values();
+    std::sort(actual.begin(), actual.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(actual, expected);
+    for (auto *item : expected) {
+        EXPECT_TRUE(list.contains(item));
+    }
+}
+
+}  // namespace endstone::core